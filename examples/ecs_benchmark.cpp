@@ -0,0 +1,129 @@
+// Compares the ECS storage backends on iteration and structural changes.
+//
+//   kinetica_ecs_benchmark [entityCount]
+//
+// "unordered_map" is the original storage (one std::unordered_map<CUUID, T> per
+// component type), kept here as a reference point.
+
+#include <kinetica/ecs/registry.hpp>
+#include <kinetica/uuid.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Kinetica;
+using namespace Kinetica::Components;
+
+namespace {
+
+    struct SVelocity {
+        glm::vec3 value = glm::vec3(0.0f);
+    };
+
+    struct SSelected {
+        bool active = true;
+    };
+
+    // The pre-sparse-set storage layout, reduced to what the benchmark touches.
+    struct SUnorderedMapWorld {
+        std::vector<CUUID> entities;
+        std::unordered_map<CUUID, STransform> transforms;
+        std::unordered_map<CUUID, SVelocity> velocities;
+        std::unordered_map<CUUID, SSelected> selected;
+    };
+
+    double timeMs(const std::function<void()>& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    struct SResult {
+        double create = 0.0;
+        double iterate = 0.0;
+        double addRemove = 0.0;
+        float checksum = 0.0f;
+    };
+
+    SResult runUnorderedMap(std::size_t count) {
+        SResult result;
+        SUnorderedMapWorld world;
+
+        result.create = timeMs([&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                const CUUID id = CUUID::generate();
+                world.entities.push_back(id);
+                world.transforms[id].position.x = static_cast<float>(i);
+                world.velocities[id].value = glm::vec3(1.0f);
+            }
+        });
+
+        result.iterate = timeMs([&] {
+            for (const CUUID& id : world.entities) {
+                auto t = world.transforms.find(id);
+                auto v = world.velocities.find(id);
+                if (t == world.transforms.end() || v == world.velocities.end()) continue;
+                t->second.position += v->second.value;
+                result.checksum += t->second.position.x;
+            }
+        });
+
+        result.addRemove = timeMs([&] {
+            for (const CUUID& id : world.entities) world.selected[id];
+            for (const CUUID& id : world.entities) world.selected.erase(id);
+        });
+        return result;
+    }
+
+    SResult runRegistry(EStorageMode mode, std::size_t count) {
+        SResult result;
+        CRegistry registry(mode);
+        std::vector<EntityID> entities;
+        entities.reserve(count);
+
+        result.create = timeMs([&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                const EntityID e = registry.createEntity();
+                entities.push_back(e);
+                registry.addComponent<STransform>(e).position.x = static_cast<float>(i);
+                registry.addComponent<SVelocity>(e).value = glm::vec3(1.0f);
+            }
+        });
+
+        result.iterate = timeMs([&] {
+            registry.view<STransform, SVelocity>().each([&](STransform& t, SVelocity& v) {
+                t.position += v.value;
+                result.checksum += t.position.x;
+            });
+        });
+
+        result.addRemove = timeMs([&] {
+            for (const EntityID e : entities) registry.addComponent<SSelected>(e);
+            for (const EntityID e : entities) registry.removeComponent<SSelected>(e);
+        });
+        return result;
+    }
+
+    void print(const char* name, const SResult& r) {
+        std::printf("%-14s %12.2f %12.2f %14.2f   (checksum %.0f)\n",
+                    name, r.create, r.iterate, r.addRemove, static_cast<double>(r.checksum));
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+
+    std::printf("Entities: %zu (STransform + SVelocity, tag add/remove)\n\n", count);
+    std::printf("%-14s %12s %12s %14s\n", "storage", "create ms", "iterate ms", "add+remove ms");
+    print("unordered_map", runUnorderedMap(count));
+    print("sparse set", runRegistry(EStorageMode::SparseSet, count));
+    print("archetype", runRegistry(EStorageMode::Archetype, count));
+    return 0;
+}
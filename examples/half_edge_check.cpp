@@ -0,0 +1,138 @@
+// Checks CHalfEdgeMesh adjacency against a brute-force scan of the
+// half-edges: valence, findHalfEdge and twin links on closed meshes, open
+// fans and grids, and after local edits.
+//
+//   kinetica_half_edge_check [gridSize]
+
+#include <kinetica/geometry/half_edge_mesh.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+using namespace Kinetica;
+using Components::SVertex;
+using Geometry::CHalfEdgeMesh;
+using Geometry::INVALID_INDEX;
+
+namespace {
+
+    SVertex vertexAt(float x, float y, float z) { return SVertex{x, y, z, 0.0f, 0.0f, 1.0f, x, y}; }
+
+    CHalfEdgeMesh makeGrid(std::uint32_t size) {
+        std::vector<SVertex> vertices;
+        for (std::uint32_t y = 0; y <= size; ++y)
+            for (std::uint32_t x = 0; x <= size; ++x) vertices.push_back(vertexAt(float(x), float(y), 0.0f));
+        std::vector<std::uint32_t> sizes, indices;
+        for (std::uint32_t y = 0; y < size; ++y) {
+            for (std::uint32_t x = 0; x < size; ++x) {
+                const std::uint32_t i = y * (size + 1) + x;
+                sizes.push_back(4);
+                indices.insert(indices.end(), {i, i + 1, i + size + 2, i + size + 1});
+            }
+        }
+        return CHalfEdgeMesh::fromPolygons(vertices, sizes, indices);
+    }
+
+    CHalfEdgeMesh makeCube() {
+        std::vector<SVertex> vertices;
+        for (int i = 0; i < 8; ++i) vertices.push_back(vertexAt(float(i & 1), float((i >> 1) & 1), float(i >> 2)));
+        const std::vector<std::uint32_t> sizes(6, 4);
+        const std::vector<std::uint32_t> indices = {0, 2, 3, 1, 4, 5, 7, 6, 0, 1, 5, 4,
+                                                    2, 6, 7, 3, 0, 4, 6, 2, 1, 3, 7, 5};
+        return CHalfEdgeMesh::fromPolygons(vertices, sizes, indices);
+    }
+
+    // Triangle fan around vertex 0 with `gap` wedges missing, so the
+    // lowest outgoing half-edge of the centre lies on the boundary.
+    CHalfEdgeMesh makeFan(std::uint32_t spokes, std::uint32_t gap) {
+        std::vector<SVertex> vertices = {vertexAt(0.0f, 0.0f, 0.0f)};
+        for (std::uint32_t i = 0; i < spokes; ++i) {
+            const float angle = 6.28318531f * float(i) / float(spokes);
+            vertices.push_back(vertexAt(std::cos(angle), std::sin(angle), 0.0f));
+        }
+        std::vector<std::uint32_t> sizes, indices;
+        for (std::uint32_t i = 0; i + gap < spokes; ++i) {
+            sizes.push_back(3);
+            indices.insert(indices.end(), {0, 1 + i, 1 + (i + 1) % spokes});
+        }
+        return CHalfEdgeMesh::fromPolygons(vertices, sizes, indices);
+    }
+
+    // Number of mismatches between the traversal queries and a full scan.
+    std::size_t check(const char* name, const CHalfEdgeMesh& mesh) {
+        std::vector<std::set<std::uint32_t>> neighbours(mesh.vertexCount());
+        for (std::uint32_t h = 0; h < mesh.halfEdgeCount(); ++h) {
+            if (!mesh.isHalfEdgeValid(h)) continue;
+            neighbours[mesh.origin(h)].insert(mesh.target(h));
+            neighbours[mesh.target(h)].insert(mesh.origin(h));
+        }
+
+        std::size_t errors = 0;
+        for (std::uint32_t v = 0; v < mesh.vertexCount(); ++v) {
+            if (mesh.vertexHalfEdge(v) == INVALID_INDEX) continue;
+            if (mesh.valence(v) != neighbours[v].size()) {
+                if (errors++ < 8)
+                    std::printf("  %s: valence(%u) = %u, expected %zu\n", name, v, mesh.valence(v), neighbours[v].size());
+            }
+        }
+        for (std::uint32_t h = 0; h < mesh.halfEdgeCount(); ++h) {
+            if (!mesh.isHalfEdgeValid(h)) continue;
+            const std::uint32_t a = mesh.origin(h), b = mesh.target(h);
+            if (mesh.findHalfEdge(a, b) != h) {
+                if (errors++ < 8) std::printf("  %s: findHalfEdge(%u, %u) = %u, expected %u\n", name, a, b, mesh.findHalfEdge(a, b), h);
+            }
+            const std::uint32_t reverse = mesh.findHalfEdge(b, a);
+            if (mesh.twin(h) != reverse) {
+                if (errors++ < 8) std::printf("  %s: twin(%u) = %u, expected %u\n", name, h, mesh.twin(h), reverse);
+            }
+        }
+        std::printf("%-24s %8u vertices %8u half-edges  %s\n", name, mesh.vertexCount(), mesh.halfEdgeCount(),
+                    errors ? "FAILED" : "ok");
+        return errors;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::uint32_t size = argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 16;
+
+    std::size_t errors = 0;
+
+    const std::vector<SVertex> quad = {vertexAt(0, 0, 0), vertexAt(1, 0, 0), vertexAt(1, 1, 0), vertexAt(0, 1, 0)};
+    const std::vector<std::uint32_t> quadIndices = {0, 1, 2, 0, 2, 3};
+    const std::vector<std::uint32_t> quadSizes = {3, 3};
+    errors += check("open quad", CHalfEdgeMesh::fromPolygons(quad, quadSizes, quadIndices));
+
+    errors += check("closed fan", makeFan(6, 0));
+    errors += check("open fan", makeFan(6, 1));
+    errors += check("split fan", makeFan(8, 3));
+    errors += check("cube", makeCube());
+
+    CHalfEdgeMesh grid = makeGrid(size);
+    errors += check("grid", grid);
+
+    // Punch a hole and fill it again: addFace must find the open neighbours.
+    const std::uint32_t hole = (size / 2) * size + size / 2;
+    std::vector<std::uint32_t> corners;
+    grid.forEachFaceHalfEdge(hole, [&](std::uint32_t h) { corners.push_back(grid.origin(h)); });
+    grid.removeFace(hole);
+    errors += check("grid with hole", grid);
+    grid.addFace(corners);
+    errors += check("grid refilled", grid);
+
+    grid.extrudeFace(0, 1.0f);
+    grid.extrudeFace(size * size - 1, 1.0f);
+    errors += check("grid extruded", grid);
+
+    grid.compact();
+    errors += check("grid compacted", grid);
+
+    if (errors) {
+        std::printf("%zu mismatches\n", errors);
+        return 1;
+    }
+    return 0;
+}
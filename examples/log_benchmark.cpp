@@ -0,0 +1,83 @@
+// Cost of KLOG_* on the calling thread, filtered out and enabled, with the
+// records written to a file (or /dev/null) by the logger thread.
+//
+//   kinetica_log_benchmark [threads] [messagesPerThread] [output]
+
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Kinetica;
+
+namespace {
+
+    // Nanoseconds per message, averaged over all threads.
+    template<typename Fn>
+    double run(std::size_t threads, std::size_t messages, Fn&& body) {
+        std::vector<double> perThread(threads);
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                const auto start = std::chrono::steady_clock::now();
+                for (std::size_t i = 0; i < messages; ++i) body(i);
+                perThread[t] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            });
+        }
+        for (std::thread& worker : workers) worker.join();
+        double total = 0.0;
+        for (const double ns : perThread) total += ns;
+        return total / static_cast<double>(threads * messages);
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t threads = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4;
+    const std::size_t messages = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200000;
+#ifdef _WIN32
+    const std::string path = argc > 3 ? argv[3] : "NUL";
+#else
+    const std::string path = argc > 3 ? argv[3] : "/dev/null";
+#endif
+
+    std::FILE* output = std::fopen(path.c_str(), "wb");
+    if (!output) {
+        std::fprintf(stderr, "cannot open %s\n", path.c_str());
+        return 1;
+    }
+    Log::setOutput(output);
+
+    Log::setLevel(Log::ELogLevel::Warn);
+    const double filtered = run(threads, messages, [](std::size_t i) {
+        KLOG_DEBUG("filtered out " + std::to_string(i));
+    });
+
+    Log::setLevel(Log::ELogLevel::Debug);
+    const double literal = run(threads, messages, [](std::size_t) { KLOG_INFO("a literal message of moderate length"); });
+    Log::flush();
+    const Log::SLogStats afterLiteral = Log::stats();
+
+    // The caller builds the string; only the push is the logger's cost.
+    const double formatted = run(threads, messages, [](std::size_t i) {
+        KLOG_INFO("mesh " + std::to_string(i) + " uploaded");
+    });
+    Log::flush();
+    const Log::SLogStats stats = Log::stats();
+    Log::setOutput(stdout);
+    std::fclose(output);
+
+    std::printf("%zu threads x %zu messages\n", threads, messages);
+    std::printf("%-28s %8.1f ns/message\n", "filtered (debug at warn)", filtered);
+    std::printf("%-28s %8.1f ns/message\n", "enabled, literal", literal);
+    std::printf("%-28s %8.1f ns/message\n", "enabled, to_string + concat", formatted);
+    std::printf("written %llu, dropped %llu (literal run: %llu), blocked %llu\n",
+                static_cast<unsigned long long>(stats.written), static_cast<unsigned long long>(stats.dropped),
+                static_cast<unsigned long long>(afterLiteral.dropped), static_cast<unsigned long long>(stats.blocked));
+    return 0;
+}
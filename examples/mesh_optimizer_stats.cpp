@@ -0,0 +1,91 @@
+// ACMR, vertex counts and bytes before/after the mesh optimizer on synthetic
+// meshes: UV spheres emitted as unwelded triangle soup in shuffled order,
+// the worst case an importer can hand us.
+//
+//   kinetica_mesh_optimizer_stats [meshCount] [segments]
+
+#include <kinetica/geometry/mesh_optimizer.hpp>
+#include <kinetica/thread_pool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Kinetica;
+using Components::SIndex;
+using Components::SMesh;
+using Components::SVertex;
+
+static SMesh makeSoupSphere(std::uint32_t segments, std::mt19937& rng) {
+    const std::uint32_t rings = segments / 2;
+    auto vertexAt = [&](std::uint32_t ring, std::uint32_t segment) {
+        const float theta = 3.14159265f * float(ring) / float(rings);
+        const float phi = 6.28318531f * float(segment) / float(segments);
+        const glm::vec3 n(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+        return SVertex{n.x, n.y, n.z, n.x, n.y, n.z, float(segment) / float(segments), float(ring) / float(rings)};
+    };
+
+    std::vector<std::array<SVertex, 3>> triangles;
+    for (std::uint32_t r = 0; r < rings; ++r) {
+        for (std::uint32_t s = 0; s < segments; ++s) {
+            const SVertex a = vertexAt(r, s), b = vertexAt(r + 1, s);
+            const SVertex c = vertexAt(r + 1, s + 1), d = vertexAt(r, s + 1);
+            if (r > 0) triangles.push_back({a, c, b});
+            if (r + 1 < rings) triangles.push_back({a, d, c});
+        }
+    }
+    std::shuffle(triangles.begin(), triangles.end(), rng);
+
+    SMesh mesh;
+    for (const auto& t : triangles) {
+        const auto base = static_cast<std::uint32_t>(mesh.vertices.size());
+        mesh.vertices.insert(mesh.vertices.end(), t.begin(), t.end());
+        mesh.indices.push_back({base, base + 1, base + 2});
+    }
+    return mesh;
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16;
+    const std::uint32_t segments = argc > 2 ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 128;
+
+    std::mt19937 rng(11);
+    std::vector<SMesh> meshes;
+    std::vector<SMesh*> pointers;
+    for (std::size_t i = 0; i < count; ++i) meshes.push_back(makeSoupSphere(segments + std::uint32_t(i % 4) * 32, rng));
+    for (SMesh& mesh : meshes) pointers.push_back(&mesh);
+
+    CThreadPool pool;
+    std::vector<Geometry::SMeshOptimizeStats> stats;
+    const auto start = std::chrono::steady_clock::now();
+    Geometry::optimizeMeshes(pool, pointers, {}, &stats);
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    Geometry::SMeshOptimizeStats total;
+    double serialMs = 0.0;
+    for (const auto& s : stats) {
+        total.verticesBefore += s.verticesBefore;
+        total.verticesAfter += s.verticesAfter;
+        total.trianglesBefore += s.trianglesBefore;
+        total.trianglesAfter += s.trianglesAfter;
+        total.bytesBefore += s.bytesBefore;
+        total.bytesAfter += s.bytesAfter;
+        total.acmrBefore += s.acmrBefore * float(s.trianglesBefore);
+        total.acmrAfter += s.acmrAfter * float(s.trianglesAfter);
+        serialMs += s.milliseconds;
+    }
+
+    std::printf("%zu meshes, %u triangles, %zu threads\n", count, total.trianglesBefore, pool.threadCount());
+    std::printf("%-10s %12s %12s %8s %12s\n", "", "vertices", "triangles", "ACMR", "bytes");
+    std::printf("%-10s %12u %12u %8.3f %12zu\n", "before", total.verticesBefore, total.trianglesBefore,
+                double(total.acmrBefore) / std::max(total.trianglesBefore, 1u), total.bytesBefore);
+    std::printf("%-10s %12u %12u %8.3f %12zu\n", "after", total.verticesAfter, total.trianglesAfter,
+                double(total.acmrAfter) / std::max(total.trianglesAfter, 1u), total.bytesAfter);
+    std::printf("optimize: %.2f ms wall, %.2f ms summed over meshes\n", ms, serialMs);
+    return 0;
+}
@@ -0,0 +1,220 @@
+// Ray picking and box/lasso selection on a scene of bumpy spheres: lazy
+// BVH build cost, time per query, and a brute-force cross-check of pick,
+// box and lasso results against every triangle / vertex of the scene.
+//
+//   kinetica_picking_benchmark [meshCount] [segments] [picks]
+
+#include <kinetica/ecs/picking.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace Kinetica;
+using Components::SMesh;
+using Components::STransform;
+
+namespace {
+
+    // UV sphere with a ripple, so rays hit at varied depths and angles.
+    void makeSphere(SMesh& mesh, std::uint32_t segments) {
+        for (std::uint32_t i = 0; i <= segments; ++i) {
+            for (std::uint32_t j = 0; j <= segments; ++j) {
+                const float theta = 3.14159265f * float(i) / float(segments);
+                const float phi = 6.28318531f * float(j) / float(segments);
+                const float r = 1.0f + 0.05f * std::sin(13.0f * theta) * std::cos(7.0f * phi);
+                const glm::vec3 p(r * std::sin(theta) * std::cos(phi), r * std::cos(theta), r * std::sin(theta) * std::sin(phi));
+                mesh.vertices.push_back({p.x, p.y, p.z, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+            }
+        }
+        for (std::uint32_t i = 0; i < segments; ++i) {
+            for (std::uint32_t j = 0; j < segments; ++j) {
+                const std::uint32_t a = i * (segments + 1) + j, b = a + 1, c = a + segments + 1, d = c + 1;
+                mesh.indices.push_back({a, c, b});
+                mesh.indices.push_back({b, c, d});
+            }
+        }
+        mesh.markReplaced();
+        mesh.updateBounds();
+    }
+
+    glm::vec3 position(const SMesh& mesh, std::uint32_t index) {
+        const Components::SVertex& v = mesh.vertices[index];
+        return glm::vec3(v.x, v.y, v.z);
+    }
+
+    // Closest hit over every triangle of every mesh (Moeller-Trumbore).
+    bool bruteForcePick(CRegistry& registry, const CTransformHierarchy& hierarchy, const Math::SRay& ray,
+                        EntityID& entity, float& t) {
+        t = std::numeric_limits<float>::max();
+        entity = INVALID_ENTITY;
+        registry.view<SMesh>().each([&](EntityID e, SMesh& mesh) {
+            const Math::SRay local = ray.transformed(glm::inverse(*hierarchy.worldMatrix(e)));
+            for (const Components::SIndex& tri : mesh.indices) {
+                const glm::vec3 p0 = position(mesh, tri.a);
+                const glm::vec3 e1 = position(mesh, tri.b) - p0, e2 = position(mesh, tri.c) - p0;
+                const glm::vec3 pv = glm::cross(local.direction, e2);
+                const float det = glm::dot(e1, pv);
+                if (std::fabs(det) < 1e-12f) continue;
+                const float invDet = 1.0f / det;
+                const glm::vec3 s = local.origin - p0;
+                const float u = glm::dot(s, pv) * invDet;
+                if (u < 0.0f || u > 1.0f) continue;
+                const glm::vec3 q = glm::cross(s, e1);
+                const float v = glm::dot(local.direction, q) * invDet;
+                if (v < 0.0f || u + v > 1.0f) continue;
+                const float hit = glm::dot(e2, q) * invDet;
+                if (hit > 0.0f && hit < t) {
+                    t = hit;
+                    entity = e;
+                }
+            }
+        });
+        return entity.isValid();
+    }
+
+    bool insidePolygon(std::span<const glm::vec2> polygon, glm::vec2 p) {
+        bool inside = false;
+        for (std::size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+            const glm::vec2 a = polygon[i], b = polygon[j];
+            if ((a.y > p.y) != (b.y > p.y) && p.x < (b.x - a.x) * (p.y - a.y) / (b.y - a.y) + a.x) inside = !inside;
+        }
+        return inside;
+    }
+
+    // Entities with a vertex in front of the camera whose NDC position passes `inside`.
+    template<typename Inside>
+    std::vector<EntityID> bruteForceSelect(CRegistry& registry, const CTransformHierarchy& hierarchy,
+                                           const glm::mat4& viewProjection, Inside&& inside) {
+        std::vector<EntityID> out;
+        registry.view<SMesh>().each([&](EntityID e, SMesh& mesh) {
+            const glm::mat4 mvp = viewProjection * *hierarchy.worldMatrix(e);
+            for (std::uint32_t i = 0; i < mesh.vertices.size(); ++i) {
+                const glm::vec4 clip = mvp * glm::vec4(position(mesh, i), 1.0f);
+                if (clip.w > 0.0f && std::fabs(clip.z) <= clip.w && inside(glm::vec2(clip.x / clip.w, clip.y / clip.w))) {
+                    out.push_back(e);
+                    return;
+                }
+            }
+        });
+        return out;
+    }
+
+    bool contains(const std::vector<EntityID>& set, EntityID entity) {
+        return std::find(set.begin(), set.end(), entity) != set.end();
+    }
+
+    double millisecondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t meshCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20;
+    const auto segments = static_cast<std::uint32_t>(argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 223);
+    const std::size_t picks = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 2000;
+    const std::size_t checkedPicks = std::min<std::size_t>(picks, 200);
+
+    CRegistry registry;
+    CTransformHierarchy hierarchy(registry);
+    CSceneCulling culling(registry);
+    CPicking picking(registry, hierarchy, culling);
+
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<float> place(-20.0f, 20.0f);
+    std::size_t triangles = 0;
+    for (std::size_t i = 0; i < meshCount; ++i) {
+        const EntityID entity = registry.createEntity();
+        STransform& transform = registry.addComponent<STransform>(entity);
+        transform.position = glm::vec3(place(rng), place(rng), place(rng) * 0.2f);
+        transform.scale = glm::vec3(2.0f + float(i) * 0.1f);
+        transform.isDirty = true;
+        SMesh& mesh = registry.addComponent<SMesh>(entity);
+        makeSphere(mesh, segments);
+        triangles += mesh.indices.size();
+    }
+    hierarchy.update();
+    culling.update(hierarchy);
+
+    const glm::mat4 viewProjection = glm::perspective(1.0f, 1.0f, 0.1f, 200.0f) *
+        glm::lookAt(glm::vec3(0.0f, 0.0f, 60.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    std::printf("%zu meshes, %zu triangles\n", meshCount, triangles);
+
+    // Triangle BVHs are built on first use; build them all up front.
+    auto start = std::chrono::steady_clock::now();
+    registry.view<SMesh>().each([&](EntityID entity, SMesh&) { picking.meshBVH(entity); });
+    std::printf("%-22s %10.1f ms (%zu builds)\n", "lazy BVH build", millisecondsSince(start), picking.stats().builds);
+
+    std::uniform_real_distribution<float> ndc(-0.8f, 0.8f);
+    std::size_t hits = 0, mismatches = 0;
+    double pickMs = 0.0;
+    for (std::size_t k = 0; k < picks; ++k) {
+        const Math::SRay ray = Math::SRay::fromNdc(viewProjection, ndc(rng), ndc(rng));
+        SPickHit hit;
+        start = std::chrono::steady_clock::now();
+        const bool found = picking.pick(ray, hit);
+        pickMs += millisecondsSince(start);
+        hits += found;
+        if (k >= checkedPicks) continue;
+
+        EntityID expected;
+        float t;
+        const bool expectedFound = bruteForcePick(registry, hierarchy, ray, expected, t);
+        if (found != expectedFound || (found && (hit.entity != expected || std::fabs(hit.t - t) > 1e-5f * std::max(t, 1.0f))))
+            ++mismatches;
+    }
+    std::printf("%-22s %10.2f us (%zu/%zu hit, %zu/%zu differ from brute force)\n", "pick",
+                pickMs * 1000.0 / double(std::max<std::size_t>(picks, 1)), hits, picks, mismatches, checkedPicks);
+
+    // Box selection is conservative: it may add entities, never miss one.
+    const glm::vec2 boxMin(-0.3f, -0.3f), boxMax(0.3f, 0.3f);
+    std::vector<EntityID> selected;
+    start = std::chrono::steady_clock::now();
+    picking.selectBox(viewProjection, boxMin, boxMax, selected);
+    const double boxMs = millisecondsSince(start);
+    const std::vector<EntityID> boxExpected = bruteForceSelect(registry, hierarchy, viewProjection, [&](glm::vec2 p) {
+        return p.x >= boxMin.x && p.x <= boxMax.x && p.y >= boxMin.y && p.y <= boxMax.y;
+    });
+    std::size_t boxMissed = 0;
+    for (EntityID entity : boxExpected) boxMissed += !contains(selected, entity);
+    std::printf("%-22s %10.2f us (%zu entities, %zu by vertex, %zu missed)\n", "box select", boxMs * 1000.0,
+                selected.size(), boxExpected.size(), boxMissed);
+
+    // Lasso: vertex inside the polygon, or the entity under its first point.
+    const std::vector<glm::vec2> lasso = {{-0.3f, -0.3f}, {0.3f, -0.3f}, {0.35f, 0.2f}, {0.0f, 0.4f}, {-0.2f, 0.1f}};
+    start = std::chrono::steady_clock::now();
+    picking.selectLasso(viewProjection, lasso, selected);
+    const double lassoMs = millisecondsSince(start);
+    std::vector<EntityID> lassoExpected = bruteForceSelect(registry, hierarchy, viewProjection,
+                                                           [&](glm::vec2 p) { return insidePolygon(lasso, p); });
+    EntityID anchor;
+    float anchorT;
+    if (bruteForcePick(registry, hierarchy, Math::SRay::fromNdc(viewProjection, lasso[0].x, lasso[0].y), anchor, anchorT) &&
+        !contains(lassoExpected, anchor))
+        lassoExpected.push_back(anchor);
+    std::size_t lassoDiffer = 0;
+    for (EntityID entity : lassoExpected) lassoDiffer += !contains(selected, entity);
+    for (EntityID entity : selected) lassoDiffer += !contains(lassoExpected, entity);
+    std::printf("%-22s %10.2f us (%zu entities, %zu differ from brute force)\n", "lasso select", lassoMs * 1000.0,
+                selected.size(), lassoDiffer);
+
+    // A vertex edit refits the touched BVHs instead of rebuilding them.
+    registry.view<SMesh>().each([](SMesh& mesh) {
+        mesh.vertices[0].x += 0.1f;
+        mesh.markVerticesDirty(0);
+    });
+    start = std::chrono::steady_clock::now();
+    registry.view<SMesh>().each([&](EntityID entity, SMesh&) { picking.meshBVH(entity); });
+    std::printf("%-22s %10.1f ms (%zu refits)\n", "refit after edit", millisecondsSince(start), picking.stats().refits);
+
+    return (mismatches || boxMissed || lassoDiffer) ? 1 : 0;
+}
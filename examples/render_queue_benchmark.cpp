@@ -0,0 +1,124 @@
+// Render queue cost vs the state changes it saves: builds a queue for a
+// synthetic scene serially and in parallel, radix-sorts it, and counts
+// program / material / mesh changes in submission vs sorted order.
+//
+//   kinetica_render_queue_benchmark [entityCount] [meshCount] [materialCount]
+
+#include <kinetica/rendering/render_queue.hpp>
+#include <kinetica/thread_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Kinetica;
+
+namespace {
+
+    struct SStateChanges {
+        std::size_t programs = 0;
+        std::size_t materials = 0;
+        std::size_t meshes = 0;
+    };
+
+    template<typename Get>
+    SStateChanges countChanges(std::size_t count, Get&& get) {
+        SStateChanges changes;
+        std::uint32_t program = ~0u, mesh = ~0u;
+        const Components::SMaterial* material = nullptr;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto [p, cmd] = get(i);
+            if (p != program) { ++changes.programs; program = p; material = nullptr; }
+            if (cmd->material != material) { ++changes.materials; material = cmd->material; }
+            if (cmd->geometry != mesh) { ++changes.meshes; mesh = cmd->geometry; }
+        }
+        return changes;
+    }
+
+    double elapsedMs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    const std::uint32_t meshes = argc > 2 ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 64;
+    const std::uint32_t materialCount = argc > 3 ? static_cast<std::uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 32;
+    constexpr std::uint32_t shaders = 2;
+
+    std::mt19937 rng(11);
+    std::vector<Components::SMaterial> materials(materialCount);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    for (auto& m : materials) m.baseColor = glm::vec3(unit(rng), unit(rng), unit(rng));
+
+    struct SEntity {
+        std::uint32_t shader, mesh, material;
+        float depth;
+    };
+    std::vector<SEntity> scene(count);
+    for (SEntity& e : scene) {
+        e.shader = rng() % shaders;
+        e.mesh = rng() % meshes;
+        e.material = rng() % materialCount;
+        e.depth = unit(rng) * 500.0f;
+    }
+
+    auto makeCommand = [&](const SEntity& e) {
+        return SRenderCommand{glm::mat4(1.0f), e.mesh, 36, 24, &materials[e.material]};
+    };
+    auto makeKey = [&](const SEntity& e) {
+        return DrawKey::make(0, e.shader, DrawKey::materialHash(materials[e.material]), e.mesh,
+                             DrawKey::depthBucket(e.depth));
+    };
+
+    CRenderQueue queue;
+    CThreadPool pool;
+
+    // Serial build + sort.
+    auto start = std::chrono::steady_clock::now();
+    for (const SEntity& e : scene) queue.push(makeKey(e), makeCommand(e));
+    const double serialBuild = elapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    queue.sort();
+    const double sortMs = elapsedMs(start);
+    queue.clear();
+
+    // Parallel build (buffers are warm now, as they are from the second frame on).
+    start = std::chrono::steady_clock::now();
+    pool.parallelFor(count, 4096, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) queue.push(makeKey(scene[i]), makeCommand(scene[i]));
+    });
+    const double parallelBuild = elapsedMs(start);
+    start = std::chrono::steady_clock::now();
+    queue.sort();
+    const double parallelSort = elapsedMs(start);
+
+    // std::sort on the same keys, for reference.
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> keys(count);
+    for (std::size_t i = 0; i < count; ++i) keys[i] = {makeKey(scene[i]), static_cast<std::uint32_t>(i)};
+    start = std::chrono::steady_clock::now();
+    std::sort(keys.begin(), keys.end());
+    const double stdSort = elapsedMs(start);
+
+    std::vector<SRenderCommand> unsortedCommands(count);
+    for (std::size_t i = 0; i < count; ++i) unsortedCommands[i] = makeCommand(scene[i]);
+    const SStateChanges unsorted = countChanges(count, [&](std::size_t i) {
+        return std::pair{scene[i].shader, &unsortedCommands[i]};
+    });
+    const SStateChanges sorted = countChanges(queue.size(), [&](std::size_t i) {
+        return std::pair{static_cast<std::uint32_t>(queue.key(i) >> DrawKey::SHADER_SHIFT) & 0xFF, &queue.command(i)};
+    });
+
+    std::printf("%zu entities, %u shaders, %u meshes, %u materials, %zu worker threads\n",
+                count, shaders, meshes, materialCount, pool.threadCount());
+    std::printf("build serial %.2f ms, parallel %.2f ms\n", serialBuild, parallelBuild);
+    std::printf("radix sort %.2f ms (after parallel build %.2f ms), std::sort %.2f ms\n", sortMs, parallelSort, stdSort);
+    std::printf("%-10s %10s %10s %10s\n", "order", "programs", "materials", "meshes");
+    std::printf("%-10s %10zu %10zu %10zu\n", "unsorted", unsorted.programs, unsorted.materials, unsorted.meshes);
+    std::printf("%-10s %10zu %10zu %10zu\n", "sorted", sorted.programs, sorted.materials, sorted.meshes);
+    return 0;
+}
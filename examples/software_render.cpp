@@ -0,0 +1,134 @@
+// CPU rasterizer timing and golden-image check on a synthetic scene: a grid
+// of spheres over a UV-shaded floor that crosses the near plane.
+//
+//   kinetica_software_render [triangles] [size] [out.png|out.ppm] [golden.ppm]
+//
+// With a golden image, exits non-zero when more than 0.1% of the pixels
+// differ by more than 2 in any channel.
+
+#include <kinetica/rendering/image_io.hpp>
+#include <kinetica/rendering/software_renderer.hpp>
+#include <kinetica/thread_pool.hpp>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Kinetica;
+using Components::SMaterial;
+using Components::SMesh;
+
+namespace {
+
+    SMesh makeSphere(std::uint32_t rings) {
+        const std::uint32_t segments = rings * 2;
+        SMesh mesh;
+        for (std::uint32_t i = 0; i <= rings; ++i) {
+            const float theta = 3.14159265f * static_cast<float>(i) / static_cast<float>(rings);
+            for (std::uint32_t j = 0; j <= segments; ++j) {
+                const float phi = 6.28318531f * static_cast<float>(j) / static_cast<float>(segments);
+                const float x = std::sin(theta) * std::cos(phi), y = std::cos(theta), z = std::sin(theta) * std::sin(phi);
+                mesh.vertices.push_back({x, y, z, x, y, z, static_cast<float>(j) / static_cast<float>(segments),
+                                         static_cast<float>(i) / static_cast<float>(rings)});
+            }
+        }
+        for (std::uint32_t i = 0; i < rings; ++i) {
+            for (std::uint32_t j = 0; j < segments; ++j) {
+                const std::uint32_t a = i * (segments + 1) + j, b = a + 1, c = a + segments + 1, d = c + 1;
+                mesh.indices.push_back({a, b, c});
+                mesh.indices.push_back({b, d, c});
+            }
+        }
+        return mesh;
+    }
+
+    double render(CSoftwareRenderer& renderer, const std::vector<glm::mat4>& models, const SMesh& sphere,
+                  const SMesh& floor) {
+        SMaterial floorMaterial;
+        floorMaterial.useVertexColor = true;
+        SMaterial sphereMaterial;
+        sphereMaterial.baseColor = glm::vec3(0.9f, 0.35f, 0.2f);
+
+        const auto start = std::chrono::steady_clock::now();
+        renderer.clear();
+        renderer.submit(glm::mat4(1.0f), floor, floorMaterial);
+        for (const glm::mat4& model : models) renderer.submit(model, sphere, sphereMaterial);
+        renderer.flushBatches();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t triangles = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 250000;
+    const std::uint32_t size = argc > 2 ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 512;
+    const std::string output = argc > 3 ? argv[3] : "software_render.png";
+    const std::string golden = argc > 4 ? argv[4] : "";
+
+    // 3x3 spheres share the triangle budget.
+    const auto rings = static_cast<std::uint32_t>(std::max(2.0, std::sqrt(static_cast<double>(triangles) / 36.0)));
+    const SMesh sphere = makeSphere(rings);
+    SMesh floor;
+    floor.vertices = {{-50, -1, -50, 0, 1, 0, 0, 0}, {50, -1, -50, 0, 1, 0, 1, 0},
+                      {50, -1, 50, 0, 1, 0, 1, 1},   {-50, -1, 50, 0, 1, 0, 0, 1}};
+    floor.indices = {{0, 2, 1}, {0, 3, 2}};
+
+    std::vector<glm::mat4> models;
+    for (int z = -1; z <= 1; ++z)
+        for (int x = -1; x <= 1; ++x)
+            models.push_back(glm::translate(glm::mat4(1.0f), glm::vec3(2.5f * static_cast<float>(x), 0.0f,
+                                                                       2.5f * static_cast<float>(z))));
+
+    const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 3.0f, 7.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 100.0f);
+
+    std::printf("%zu triangles, %ux%u\n", sphere.indices.size() * models.size() + floor.indices.size(), size, size);
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1;; threads = std::min(threads * 2, hardware)) {
+        CThreadPool pool(threads);
+        CSoftwareRenderer renderer(size, size, &pool);
+        renderer.setViewProjection(view, projection);
+        render(renderer, models, sphere, floor); // warm-up
+        double best = 1e30;
+        for (int i = 0; i < 5; ++i) best = std::min(best, render(renderer, models, sphere, floor));
+        std::printf("%2zu threads: %8.2f ms  (%u triangles rasterized)\n", threads, best,
+                    renderer.stats().trianglesRasterized);
+        if (threads == hardware) break;
+    }
+
+    CSoftwareRenderer renderer(size, size);
+    renderer.setViewProjection(view, projection);
+    render(renderer, models, sphere, floor);
+    if (!renderer.writeImage(output)) {
+        std::fprintf(stderr, "failed to write %s\n", output.c_str());
+        return 1;
+    }
+    std::printf("wrote %s\n", output.c_str());
+    if (golden.empty()) return 0;
+
+    std::uint32_t width = 0, height = 0;
+    std::vector<std::uint8_t> expected;
+    if (!readPPM(golden, width, height, expected) || width != size || height != size) {
+        std::fprintf(stderr, "cannot compare against %s\n", golden.c_str());
+        return 1;
+    }
+    const std::vector<std::uint8_t> actual = renderer.readPixels();
+    std::size_t mismatched = 0;
+    for (std::size_t i = 0; i < std::size_t(width) * height; ++i) {
+        int diff = 0;
+        for (std::size_t c = 0; c < 3; ++c)
+            diff = std::max(diff, std::abs(int(actual[i * 4 + c]) - int(expected[i * 3 + c])));
+        mismatched += diff > 2;
+    }
+    const bool pass = mismatched * 1000 <= std::size_t(width) * height;
+    std::printf("%s: %zu of %u pixels differ from %s\n", pass ? "match" : "MISMATCH", mismatched, width * height,
+                golden.c_str());
+    return pass ? 0 : 2;
+}
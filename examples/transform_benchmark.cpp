@@ -0,0 +1,64 @@
+// Measures local matrix composition for many transforms, e.g. after a
+// multi-select rotate, and checks the batch kernels against getMatrix().
+//
+//   kinetica_transform_benchmark [transformCount]
+
+#include <kinetica/ecs/components/transform.hpp>
+#include <kinetica/math/transform_batch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Kinetica;
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+    std::vector<Components::STransform> transforms(count);
+    Math::STransformSoABuffer soa;
+    soa.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& t = transforms[i];
+        t.position = glm::vec3(dist(rng), dist(rng), dist(rng));
+        t.rotation = glm::vec3(dist(rng), dist(rng), dist(rng));
+        t.scale = glm::vec3(dist(rng), dist(rng), dist(rng));
+        soa.set(i, t);
+    }
+
+    auto elapsedMs = [](auto start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& t : transforms) t.getMatrix();
+    std::printf("%-10s %10.2f ms\n", "getMatrix", elapsedMs(start));
+
+    std::vector<glm::mat4> out(count);
+    for (Math::ESimdLevel level : { Math::ESimdLevel::Scalar, Math::ESimdLevel::SSE2, Math::ESimdLevel::AVX2 }) {
+        if (level > Math::activeSimdLevel()) continue;
+
+        start = std::chrono::steady_clock::now();
+        Math::composeTRS(soa.view(), out.data(), count, level);
+        const double ms = elapsedMs(start);
+
+        float maxError = 0.0f;
+        for (std::size_t i = 0; i < count; ++i) {
+            const glm::mat4& reference = transforms[i].matrix;
+            for (int c = 0; c < 4; ++c) {
+                for (int r = 0; r < 4; ++r) {
+                    maxError = std::max(maxError, std::fabs(reference[c][r] - out[i][c][r]));
+                }
+            }
+        }
+        std::printf("%-10s %10.2f ms   max abs error %.3g\n", Math::simdLevelName(level), ms, static_cast<double>(maxError));
+    }
+    return 0;
+}
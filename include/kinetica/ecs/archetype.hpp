@@ -0,0 +1,140 @@
+#ifndef KINETICA_ECS_ARCHETYPE_HPP
+#define KINETICA_ECS_ARCHETYPE_HPP
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <map>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+#include "entity.hpp"
+#include "component_type.hpp"
+
+namespace Kinetica {
+
+    // All entities that own exactly the same set of component types.
+    // They are stored in fixed-size chunks, each chunk laid out as SoA:
+    // [entities[N]][column0[N]][column1[N]]..., so a query over an archetype
+    // streams linearly through memory. Rows are kept dense (swap-and-pop).
+    class CArchetype {
+    public:
+        static constexpr std::size_t CHUNK_BYTES = 16 * 1024;
+        static constexpr std::size_t CHUNK_ALIGN = 64;
+
+        CArchetype(std::vector<std::uint32_t> signature, std::vector<const SComponentInfo*> infos);
+        ~CArchetype();
+
+        CArchetype(const CArchetype&) = delete;
+        CArchetype& operator=(const CArchetype&) = delete;
+
+        const std::vector<std::uint32_t>& signature() const { return m_signature; }
+        std::uint32_t size() const { return m_count; }
+        std::uint32_t chunkCapacity() const { return m_chunkCapacity; }
+        std::size_t chunkCount() const { return (m_count + m_chunkCapacity - 1) / m_chunkCapacity; }
+        std::uint32_t chunkSize(std::size_t chunk) const;
+
+        // Column index of a component type, or -1 if the archetype lacks it.
+        int column(std::uint32_t typeId) const {
+            return typeId < m_columnOf.size() ? m_columnOf[typeId] : -1;
+        }
+        bool hasAll(const std::vector<std::uint32_t>& sortedTypes) const;
+
+        SEntityHandle* entities(std::size_t chunk) {
+            return reinterpret_cast<SEntityHandle*>(m_chunks[chunk].get());
+        }
+        void* columnData(std::size_t chunk, int column) {
+            return m_chunks[chunk].get() + m_columnOffsets[column];
+        }
+        void* component(std::uint32_t row, int column) {
+            return static_cast<std::byte*>(columnData(row / m_chunkCapacity, column))
+                 + (row % m_chunkCapacity) * m_infos[column]->size;
+        }
+        SEntityHandle entityAt(std::uint32_t row) {
+            return entities(row / m_chunkCapacity)[row % m_chunkCapacity];
+        }
+
+        // Appends a row for `entity`; component columns are left unconstructed.
+        std::uint32_t pushEntity(SEntityHandle entity);
+
+        // Destroys the row's components and moves the last row into its place.
+        // Returns the entity that now occupies `row`, or an invalid handle if none moved.
+        SEntityHandle swapRemove(std::uint32_t row);
+
+        // Cached archetype graph edges (component type -> target archetype index).
+        std::unordered_map<std::uint32_t, std::uint32_t> addEdges;
+        std::unordered_map<std::uint32_t, std::uint32_t> removeEdges;
+
+    private:
+        struct SChunkDeleter {
+            void operator()(std::byte* p) const { ::operator delete[](p, std::align_val_t(CHUNK_ALIGN)); }
+        };
+        using ChunkPtr = std::unique_ptr<std::byte[], SChunkDeleter>;
+
+        const SComponentInfo& info(int column) const { return *m_infos[column]; }
+
+        std::vector<std::uint32_t> m_signature;
+        std::vector<const SComponentInfo*> m_infos;
+        std::vector<int> m_columnOf;
+        std::vector<std::size_t> m_columnOffsets;
+        std::size_t m_chunkBytes = CHUNK_BYTES;
+        std::uint32_t m_chunkCapacity = 0;
+        std::uint32_t m_count = 0;
+        std::vector<ChunkPtr> m_chunks;
+    };
+
+    // Archetype storage backend for CRegistry (EStorageMode::Archetype).
+    // Adding or removing a component moves the entity to the archetype of its
+    // new component set; transitions are cached on the archetypes.
+    class CArchetypeStorage {
+    public:
+        CArchetypeStorage() = default;
+
+        CArchetypeStorage(const CArchetypeStorage&) = delete;
+        CArchetypeStorage& operator=(const CArchetypeStorage&) = delete;
+
+        void* add(SEntityHandle entity, std::uint32_t typeId, const SComponentInfo& info);
+        void remove(SEntityHandle entity, std::uint32_t typeId);
+        void* get(SEntityHandle entity, std::uint32_t typeId);
+        bool has(SEntityHandle entity, std::uint32_t typeId) const;
+        void destroy(SEntityHandle entity);
+
+        // Indices of all archetypes that contain every type of `sortedTypes`.
+        // The result is cached and kept up to date as archetypes are created.
+        // Safe to call from concurrently running systems.
+        const std::vector<std::uint32_t>& query(const std::uint32_t* sortedTypes, std::size_t count);
+
+        CArchetype& archetype(std::uint32_t index) { return *m_archetypes[index]; }
+        std::size_t archetypeCount() const { return m_archetypes.size(); }
+
+    private:
+        static constexpr std::uint32_t NO_ARCHETYPE = 0xFFFFFFFFu;
+
+        struct SLocation {
+            std::uint32_t archetype = NO_ARCHETYPE;
+            std::uint32_t row = 0;
+        };
+
+        struct SQuery {
+            std::vector<std::uint32_t> types;
+            std::vector<std::uint32_t> archetypes;
+        };
+
+        const SLocation* locate(SEntityHandle entity) const;
+        std::uint32_t findOrCreateArchetype(const std::vector<std::uint32_t>& signature);
+        std::uint32_t transition(std::uint32_t from, std::uint32_t typeId, bool add);
+        void moveEntity(SEntityHandle entity, std::uint32_t target, std::uint32_t constructType);
+        void removeRow(std::uint32_t archetype, std::uint32_t row);
+
+        std::vector<SLocation> m_locations;  // entity index -> location
+        std::vector<std::unique_ptr<CArchetype>> m_archetypes;
+        std::map<std::vector<std::uint32_t>, std::uint32_t> m_archetypeIndex;
+        std::vector<const SComponentInfo*> m_infos;  // component type id -> info
+        std::unordered_map<std::uint64_t, std::vector<std::unique_ptr<SQuery>>> m_queries;
+        std::mutex m_queryMutex;
+    };
+
+} // namespace Kinetica
+
+#endif
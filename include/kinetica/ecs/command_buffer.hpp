@@ -0,0 +1,167 @@
+#ifndef KINETICA_ECS_COMMAND_BUFFER_HPP
+#define KINETICA_ECS_COMMAND_BUFFER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "registry.hpp"
+
+namespace Kinetica {
+
+    // Entity spawned by a command buffer that does not exist until the buffer is
+    // flushed. Only meaningful to the buffer that returned it.
+    struct SDeferredEntity {
+        std::uint32_t spawnIndex = 0xFFFFFFFFu;
+    };
+
+    // Records structural registry changes without touching the registry, so it can
+    // be filled from worker threads or while views are being iterated. Changes are
+    // applied in one batch by flush() (or CCommandQueue::flush), in this order:
+    //   1. spawned entities are created,
+    //   2. added components, grouped by type and sorted by entity index,
+    //   3. removed components,
+    //   4. destroyed entities.
+    // A buffer is not thread-safe itself; use one per thread (see CCommandQueue).
+    class CCommandBuffer {
+    public:
+        CCommandBuffer() = default;
+        CCommandBuffer(const CCommandBuffer&) = delete;
+        CCommandBuffer& operator=(const CCommandBuffer&) = delete;
+
+        SDeferredEntity spawn() { return SDeferredEntity{ m_spawnCount++ }; }
+
+        template<typename... Ts>
+        SDeferredEntity spawn(Ts&&... components) {
+            const SDeferredEntity entity = spawn();
+            (add(entity, std::forward<Ts>(components)), ...);
+            return entity;
+        }
+
+        void destroy(EntityID entity) { m_destroys.push_back(entity); }
+
+        template<typename T>
+        void add(EntityID entity, T component) {
+            addList<T>().entries.emplace_back(STarget{ entity, NO_SPAWN }, std::move(component));
+        }
+
+        template<typename T>
+        void add(SDeferredEntity entity, T component) {
+            addList<T>().entries.emplace_back(STarget{ INVALID_ENTITY, entity.spawnIndex }, std::move(component));
+        }
+
+        template<typename T>
+        void remove(EntityID entity) {
+            m_removes.push_back({ entity, componentTypeId<T>(),
+                                  [](CRegistry& registry, EntityID e) { registry.removeComponent<T>(e); } });
+        }
+
+        bool empty() const;
+        void clear();
+
+        // Applies and clears this buffer alone.
+        void flush(CRegistry& registry);
+
+    private:
+        friend class CCommandQueue;
+
+        static constexpr std::uint32_t NO_SPAWN = 0xFFFFFFFFu;
+
+        struct STarget {
+            EntityID entity;
+            std::uint32_t spawnIndex;
+        };
+
+        struct IAddList {
+            virtual ~IAddList() = default;
+            virtual void resolve(const std::vector<EntityID>& spawned) = 0;
+            virtual void absorb(IAddList& other) = 0;
+            virtual void apply(CRegistry& registry) = 0;
+            virtual bool empty() const = 0;
+            virtual void clear() = 0;
+        };
+
+        template<typename T>
+        struct AddList : public IAddList {
+            std::vector<std::pair<STarget, T>> entries;
+
+            void resolve(const std::vector<EntityID>& spawned) override {
+                for (auto& entry : entries) {
+                    if (entry.first.spawnIndex != NO_SPAWN) entry.first.entity = spawned[entry.first.spawnIndex];
+                }
+            }
+
+            void absorb(IAddList& other) override {
+                auto& source = static_cast<AddList<T>&>(other).entries;
+                entries.insert(entries.end(), std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+                source.clear();
+            }
+
+            void apply(CRegistry& registry) override {
+                // Insert in entity order so sparse pages and pools are filled front to back.
+                std::stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+                    return a.first.entity.index < b.first.entity.index;
+                });
+                registry.reserveComponents<T>(entries.size());
+                for (auto& [target, component] : entries) {
+                    if (registry.isAlive(target.entity)) {
+                        registry.addComponent<T>(target.entity) = std::move(component);
+                    }
+                }
+                entries.clear();
+            }
+
+            bool empty() const override { return entries.empty(); }
+            void clear() override { entries.clear(); }
+        };
+
+        struct SRemove {
+            EntityID entity;
+            std::uint32_t typeId;
+            void (*apply)(CRegistry& registry, EntityID entity);
+        };
+
+        template<typename T>
+        AddList<T>& addList() {
+            const std::uint32_t typeId = componentTypeId<T>();
+            if (typeId >= m_adds.size()) m_adds.resize(typeId + 1);
+            if (!m_adds[typeId]) m_adds[typeId] = std::make_unique<AddList<T>>();
+            return static_cast<AddList<T>&>(*m_adds[typeId]);
+        }
+
+        static void applyAll(CRegistry& registry, CCommandBuffer* const* buffers, std::size_t count);
+
+        std::uint32_t m_spawnCount = 0;
+        std::vector<std::unique_ptr<IAddList>> m_adds;  // indexed by component type id
+        std::vector<SRemove> m_removes;
+        std::vector<EntityID> m_destroys;
+    };
+
+    // Hands out one CCommandBuffer per thread and applies all of them at a single
+    // flush point. Recording needs no lock; a mutex is only taken the first time a
+    // thread asks for its buffer. flush() must not run concurrently with recording.
+    class CCommandQueue {
+    public:
+        CCommandQueue();
+        CCommandQueue(const CCommandQueue&) = delete;
+        CCommandQueue& operator=(const CCommandQueue&) = delete;
+
+        // The calling thread's buffer.
+        CCommandBuffer& local();
+
+        void flush(CRegistry& registry);
+
+    private:
+        std::uint64_t m_id;
+        std::mutex m_mutex;
+        std::unordered_map<std::thread::id, std::unique_ptr<CCommandBuffer>> m_buffers;
+    };
+
+} // namespace Kinetica
+
+#endif
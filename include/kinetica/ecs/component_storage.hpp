@@ -0,0 +1,95 @@
+#ifndef KINETICA_ECS_COMPONENT_STORAGE_HPP
+#define KINETICA_ECS_COMPONENT_STORAGE_HPP
+
+#include <vector>
+#include <array>
+#include <memory>
+#include <cstdint>
+
+#include "entity.hpp"
+
+namespace Kinetica {
+
+    constexpr std::uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+
+    struct IComponentStorage {
+        virtual ~IComponentStorage() = default;
+        virtual void erase(SEntityHandle id) = 0;
+        virtual void* get(SEntityHandle id) = 0;
+        virtual std::size_t size() const = 0;
+    };
+
+    // Sparse set: components and their owners are packed contiguously in
+    // `components`/`entities`, `sparse` maps an entity index to its dense slot
+    // through fixed-size pages. Removal swaps the last element into the hole,
+    // so everything is O(1). The version stored in `entities` rejects stale handles.
+    template<typename T>
+    struct ComponentStorage : public IComponentStorage {
+        static constexpr std::size_t PAGE_SIZE = 4096;
+        using Page = std::array<std::uint32_t, PAGE_SIZE>;
+
+        std::vector<T> components;
+        std::vector<SEntityHandle> entities;
+        std::vector<std::unique_ptr<Page>> sparse;
+
+        std::size_t size() const override { return components.size(); }
+
+        std::uint32_t slotOf(SEntityHandle id) const {
+            const std::size_t page = id.index / PAGE_SIZE;
+            if (page >= sparse.size() || !sparse[page]) return INVALID_SLOT;
+            const std::uint32_t slot = (*sparse[page])[id.index % PAGE_SIZE];
+            return (slot != INVALID_SLOT && entities[slot] == id) ? slot : INVALID_SLOT;
+        }
+
+        std::uint32_t& sparseEntry(std::uint32_t index) {
+            const std::size_t page = index / PAGE_SIZE;
+            if (page >= sparse.size()) sparse.resize(page + 1);
+            if (!sparse[page]) {
+                sparse[page] = std::make_unique<Page>();
+                sparse[page]->fill(INVALID_SLOT);
+            }
+            return (*sparse[page])[index % PAGE_SIZE];
+        }
+
+        T* find(SEntityHandle id) {
+            const std::uint32_t slot = slotOf(id);
+            return (slot != INVALID_SLOT) ? &components[slot] : nullptr;
+        }
+
+        void* get(SEntityHandle id) override { return find(id); }
+
+        bool contains(SEntityHandle id) const {
+            return slotOf(id) != INVALID_SLOT;
+        }
+
+        T& emplace(SEntityHandle id) {
+            std::uint32_t& entry = sparseEntry(id.index);
+            if (entry != INVALID_SLOT) {
+                if (entities[entry] == id) return components[entry];
+                // Left behind by a destroyed entity that reused this index.
+                erase(entities[entry]);
+            }
+            entry = static_cast<std::uint32_t>(components.size());
+            entities.push_back(id);
+            return components.emplace_back();
+        }
+
+        void erase(SEntityHandle id) override {
+            const std::uint32_t slot = slotOf(id);
+            if (slot == INVALID_SLOT) return;
+
+            const std::uint32_t last = static_cast<std::uint32_t>(components.size() - 1);
+            if (slot != last) {
+                components[slot] = std::move(components[last]);
+                entities[slot] = entities[last];
+                sparseEntry(entities[slot].index) = slot;
+            }
+            components.pop_back();
+            entities.pop_back();
+            sparseEntry(id.index) = INVALID_SLOT;
+        }
+    };
+
+} // namespace Kinetica
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef KINETICA_ECS_COMPONENT_TYPE_HPP
+#define KINETICA_ECS_COMPONENT_TYPE_HPP
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+#include <utility>
+
+namespace Kinetica {
+
+    // Upper bound of distinct component types in one process (host + plugins).
+    constexpr std::size_t MAX_COMPONENT_TYPES = 128;
+
+    // One bit per component type id; CRegistry keeps one mask per entity.
+    using ComponentMask = std::bitset<MAX_COMPONENT_TYPES>;
+
+    // Type-erased lifetime operations, used by storages that keep components
+    // of several types in raw memory (archetype chunks).
+    struct SComponentInfo {
+        std::size_t size = 0;
+        std::size_t align = 0;
+        void (*construct)(void* dst) = nullptr;
+        void (*moveConstruct)(void* dst, void* src) = nullptr;
+        void (*destroy)(void* ptr) = nullptr;
+    };
+
+    // Assigns (or returns the already assigned) dense id for a component type name.
+    // Ids are keyed by name rather than by template instance so that a plugin
+    // module, which has its own copy of componentTypeId<T>(), resolves the same
+    // id as the host. Plugins can also call this directly to reserve ids for
+    // types they define at runtime.
+    std::uint32_t registerComponentType(std::string_view name, const SComponentInfo& info);
+
+    std::uint32_t componentTypeCount();
+    const SComponentInfo* componentTypeInfo(std::uint32_t id);
+    std::string_view componentTypeName(std::uint32_t id);
+
+    namespace Detail {
+        // Stable, compiler-provided name of T (e.g. "Kinetica::Components::SMesh").
+        template<typename T>
+        constexpr std::string_view typeName() {
+        #if defined(_MSC_VER) && !defined(__clang__)
+            constexpr std::string_view signature = __FUNCSIG__;
+            constexpr std::string_view prefix = "typeName<";
+            constexpr std::size_t begin = signature.find(prefix) + prefix.size();
+            constexpr std::size_t end = signature.rfind(">(void)");
+        #else
+            // "... [with T = Foo; ...]" (GCC) or "... [T = Foo]" (Clang)
+            constexpr std::string_view signature = __PRETTY_FUNCTION__;
+            constexpr std::string_view prefix = "T = ";
+            constexpr std::size_t begin = signature.find(prefix) + prefix.size();
+            constexpr std::size_t end = signature.find_first_of(";]", begin);
+        #endif
+            return signature.substr(begin, end - begin);
+        }
+    }
+
+    template<typename T>
+    const SComponentInfo& componentInfo() {
+        static const SComponentInfo info{
+            sizeof(T),
+            alignof(T),
+            [](void* dst) { new (dst) T(); },
+            [](void* dst, void* src) { new (dst) T(std::move(*static_cast<T*>(src))); },
+            [](void* ptr) { static_cast<T*>(ptr)->~T(); },
+        };
+        return info;
+    }
+
+    // Dense id of a component type, resolved once per module and then read
+    // from a template static, so storages are found by direct array indexing.
+    template<typename T>
+    std::uint32_t componentTypeId() {
+        static const std::uint32_t id = registerComponentType(Detail::typeName<T>(), componentInfo<T>());
+        return id;
+    }
+
+    template<typename... Ts>
+    ComponentMask componentMask() {
+        ComponentMask mask;
+        (mask.set(componentTypeId<Ts>()), ...);
+        return mask;
+    }
+
+} // namespace Kinetica
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef KINETICA_COMPONENTS_HIERARCHY_HPP
+#define KINETICA_COMPONENTS_HIERARCHY_HPP
+
+#include "../entity.hpp"
+
+namespace Kinetica::Components {
+
+    // Parent/child links as an intrusive list of siblings. Edit through
+    // CTransformHierarchy::setParent so both ends stay consistent.
+    struct SHierarchy {
+        SEntityHandle parent;
+        SEntityHandle firstChild;
+        SEntityHandle prevSibling;
+        SEntityHandle nextSibling;
+    };
+
+} // namespace Kinetica::Components
+
+#endif
@@ -1,10 +1,17 @@
 #ifndef KINETICA_COMPONENTS_MESH_HPP
 #define KINETICA_COMPONENTS_MESH_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <utility>
 #include <vector>
 #include <cstdint>
 #include <GL/glew.h>
 
+#include "../../math/bounds.hpp"
+
 namespace Kinetica::Components {
 
     struct SVertex {
@@ -17,19 +24,171 @@ namespace Kinetica::Components {
         std::uint32_t a, b, c;
     };
 
+    // Element spans [begin, end) waiting to be uploaded. Keeps a handful of
+    // disjoint spans; when full, the two closest ones are merged.
+    struct SDirtyRanges {
+        static constexpr std::size_t MAX_RANGES = 8;
+
+        struct SRange {
+            std::uint32_t begin, end;
+        };
+
+        std::array<SRange, MAX_RANGES> ranges{};
+        std::uint32_t count = 0;
+
+        bool empty() const { return count == 0; }
+        void clear() { count = 0; }
+
+        void add(std::uint32_t begin, std::uint32_t end) {
+            if (begin >= end) return;
+            // Absorb every span that overlaps or touches [begin, end).
+            for (std::uint32_t i = 0; i < count;) {
+                if (ranges[i].begin <= end && begin <= ranges[i].end) {
+                    begin = std::min(begin, ranges[i].begin);
+                    end = std::max(end, ranges[i].end);
+                    ranges[i] = ranges[--count];
+                } else {
+                    ++i;
+                }
+            }
+            if (count == MAX_RANGES) mergeClosest();
+            ranges[count++] = {begin, end};
+        }
+
+    private:
+        void mergeClosest() {
+            std::sort(ranges.begin(), ranges.begin() + count,
+                      [](const SRange& a, const SRange& b) { return a.begin < b.begin; });
+            std::uint32_t best = 0;
+            for (std::uint32_t i = 1; i + 1 < count; ++i)
+                if (ranges[i + 1].begin - ranges[i].end < ranges[best + 1].begin - ranges[best].end) best = i;
+            ranges[best].end = ranges[best + 1].end;
+            std::copy(ranges.begin() + best + 2, ranges.begin() + count, ranges.begin() + best + 1);
+            --count;
+        }
+    };
+
     struct SMesh {
+        SMesh() = default;
+
+        // Moves hand the GPU range over and leave the source without one. The
+        // target must not hold a range of its own: release it first
+        // (IRenderBackend::releaseMesh), it would leak otherwise.
+        SMesh(SMesh&& other) noexcept { *this = std::move(other); }
+        SMesh& operator=(SMesh&& other) noexcept {
+            if (this == &other) return *this;
+            assert(geometry == 0xFFFFFFFFu && "releaseMesh() before moving over a mesh with a GPU range");
+            vertices = std::move(other.vertices);
+            indices = std::move(other.indices);
+            isDirty = other.isDirty;
+            dirtyVertices = other.dirtyVertices;
+            dirtyIndices = other.dirtyIndices;
+            geometry = other.geometry;
+            vertexCapacity = other.vertexCapacity;
+            indexCapacity = other.indexCapacity;
+            uploadedVertices = other.uploadedVertices;
+            uploadedIndices = other.uploadedIndices;
+            localBounds = other.localBounds;
+            boundsDirty = other.boundsDirty;
+            vertexRevision = other.vertexRevision;
+            indexRevision = other.indexRevision;
+            identity = other.identity;
+
+            other.vertices.clear();
+            other.indices.clear();
+            other.dirtyVertices.clear();
+            other.dirtyIndices.clear();
+            other.geometry = 0xFFFFFFFFu;
+            other.vertexCapacity = other.indexCapacity = 0;
+            other.uploadedVertices = other.uploadedIndices = 0;
+            other.identity = nextIdentity();
+            other.markReplaced();
+            return *this;
+        }
+
+        // Copies never share a GPU range: a new mesh uploads on first use and an
+        // assigned one keeps its own range and re-uploads in full.
+        SMesh(const SMesh& other) { *this = other; }
+        SMesh& operator=(const SMesh& other) {
+            if (this == &other) return *this;
+            vertices = other.vertices;
+            indices = other.indices;
+            dirtyVertices.clear();
+            dirtyIndices.clear();
+            uploadedVertices = uploadedIndices = 0;
+            vertexRevision = std::max(vertexRevision, other.vertexRevision);
+            indexRevision = std::max(indexRevision, other.indexRevision);
+            identity = nextIdentity();
+            markReplaced();
+            localBounds = other.localBounds;
+            boundsDirty = other.boundsDirty;
+            return *this;
+        }
+
         std::vector<SVertex> vertices;
         std::vector<SIndex> indices;
-        bool isDirty = true;
+        bool isDirty = true; // full re-upload
+
+        // Partial edits; uploaded with glBufferSubData when isDirty is false.
+        SDirtyRanges dirtyVertices;
+        SDirtyRanges dirtyIndices; // in triangles
 
         // --- GPU resources ---
-        GLuint vao = 0;
-        GLuint vbo = 0;
-        GLuint ebo = 0;
+        std::uint32_t geometry = 0xFFFFFFFFu;  // CGeometryArena handle
+        std::uint32_t vertexCapacity = 0; // allocated on the GPU, in vertices
+        std::uint32_t indexCapacity = 0;  // in triangles
+        std::uint32_t uploadedVertices = 0;
+        std::uint32_t uploadedIndices = 0;
+
+        // Object-space bounds of the vertices, refreshed by updateBounds().
+        Math::SAABB localBounds;
+        bool boundsDirty = true;
+
+        // Bumped by every edit, so derived CPU data (picking BVHs) can tell
+        // whether it needs a refit (vertices) or a rebuild (indices).
+        std::uint32_t vertexRevision = 0;
+        std::uint32_t indexRevision = 0;
+
+        // Unique per mesh object: new on construction and copy, carried by
+        // moves. Tells a replaced mesh from an edited one when revisions match.
+        std::uint64_t identity = nextIdentity();
+
+        void markVerticesDirty(std::uint32_t first, std::uint32_t count = 1) {
+            dirtyVertices.add(first, first + count);
+            boundsDirty = true;
+            ++vertexRevision;
+        }
+        void markIndicesDirty(std::uint32_t first, std::uint32_t count = 1) {
+            dirtyIndices.add(first, first + count);
+            ++indexRevision;
+        }
+        // After replacing vertices and indices wholesale.
+        void markReplaced() {
+            isDirty = true;
+            boundsDirty = true;
+            ++vertexRevision;
+            ++indexRevision;
+        }
+        bool needsUpload() const {
+            return isDirty || !dirtyVertices.empty() || !dirtyIndices.empty() ||
+                   uploadedVertices != vertices.size() || uploadedIndices != indices.size();
+        }
+
+        void updateBounds() {
+            localBounds = Math::SAABB{};
+            for (const SVertex& v : vertices) localBounds.expand(glm::vec3(v.x, v.y, v.z));
+            boundsDirty = false;
+        }
 
         // Helper
         GLsizei vertexCount() const { return static_cast<GLsizei>(vertices.size()); }
         GLsizei indexCount() const { return static_cast<GLsizei>(indices.size() * 3); }
+
+    private:
+        static std::uint64_t nextIdentity() {
+            static std::atomic<std::uint64_t> s_next{1};
+            return s_next.fetch_add(1, std::memory_order_relaxed);
+        }
     };
 
 } // namespace Kinetica::Components
@@ -14,6 +14,10 @@ namespace Kinetica::Components {
         mutable bool isDirty = true;
         mutable glm::mat4 matrix = glm::mat4(1.0f);
 
+        // Set whenever the local matrix is rebuilt; cleared by the world-transform
+        // pass (CTransformHierarchy) once the change has been propagated.
+        mutable bool isWorldDirty = true;
+
         const glm::mat4& getMatrix() const {
             if (isDirty) {
                 matrix = glm::mat4(1.0f);
@@ -23,6 +27,7 @@ namespace Kinetica::Components {
                 matrix = glm::rotate(matrix, rotation.x, glm::vec3(1, 0, 0));
                 matrix = glm::scale(matrix, scale);
                 isDirty = false;
+                isWorldDirty = true;
             }
             return matrix;
         }
@@ -0,0 +1,42 @@
+#ifndef KINETICA_ECS_ENTITY_HPP
+#define KINETICA_ECS_ENTITY_HPP
+
+#include <cstdint>
+#include <functional>
+
+namespace Kinetica {
+
+    // Runtime entity key: a slot index plus a version that is bumped every time
+    // the slot is recycled, so handles to destroyed entities are detected as stale.
+    // Persistent identity (files, plugins) is the entity's CUUID, see CRegistry::getUUID.
+    struct SEntityHandle {
+        static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+        std::uint32_t index = INVALID_INDEX;
+        std::uint32_t version = 0;
+
+        bool isValid() const { return index != INVALID_INDEX; }
+
+        bool operator==(const SEntityHandle& other) const = default;
+        bool operator<(const SEntityHandle& other) const {
+            return index != other.index ? index < other.index : version < other.version;
+        }
+
+        std::uint64_t toU64() const { return (static_cast<std::uint64_t>(version) << 32) | index; }
+        static SEntityHandle fromU64(std::uint64_t value) {
+            return { static_cast<std::uint32_t>(value), static_cast<std::uint32_t>(value >> 32) };
+        }
+    };
+
+} // namespace Kinetica
+
+namespace std {
+    template<>
+    struct hash<Kinetica::SEntityHandle> {
+        std::size_t operator()(const Kinetica::SEntityHandle& e) const noexcept {
+            return std::hash<std::uint64_t>{}(e.toU64());
+        }
+    };
+} // namespace std
+
+#endif
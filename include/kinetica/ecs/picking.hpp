@@ -0,0 +1,98 @@
+#ifndef KINETICA_ECS_PICKING_HPP
+#define KINETICA_ECS_PICKING_HPP
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "registry.hpp"
+#include "scene_culling.hpp"
+#include "transform_hierarchy.hpp"
+#include "../geometry/triangle_bvh.hpp"
+
+namespace Kinetica {
+
+    struct SPickHit {
+        EntityID entity = INVALID_ENTITY;
+        std::uint32_t triangle = 0;
+        float t = 0.0f;            // along the query ray
+        float u = 0.0f, v = 0.0f;  // barycentrics of the triangle's b and c corners
+        glm::vec3 position{0.0f};  // world space
+        std::uint32_t vertex = 0;  // mesh vertex of the nearest corner
+        std::uint32_t edge = 0;    // nearest triangle edge: corner edge -> corner (edge + 1) % 3
+    };
+
+    // Ray picking and box/lasso selection on top of the CSceneCulling tree.
+    //
+    // Candidates come from the scene BVH; each is then tested against a
+    // per-mesh triangle BVH in object space. Triangle BVHs are built on first
+    // use and refitted or rebuilt when the mesh revisions change. Queries use
+    // the state of the last CSceneCulling::update(). Not thread-safe.
+    class CPicking {
+    public:
+        struct SStats {
+            std::size_t builds = 0;
+            std::size_t refits = 0;
+            std::size_t meshesTested = 0; // by the last query
+        };
+
+        CPicking(CRegistry& registry, const CTransformHierarchy& hierarchy, const CSceneCulling& culling);
+
+        CPicking(const CPicking&) = delete;
+        CPicking& operator=(const CPicking&) = delete;
+
+        // Closest triangle hit along the (world-space) ray.
+        bool pick(const Math::SRay& ray, SPickHit& hit, float maxT = std::numeric_limits<float>::max());
+        // Every triangle hit, sorted front to back.
+        void pickAll(const Math::SRay& ray, std::vector<SPickHit>& hits, float maxT = std::numeric_limits<float>::max());
+
+        // Entities with at least one triangle (conservatively) inside the
+        // rectangle, given in normalized device coordinates.
+        void selectBox(const glm::mat4& viewProjection, glm::vec2 ndcMin, glm::vec2 ndcMax, std::vector<EntityID>& out);
+        // Entities with a vertex inside the NDC polygon, or under its first point.
+        void selectLasso(const glm::mat4& viewProjection, std::span<const glm::vec2> ndcPolygon, std::vector<EntityID>& out);
+        // Triangles of one entity inside the NDC rectangle (face selection).
+        void selectTriangles(EntityID entity, const glm::mat4& viewProjection, glm::vec2 ndcMin, glm::vec2 ndcMax,
+                             std::vector<std::uint32_t>& out);
+
+        // The entity's triangle BVH, built or refitted as needed; null without a mesh.
+        const Geometry::CTriangleBVH* meshBVH(EntityID entity);
+
+        // Drops cached BVHs of entities that no longer have a mesh.
+        void collectGarbage();
+
+        const SStats& stats() const { return m_stats; }
+
+    private:
+        struct SCacheEntry {
+            EntityID entity = INVALID_ENTITY;
+            std::uint64_t meshIdentity = 0;
+            std::uint32_t vertexRevision = 0;
+            std::uint32_t indexRevision = 0;
+            std::size_t vertexCount = 0;
+            std::size_t triangleCount = 0;
+            Geometry::CTriangleBVH bvh;
+        };
+
+        const Geometry::CTriangleBVH* meshBVH(EntityID entity, const Components::SMesh& mesh);
+        SPickHit makeHit(EntityID entity, const Components::SMesh& mesh, const glm::mat4& world, const Math::SRay& ray,
+                         const Geometry::SRayHit& h) const;
+        void candidates(const glm::mat4& rectViewProjection, std::vector<EntityID>& out) const;
+
+        CRegistry& m_registry;
+        const CTransformHierarchy& m_hierarchy;
+        const CSceneCulling& m_culling;
+
+        std::vector<SCacheEntry> m_cache; // entity index -> BVH
+        std::vector<Geometry::SRayHit> m_rayHits;         // scratch
+        std::vector<std::uint32_t> m_triangleScratch;     // scratch
+        std::vector<EntityID> m_candidates;               // scratch
+        SStats m_stats;
+    };
+
+} // namespace Kinetica
+
+#endif
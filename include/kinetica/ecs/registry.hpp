@@ -1,26 +1,67 @@
 #ifndef KINETICA_REGISTRY_HPP
 #define KINETICA_REGISTRY_HPP
 
+#include <functional>
 #include <unordered_map>
 #include <memory>
-#include <typeindex>
-#include <unordered_set>
-
+#include <vector>
+#include <cstdint>
+
+#include "entity.hpp"
+#include "component_storage.hpp"
+#include "component_type.hpp"
+#include "archetype.hpp"
+#include "view.hpp"
 #include "components/transform.hpp"
 #include "components/mesh.hpp"
 #include "components/material.hpp"
 #include "../uuid.hpp"
 
 namespace Kinetica {
-    using EntityID = CUUID;
+    using EntityID = SEntityHandle;
     extern const EntityID INVALID_ENTITY;
 
+    // How CRegistry lays out components.
+    enum class EStorageMode {
+        SparseSet,  ///< One packed pool per component type (cheap structural changes)
+        Archetype,  ///< Entities grouped by component set in SoA chunks (fast multi-component queries)
+    };
+
     class CRegistry {
     public:
+        explicit CRegistry(EStorageMode mode = EStorageMode::SparseSet) : m_mode(mode) {}
+
+        CRegistry(const CRegistry&) = delete;
+        CRegistry& operator=(const CRegistry&) = delete;
+
+        EStorageMode storageMode() const { return m_mode; }
+
         EntityID createEntity();
 
+        // Creates an entity bound to an existing persistent identity (scene loading,
+        // plugin interop). Returns INVALID_ENTITY if the UUID is already in use.
+        EntityID createEntity(const CUUID& uuid);
+
         void destroyEntity(EntityID id);
 
+        // Pre-sizes entity bookkeeping for `count` more entities (bulk loads).
+        void reserveEntities(std::size_t count);
+
+        bool isAlive(EntityID id) const {
+            return id.index < m_entitySlots.size()
+                && m_entitySlots[id.index] != INVALID_SLOT
+                && m_versions[id.index] == id.version;
+        }
+
+        // UUIDs are assigned lazily on first request, so bulk creation never pays
+        // for random generation of identities that are never persisted.
+        const CUUID& getUUID(EntityID id);
+        EntityID findEntity(const CUUID& uuid) const;
+
+        // NOTE: components live in packed arrays, so the returned reference/pointer
+        // is only valid until the next add/remove of the same component type
+        // (in archetype mode: of any component on any entity of the same archetypes).
+        // On a dead entity addComponent stores nothing and returns a scratch T.
         template<typename T>
         T& addComponent(EntityID entity);
 
@@ -33,68 +74,180 @@ namespace Kinetica {
         template<typename T>
         bool hasComponent(EntityID entity) const;
 
-        std::unordered_set<EntityID> m_entities;
+        // Called with the component right before removeComponent<T> or
+        // destroyEntity drops it, e.g. to free GPU resources. One hook per type.
+        template<typename T>
+        void onRemove(std::function<void(EntityID, T&)> hook);
+
+        // True if the entity owns every one of Ts..., answered from its component mask.
+        template<typename... Ts>
+        bool hasComponents(EntityID entity) const;
+
+        // Bit i is set if the entity owns the component with componentTypeId() == i.
+        const ComponentMask& getMask(EntityID entity) const;
+
+        // Bumped whenever a T is added to or removed from any entity, so caches
+        // built over the set of T owners can tell when to rebuild.
+        template<typename T>
+        std::uint64_t componentVersion() const {
+            const std::uint32_t typeId = componentTypeId<T>();
+            return typeId < m_typeVersions.size() ? m_typeVersions[typeId] : 0;
+        }
+
+        // Pre-sizes T's pool for `count` more components (no-op in archetype mode).
+        template<typename T>
+        void reserveComponents(std::size_t count);
+
+        // Multi-component iteration, see CView.
+        template<typename... Ts>
+        CView<Ts...> view();
+
+        std::size_t entityCount() const { return m_entities.size(); }
+        const std::vector<EntityID>& entities() const { return m_entities; }
 
         std::vector<EntityID> getAllEntities() const {
-            return std::vector<EntityID>(m_entities.begin(), m_entities.end());
+            return m_entities;
         }
 
     private:
-        struct IComponentStorage {
-            virtual ~IComponentStorage() = default;
-            virtual void erase(EntityID id) = 0;
-        };
+        EntityID allocateEntity();
+        void runRemoveHook(EntityID entity, std::uint32_t typeId);
 
         template<typename T>
-        struct ComponentStorage : public IComponentStorage {
-            std::unordered_map<EntityID, T> components;
+        ComponentStorage<T>* findStorage();
 
-            void erase(EntityID id) override {
-                components.erase(id);
-            }
-        };
+        template<typename T>
+        const ComponentStorage<T>* findStorage() const;
+
+        std::vector<EntityID> m_entities;          // dense list of live entities
+        std::vector<std::uint32_t> m_entitySlots;  // entity index -> position in m_entities
+        std::vector<std::uint32_t> m_versions;     // entity index -> current version
+        std::vector<std::uint32_t> m_freeIndices;
+        std::vector<ComponentMask> m_masks;        // entity index -> owned component types
+        std::vector<std::uint64_t> m_typeVersions; // component type id -> add/remove counter
+        std::vector<std::function<void(EntityID, void*)>> m_removeHooks; // component type id -> hook
+
+        // Persistent identity side table (indexed by entity index).
+        std::vector<CUUID> m_uuids;
+        std::unordered_map<CUUID, EntityID> m_uuidToEntity;
+
+        EStorageMode m_mode;
 
-        std::unordered_map<std::type_index, std::unique_ptr<IComponentStorage>> m_storages;
+        std::vector<std::unique_ptr<IComponentStorage>> m_storages;  // indexed by component type id
+        CArchetypeStorage m_archetypes;
     };
 
     // Inline template implementations
     template<typename T>
     T& CRegistry::addComponent(EntityID entity) {
-        auto typeIdx = std::type_index(typeid(T));
-        auto it = m_storages.find(typeIdx);
-        if (it == m_storages.end()) {
+        if (!isAlive(entity)) {
+            // A dead or stale handle must not reach the pools, whose slots may
+            // belong to a newer entity on the same index.
+            static thread_local T t_discarded;
+            t_discarded = T{};
+            return t_discarded;
+        }
+
+        const std::uint32_t typeId = componentTypeId<T>();
+        if (!m_masks[entity.index].test(typeId)) {
+            m_masks[entity.index].set(typeId);
+            if (typeId >= m_typeVersions.size()) m_typeVersions.resize(typeId + 1, 0);
+            ++m_typeVersions[typeId];
+        }
+
+        if (m_mode == EStorageMode::Archetype) {
+            return *static_cast<T*>(m_archetypes.add(entity, typeId, componentInfo<T>()));
+        }
+
+        if (typeId >= m_storages.size()) m_storages.resize(typeId + 1);
+        if (!m_storages[typeId]) {
             // Create new storage for type T
-            auto newStorage = std::make_unique<ComponentStorage<T>>();
-            it = m_storages.emplace(typeIdx, std::move(newStorage)).first;
+            m_storages[typeId] = std::make_unique<ComponentStorage<T>>();
         }
-        auto& storage = static_cast<ComponentStorage<T>&>(*it->second);
-        return storage.components[entity];
+        auto& storage = static_cast<ComponentStorage<T>&>(*m_storages[typeId]);
+        return storage.emplace(entity);
     }
 
     template<typename T>
     void CRegistry::removeComponent(EntityID entity) {
-        auto it = m_storages.find(std::type_index(typeid(T)));
-        if (it != m_storages.end()) {
-            auto& storage = static_cast<ComponentStorage<T>&>(*it->second);
-            storage.components.erase(entity);
+        if (!hasComponent<T>(entity)) return;
+        runRemoveHook(entity, componentTypeId<T>());
+        m_masks[entity.index].reset(componentTypeId<T>());
+        ++m_typeVersions[componentTypeId<T>()];
+
+        if (m_mode == EStorageMode::Archetype) {
+            m_archetypes.remove(entity, componentTypeId<T>());
+            return;
         }
+        m_storages[componentTypeId<T>()]->erase(entity);
     }
 
     template<typename T>
     T* CRegistry::getComponent(EntityID entity) {
-        auto it = m_storages.find(std::type_index(typeid(T)));
-        if (it == m_storages.end()) return nullptr;
-        auto& storage = static_cast<ComponentStorage<T>&>(*it->second);
-        auto compIt = storage.components.find(entity);
-        return (compIt != storage.components.end()) ? &compIt->second : nullptr;
+        if (m_mode == EStorageMode::Archetype) {
+            return static_cast<T*>(m_archetypes.get(entity, componentTypeId<T>()));
+        }
+
+        auto* storage = findStorage<T>();
+        return storage ? storage->find(entity) : nullptr;
     }
 
     template<typename T>
     bool CRegistry::hasComponent(EntityID entity) const {
-        auto it = m_storages.find(std::type_index(typeid(T)));
-        if (it == m_storages.end()) return false;
-        auto& storage = static_cast<const ComponentStorage<T>&>(*it->second);
-        return storage.components.count(entity) > 0;
+        return isAlive(entity) && m_masks[entity.index].test(componentTypeId<T>());
+    }
+
+    template<typename T>
+    void CRegistry::onRemove(std::function<void(EntityID, T&)> hook) {
+        const std::uint32_t typeId = componentTypeId<T>();
+        if (typeId >= m_removeHooks.size()) m_removeHooks.resize(typeId + 1);
+        if (!hook) {
+            m_removeHooks[typeId] = nullptr;
+            return;
+        }
+        m_removeHooks[typeId] = [hook = std::move(hook)](EntityID entity, void* component) {
+            hook(entity, *static_cast<T*>(component));
+        };
+    }
+
+    template<typename... Ts>
+    bool CRegistry::hasComponents(EntityID entity) const {
+        static const ComponentMask required = componentMask<Ts...>();
+        return isAlive(entity) && (m_masks[entity.index] & required) == required;
+    }
+
+    template<typename T>
+    void CRegistry::reserveComponents(std::size_t count) {
+        if (m_mode == EStorageMode::Archetype) return;
+
+        const std::uint32_t typeId = componentTypeId<T>();
+        if (typeId >= m_storages.size()) m_storages.resize(typeId + 1);
+        if (!m_storages[typeId]) m_storages[typeId] = std::make_unique<ComponentStorage<T>>();
+        auto& storage = static_cast<ComponentStorage<T>&>(*m_storages[typeId]);
+        storage.components.reserve(storage.components.size() + count);
+        storage.entities.reserve(storage.entities.size() + count);
+    }
+
+    template<typename... Ts>
+    CView<Ts...> CRegistry::view() {
+        if (m_mode == EStorageMode::Archetype) {
+            return CView<Ts...>(&m_archetypes);
+        }
+        return CView<Ts...>(std::make_tuple(findStorage<Ts>()...));
+    }
+
+    template<typename T>
+    ComponentStorage<T>* CRegistry::findStorage() {
+        const std::uint32_t typeId = componentTypeId<T>();
+        if (typeId >= m_storages.size()) return nullptr;
+        return static_cast<ComponentStorage<T>*>(m_storages[typeId].get());
+    }
+
+    template<typename T>
+    const ComponentStorage<T>* CRegistry::findStorage() const {
+        const std::uint32_t typeId = componentTypeId<T>();
+        if (typeId >= m_storages.size()) return nullptr;
+        return static_cast<const ComponentStorage<T>*>(m_storages[typeId].get());
     }
 
 } // namespace Kinetica
@@ -0,0 +1,69 @@
+#ifndef KINETICA_ECS_SCENE_CULLING_HPP
+#define KINETICA_ECS_SCENE_CULLING_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "registry.hpp"
+#include "transform_hierarchy.hpp"
+#include "../geometry/dynamic_bvh.hpp"
+
+namespace Kinetica {
+
+    // Keeps a dynamic BVH of world-space bounds for every entity with an
+    // STransform and an SMesh, and answers frustum queries against it.
+    //
+    // update() is incremental: only entities whose world matrix was recomputed
+    // by the hierarchy, or whose mesh bounds changed, touch the tree, and most
+    // of those stay inside their fat box.
+    class CSceneCulling {
+    public:
+        struct SStats {
+            std::size_t proxies = 0;
+            std::size_t refitted = 0;    // proxies whose bounds were recomputed by the last update()
+            std::size_t reinserted = 0;  // ...of which escaped their fat box
+            std::size_t nodesTested = 0; // by the last cull()
+            std::size_t visible = 0;
+        };
+
+        explicit CSceneCulling(CRegistry& registry, float margin = 0.1f);
+
+        CSceneCulling(const CSceneCulling&) = delete;
+        CSceneCulling& operator=(const CSceneCulling&) = delete;
+
+        // Call after hierarchy.update().
+        void update(const CTransformHierarchy& hierarchy);
+
+        // Replaces `out` with the entities whose bounds intersect the frustum.
+        void cull(const glm::mat4& viewProjection, std::vector<EntityID>& out);
+
+        const SStats& stats() const { return m_stats; }
+        const Geometry::CDynamicBVH& tree() const { return m_tree; }
+        // Entity of a tree leaf (its userData).
+        EntityID entityOf(std::uint32_t userData) const { return m_slots[userData].entity; }
+
+    private:
+        struct SSlot {
+            EntityID entity = INVALID_ENTITY;
+            std::uint32_t proxy = Geometry::CDynamicBVH::NULL_NODE;
+            std::uint32_t seen = 0;
+        };
+
+        void rebuildProxies(const CTransformHierarchy& hierarchy);
+        void refit(EntityID entity, const glm::mat4& world);
+
+        CRegistry& m_registry;
+        Geometry::CDynamicBVH m_tree;
+        std::vector<SSlot> m_slots; // entity index -> proxy
+
+        std::uint64_t m_transformVersion = ~0ull;
+        std::uint64_t m_meshVersion = ~0ull;
+        std::uint32_t m_pass = 0;
+        SStats m_stats;
+    };
+
+} // namespace Kinetica
+
+#endif
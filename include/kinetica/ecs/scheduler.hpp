@@ -0,0 +1,79 @@
+#ifndef KINETICA_ECS_SCHEDULER_HPP
+#define KINETICA_ECS_SCHEDULER_HPP
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "component_type.hpp"
+#include "registry.hpp"
+#include "../thread_pool.hpp"
+
+namespace Kinetica {
+
+    // Component access declared by a system. Two systems conflict when one
+    // writes a component type the other reads or writes; exclusive systems
+    // (structural changes, anything touching the registry itself) conflict
+    // with everything.
+    struct SSystemAccess {
+        ComponentMask reads;
+        ComponentMask writes;
+        bool exclusive = false;
+
+        template<typename... Ts>
+        SSystemAccess& read() { reads |= componentMask<Ts...>(); return *this; }
+
+        template<typename... Ts>
+        SSystemAccess& write() { writes |= componentMask<Ts...>(); return *this; }
+
+        SSystemAccess& makeExclusive() { exclusive = true; return *this; }
+
+        bool conflictsWith(const SSystemAccess& other) const {
+            return exclusive || other.exclusive
+                || (writes & (other.reads | other.writes)).any()
+                || (other.writes & reads).any();
+        }
+    };
+
+    // Runs registered systems once per run() call. Systems keep their
+    // registration order wherever they conflict; everything else runs
+    // concurrently on the thread pool.
+    class CScheduler {
+    public:
+        using SystemFn = std::function<void(CRegistry&, CThreadPool&)>;
+
+        CScheduler(CRegistry& registry, CThreadPool& pool);
+
+        CScheduler(const CScheduler&) = delete;
+        CScheduler& operator=(const CScheduler&) = delete;
+
+        void addSystem(std::string name, const SSystemAccess& access, SystemFn fn);
+        void run();
+
+        std::size_t systemCount() const { return m_systems.size(); }
+
+    private:
+        struct SSystem {
+            std::string name;
+            SSystemAccess access;
+            SystemFn fn;
+            std::vector<std::size_t> successors;
+            std::size_t dependencies = 0;
+            const char* zone = nullptr; // interned name for KPROFILE_SCOPE
+        };
+
+        void buildGraph();
+        void launch(std::size_t index, CTaskGroup& group);
+
+        CRegistry& m_registry;
+        CThreadPool& m_pool;
+        std::vector<SSystem> m_systems;
+        std::unique_ptr<std::atomic<std::size_t>[]> m_remaining;
+        bool m_graphDirty = true;
+    };
+
+} // namespace Kinetica
+
+#endif
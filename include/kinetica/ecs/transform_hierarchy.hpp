@@ -0,0 +1,88 @@
+#ifndef KINETICA_ECS_TRANSFORM_HIERARCHY_HPP
+#define KINETICA_ECS_TRANSFORM_HIERARCHY_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "registry.hpp"
+#include "components/transform.hpp"
+#include "components/hierarchy.hpp"
+#include "../thread_pool.hpp"
+
+namespace Kinetica {
+
+    // World-transform pass over every entity with an STransform.
+    //
+    // Nodes are kept in a topological preorder (parents before children) in which
+    // every subtree is one contiguous range, and world matrices are stored in the
+    // same order in one contiguous array for the renderer. update() only
+    // recomputes the subtrees below transforms that changed since the last call,
+    // each as a single linear pass over its range; local matrices are composed in
+    // SIMD batches (Math::composeTRS).
+    //
+    // Children without an STransform are not part of the pass (nor is anything
+    // below them). Detach nodes before destroying them to keep sibling links intact.
+    class CTransformHierarchy {
+    public:
+        explicit CTransformHierarchy(CRegistry& registry);
+
+        CTransformHierarchy(const CTransformHierarchy&) = delete;
+        CTransformHierarchy& operator=(const CTransformHierarchy&) = delete;
+
+        // Re-parents `child` (INVALID_ENTITY detaches it). Fails on dead entities
+        // or if `parent` is `child` or one of its descendants.
+        bool setParent(EntityID child, EntityID parent);
+        void detach(EntityID child) { setParent(child, INVALID_ENTITY); }
+
+        void update(CThreadPool* pool = nullptr);
+
+        const glm::mat4* worldMatrix(EntityID entity) const;
+
+        const std::vector<EntityID>& order() const { return m_order; }
+        const std::vector<glm::mat4>& worldMatrices() const { return m_world; }
+
+        // Number of nodes whose world matrix was recomputed by the last update().
+        std::size_t lastUpdateCount() const { return m_lastUpdateCount; }
+
+        // fn(entity, world) for every node recomputed by the last update().
+        template<typename Func>
+        void forEachUpdated(Func&& fn) const {
+            for (const SRange& range : m_ranges) {
+                for (std::uint32_t p = range.begin; p < range.end; ++p) fn(m_order[p], m_world[p]);
+            }
+        }
+
+    private:
+        static constexpr std::uint32_t NO_POSITION = 0xFFFFFFFFu;
+
+        struct SRange {
+            std::uint32_t begin;
+            std::uint32_t end;
+        };
+
+        void rebuildOrder();
+        void updateRanges(CThreadPool* pool);
+        void updateRange(std::uint32_t begin, std::uint32_t end);
+
+        CRegistry& m_registry;
+
+        std::vector<EntityID> m_order;           // preorder position -> entity
+        std::vector<std::uint32_t> m_parentPos;  // position -> parent position (NO_POSITION for roots)
+        std::vector<std::uint32_t> m_subtreeEnd; // position -> one past the last descendant
+        std::vector<glm::mat4> m_world;          // position -> world matrix
+        std::vector<std::uint32_t> m_positions;  // entity index -> position
+
+        std::vector<std::uint32_t> m_dirty;      // scratch
+        std::vector<SRange> m_ranges;            // scratch
+
+        std::uint64_t m_transformVersion = ~0ull;
+        std::uint64_t m_hierarchyVersion = ~0ull;
+        bool m_topologyDirty = true;
+        std::size_t m_lastUpdateCount = 0;
+    };
+
+} // namespace Kinetica
+
+#endif
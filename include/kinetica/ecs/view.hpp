@@ -0,0 +1,212 @@
+#ifndef KINETICA_ECS_VIEW_HPP
+#define KINETICA_ECS_VIEW_HPP
+
+#include <tuple>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#include "component_storage.hpp"
+#include "archetype.hpp"
+#include "../thread_pool.hpp"
+
+namespace Kinetica {
+
+    // Iterates every entity that owns all of Ts... .
+    //
+    // Sparse-set mode: iteration is driven by the smallest of the involved pools,
+    // the others are probed through their sparse index, so the cost is linear in
+    // the smallest pool. Archetype mode: every matching archetype is walked chunk
+    // by chunk, reading each component column linearly. Nothing is allocated.
+    //
+    //   registry.view<STransform, SMesh>().each([](STransform& t, SMesh& m) { ... });
+    //   for (auto [entity, t, m] : registry.view<STransform, SMesh>()) { ... }
+    //   registry.view<STransform>().parallelEach(pool, [](STransform& t) { ... });
+    //
+    // Adding or removing any of Ts... while iterating invalidates the view.
+    template<typename... Ts>
+    class CView {
+        static_assert(sizeof...(Ts) > 0, "A view needs at least one component type");
+
+    public:
+        using Storages = std::tuple<ComponentStorage<Ts>*...>;
+
+        explicit CView(Storages storages) : m_storages(storages) {
+            const bool complete = ((std::get<ComponentStorage<Ts>*>(m_storages) != nullptr) && ...);
+            if (!complete) return;
+
+            std::size_t smallest = static_cast<std::size_t>(-1);
+            ((pickDriver(std::get<ComponentStorage<Ts>*>(m_storages)->entities, smallest)), ...);
+        }
+
+        explicit CView(CArchetypeStorage* archetypes) : m_archetypeStorage(archetypes) {
+            std::array<std::uint32_t, sizeof...(Ts)> types{ componentTypeId<Ts>()... };
+            std::sort(types.begin(), types.end());
+            m_archetypes = &archetypes->query(types.data(), types.size());
+        }
+
+        class Iterator {
+        public:
+            using value_type = std::tuple<SEntityHandle, Ts&...>;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator(const CView* view, std::size_t pos) : m_view(view), m_pos(pos) { skipToMatch(); }
+
+            value_type operator*() const {
+                if (m_view->m_archetypeStorage) {
+                    CArchetype& arch = m_view->m_archetypeStorage->archetype((*m_view->m_archetypes)[m_pos]);
+                    const auto row = static_cast<std::uint32_t>(m_row);
+                    return value_type(arch.entityAt(row),
+                                      *static_cast<Ts*>(arch.component(row, arch.column(componentTypeId<Ts>())))...);
+                }
+                const SEntityHandle entity = (*m_view->m_driver)[m_pos];
+                return value_type(entity, *std::get<ComponentStorage<Ts>*>(m_view->m_storages)->find(entity)...);
+            }
+
+            Iterator& operator++() {
+                if (m_view->m_archetypeStorage) ++m_row; else ++m_pos;
+                skipToMatch();
+                return *this;
+            }
+            bool operator==(const Iterator& other) const { return m_pos == other.m_pos && m_row == other.m_row; }
+            bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+        private:
+            void skipToMatch() {
+                if (m_view->m_archetypeStorage) {
+                    const auto& matches = *m_view->m_archetypes;
+                    while (m_pos < matches.size() && m_row >= m_view->m_archetypeStorage->archetype(matches[m_pos]).size()) {
+                        ++m_pos;
+                        m_row = 0;
+                    }
+                    return;
+                }
+                while (m_pos < m_view->endPos() && !m_view->contains((*m_view->m_driver)[m_pos])) ++m_pos;
+            }
+
+            const CView* m_view;
+            std::size_t m_pos;
+            std::size_t m_row = 0;
+        };
+
+        Iterator begin() const { return Iterator(this, 0); }
+        Iterator end() const { return Iterator(this, endPos()); }
+
+        // Upper bound of the number of matches.
+        std::size_t sizeHint() const {
+            if (m_archetypeStorage) {
+                std::size_t total = 0;
+                for (std::uint32_t index : *m_archetypes) total += m_archetypeStorage->archetype(index).size();
+                return total;
+            }
+            return m_driver ? m_driver->size() : 0;
+        }
+
+        bool contains(SEntityHandle entity) const {
+            if (m_archetypeStorage) {
+                return (m_archetypeStorage->has(entity, componentTypeId<Ts>()) && ...);
+            }
+            return (std::get<ComponentStorage<Ts>*>(m_storages)->contains(entity) && ...);
+        }
+
+        // Func is called as func(entity, Ts&...) or func(Ts&...).
+        template<typename Func>
+        void each(Func&& func) const {
+            if (m_archetypeStorage) {
+                for (std::uint32_t index : *m_archetypes) {
+                    eachArchetype(m_archetypeStorage->archetype(index), func);
+                }
+                return;
+            }
+            if (!m_driver) return;
+            for (const SEntityHandle entity : *m_driver) {
+                eachOne(entity, func);
+            }
+        }
+
+        // Like each(), but splits the matches into ranges of `grain` entities
+        // (sparse sets) or into archetype chunks and runs them on the pool.
+        // func is called concurrently and must only touch its own entity's data.
+        template<typename Func>
+        void parallelEach(CThreadPool& pool, Func&& func, std::size_t grain = 4096) const {
+            if (m_archetypeStorage) {
+                CTaskGroup group;
+                for (std::uint32_t index : *m_archetypes) {
+                    CArchetype& arch = m_archetypeStorage->archetype(index);
+                    const std::array<int, sizeof...(Ts)> columns{ arch.column(componentTypeId<Ts>())... };
+                    for (std::size_t chunk = 0; chunk < arch.chunkCount(); ++chunk) {
+                        pool.submit(group, [&arch, &func, columns, chunk] {
+                            eachChunk(arch, chunk, columns, func, std::index_sequence_for<Ts...>{});
+                        });
+                    }
+                }
+                pool.wait(group);
+                return;
+            }
+            if (!m_driver) return;
+            const std::vector<SEntityHandle>& driver = *m_driver;
+            pool.parallelFor(driver.size(), grain, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) eachOne(driver[i], func);
+            });
+        }
+
+    private:
+        std::size_t endPos() const {
+            if (m_archetypeStorage) return m_archetypes->size();
+            return m_driver ? m_driver->size() : 0;
+        }
+
+        void pickDriver(const std::vector<SEntityHandle>& entities, std::size_t& smallest) {
+            if (entities.size() < smallest) {
+                smallest = entities.size();
+                m_driver = &entities;
+            }
+        }
+
+        template<typename Func>
+        static void invoke(Func& func, SEntityHandle entity, Ts&... components) {
+            if constexpr (std::is_invocable_v<Func&, SEntityHandle, Ts&...>) {
+                func(entity, components...);
+            } else {
+                func(components...);
+            }
+        }
+
+        template<typename Func>
+        void eachOne(SEntityHandle entity, Func& func) const {
+            const std::tuple<Ts*...> components(std::get<ComponentStorage<Ts>*>(m_storages)->find(entity)...);
+            if (!((std::get<Ts*>(components) != nullptr) && ...)) return;
+            invoke(func, entity, *std::get<Ts*>(components)...);
+        }
+
+        template<typename Func>
+        static void eachArchetype(CArchetype& arch, Func& func) {
+            const std::array<int, sizeof...(Ts)> columns{ arch.column(componentTypeId<Ts>())... };
+            for (std::size_t chunk = 0; chunk < arch.chunkCount(); ++chunk) {
+                eachChunk(arch, chunk, columns, func, std::index_sequence_for<Ts...>{});
+            }
+        }
+
+        template<typename Func, std::size_t... I>
+        static void eachChunk(CArchetype& arch, std::size_t chunk, const std::array<int, sizeof...(Ts)>& columns,
+                              Func& func, std::index_sequence<I...>) {
+            const std::uint32_t count = arch.chunkSize(chunk);
+            const SEntityHandle* entities = arch.entities(chunk);
+            const std::tuple<Ts*...> data(static_cast<Ts*>(arch.columnData(chunk, columns[I]))...);
+            for (std::uint32_t i = 0; i < count; ++i) {
+                invoke(func, entities[i], std::get<I>(data)[i]...);
+            }
+        }
+
+        Storages m_storages{};
+        const std::vector<SEntityHandle>* m_driver = nullptr;
+
+        CArchetypeStorage* m_archetypeStorage = nullptr;
+        const std::vector<std::uint32_t>* m_archetypes = nullptr;
+    };
+
+} // namespace Kinetica
+
+#endif
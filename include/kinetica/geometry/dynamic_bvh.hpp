@@ -0,0 +1,170 @@
+#ifndef KINETICA_GEOMETRY_DYNAMIC_BVH_HPP
+#define KINETICA_GEOMETRY_DYNAMIC_BVH_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "../math/bounds.hpp"
+
+namespace Kinetica::Geometry {
+
+    // Dynamic AABB tree over moving proxies (one leaf per object).
+    //
+    // Leaves store "fat" boxes, grown by a margin, so small movements need no
+    // tree update at all; a proxy that escapes its fat box is re-inserted with a
+    // surface-area-heuristic descent, and the path to the root is refitted and
+    // rebalanced with AVL-style rotations. Proxy ids are stable.
+    class CDynamicBVH {
+    public:
+        static constexpr std::uint32_t NULL_NODE = 0xFFFFFFFFu;
+
+        explicit CDynamicBVH(float margin = 0.1f);
+
+        std::uint32_t createProxy(const Math::SAABB& box, std::uint32_t userData);
+        void destroyProxy(std::uint32_t proxy);
+
+        // Returns true if the tree had to change (the box escaped its fat box).
+        bool moveProxy(std::uint32_t proxy, const Math::SAABB& box);
+
+        std::uint32_t userData(std::uint32_t proxy) const { return m_nodes[proxy].userData; }
+        const Math::SAABB& fatBox(std::uint32_t proxy) const { return m_nodes[proxy].box; }
+
+        // fn(userData) for every leaf whose fat box is not outside the frustum.
+        // Subtrees entirely inside are emitted without testing their nodes.
+        // Returns the number of nodes tested.
+        template<typename Func>
+        std::size_t query(const Math::SFrustum& frustum, Func&& fn) const {
+            if (m_root == NULL_NODE) return 0;
+            std::size_t tested = 0;
+            std::uint32_t stack[128];
+            int top = 0;
+            stack[top++] = m_root;
+            while (top > 0) {
+                const std::uint32_t id = stack[--top];
+                const SNode& node = m_nodes[id];
+                ++tested;
+                const Math::EContainment c = frustum.classify(node.box);
+                if (c == Math::EContainment::Outside) continue;
+                if (c == Math::EContainment::Inside) {
+                    emitSubtree(id, fn);
+                    continue;
+                }
+                if (node.isLeaf()) {
+                    fn(node.userData);
+                } else if (top + 2 <= 128) {
+                    stack[top++] = node.child1;
+                    stack[top++] = node.child2;
+                } else {
+                    emitSubtree(id, fn); // conservative on pathological depth
+                }
+            }
+            return tested;
+        }
+
+        // fn(userData) for every leaf whose fat box overlaps `box`.
+        template<typename Func>
+        void query(const Math::SAABB& box, Func&& fn) const {
+            if (m_root == NULL_NODE) return;
+            std::vector<std::uint32_t> stack{m_root};
+            while (!stack.empty()) {
+                const std::uint32_t id = stack.back();
+                stack.pop_back();
+                const SNode& node = m_nodes[id];
+                if (!node.box.overlaps(box)) continue;
+                if (node.isLeaf()) {
+                    fn(node.userData);
+                } else {
+                    stack.push_back(node.child1);
+                    stack.push_back(node.child2);
+                }
+            }
+        }
+
+        // fn(userData, tEntry) for every leaf whose fat box the ray enters before
+        // maxT, nearest subtree first; fn returns the new maxT (return maxT to
+        // collect all, a hit distance to clip, or 0 to stop).
+        template<typename Func>
+        void raycast(const Math::SRay& ray, float maxT, Func&& fn) const {
+            if (m_root == NULL_NODE) return;
+            std::uint32_t stack[128];
+            float entries[128];
+            int top = 0;
+            float t;
+            if (!m_nodes[m_root].box.intersects(ray, maxT, t)) return;
+            stack[top] = m_root;
+            entries[top++] = t;
+            while (top > 0) {
+                --top;
+                if (entries[top] > maxT) continue;
+                const SNode& node = m_nodes[stack[top]];
+                if (node.isLeaf()) {
+                    maxT = fn(node.userData, entries[top]);
+                    if (maxT <= 0.0f) return;
+                    continue;
+                }
+                float t1, t2;
+                const bool hit1 = m_nodes[node.child1].box.intersects(ray, maxT, t1);
+                const bool hit2 = m_nodes[node.child2].box.intersects(ray, maxT, t2);
+                if (top + 2 > 128) continue;
+                // Push the farther child first so the nearer one is popped next.
+                if (hit1 && hit2 && t1 < t2) {
+                    stack[top] = node.child2; entries[top++] = t2;
+                    stack[top] = node.child1; entries[top++] = t1;
+                } else {
+                    if (hit1) { stack[top] = node.child1; entries[top++] = t1; }
+                    if (hit2) { stack[top] = node.child2; entries[top++] = t2; }
+                }
+            }
+        }
+
+        std::size_t proxyCount() const { return m_proxyCount; }
+        int height() const { return m_root == NULL_NODE ? 0 : m_nodes[m_root].height; }
+        // Sum of internal node areas over root area; lower is a better tree.
+        float areaRatio() const;
+
+    private:
+        struct SNode {
+            Math::SAABB box;
+            std::uint32_t parent = NULL_NODE;
+            std::uint32_t child1 = NULL_NODE;
+            std::uint32_t child2 = NULL_NODE;
+            std::uint32_t userData = 0;
+            std::int32_t height = -1; // -1: free, 0: leaf
+
+            bool isLeaf() const { return child1 == NULL_NODE; }
+        };
+
+        template<typename Func>
+        void emitSubtree(std::uint32_t id, Func& fn) const {
+            thread_local std::vector<std::uint32_t> stack;
+            stack.clear();
+            stack.push_back(id);
+            while (!stack.empty()) {
+                const SNode& node = m_nodes[stack.back()];
+                stack.pop_back();
+                if (node.isLeaf()) {
+                    fn(node.userData);
+                } else {
+                    stack.push_back(node.child1);
+                    stack.push_back(node.child2);
+                }
+            }
+        }
+
+        std::uint32_t allocateNode();
+        void freeNode(std::uint32_t id);
+        void insertLeaf(std::uint32_t leaf);
+        void removeLeaf(std::uint32_t leaf);
+        void refitFrom(std::uint32_t id);
+        std::uint32_t balance(std::uint32_t a);
+
+        std::vector<SNode> m_nodes;
+        std::uint32_t m_root = NULL_NODE;
+        std::uint32_t m_freeList = NULL_NODE; // chained through SNode::parent
+        std::size_t m_proxyCount = 0;
+        float m_margin;
+    };
+
+} // namespace Kinetica::Geometry
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef KINETICA_GEOMETRY_HALF_EDGE_MESH_HPP
+#define KINETICA_GEOMETRY_HALF_EDGE_MESH_HPP
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../ecs/components/mesh.hpp"
+
+namespace Kinetica::Geometry {
+
+    constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    // Index-based half-edge topology for modeling operations.
+    //
+    // Every face (triangle or n-gon) owns a cycle of half-edges. A half-edge
+    // points to its target vertex, the next/previous half-edge of its face and
+    // its twin on the neighbouring face; boundary half-edges have no twin
+    // (INVALID_INDEX). Topological vertices are welded by position, while the
+    // per-face-corner attributes (normal, uv) of the source SMesh are kept on the
+    // half-edges, so uv seams survive a fromMesh/toMesh round trip.
+    //
+    // Removed elements are tombstoned until compact(); ids stay stable until then.
+    class CHalfEdgeMesh {
+    public:
+        struct SHalfEdge {
+            std::uint32_t to = INVALID_INDEX;      // target vertex
+            std::uint32_t twin = INVALID_INDEX;
+            std::uint32_t next = INVALID_INDEX;
+            std::uint32_t prev = INVALID_INDEX;
+            std::uint32_t face = INVALID_INDEX;    // INVALID_INDEX once removed
+            std::uint32_t corner = INVALID_INDEX;  // attribute of the corner at this half-edge's origin
+        };
+
+        CHalfEdgeMesh() = default;
+
+        // Builds the topology in O(faces * average valence); vertices with equal
+        // positions become one topological vertex.
+        static CHalfEdgeMesh fromMesh(const Components::SMesh& mesh);
+
+        // Builds from n-gons: faceSizes[i] corners per face, indices into `vertices`.
+        static CHalfEdgeMesh fromPolygons(const std::vector<Components::SVertex>& vertices,
+                                          std::span<const std::uint32_t> faceSizes,
+                                          std::span<const std::uint32_t> faceIndices);
+
+        // Flattens back to a triangle list (n-gons are fan-triangulated).
+        void toMesh(Components::SMesh& mesh) const;
+
+        // ---- Sizes (including tombstones) ----
+        std::uint32_t vertexCount() const { return static_cast<std::uint32_t>(m_points.size()); }
+        std::uint32_t faceCount() const { return static_cast<std::uint32_t>(m_faces.size()); }
+        std::uint32_t halfEdgeCount() const { return static_cast<std::uint32_t>(m_halfEdges.size()); }
+
+        bool isFaceValid(std::uint32_t face) const { return face < m_faces.size() && m_faces[face] != INVALID_INDEX; }
+        bool isHalfEdgeValid(std::uint32_t h) const { return h < m_halfEdges.size() && m_halfEdges[h].face != INVALID_INDEX; }
+
+        // ---- O(1) adjacency ----
+        const SHalfEdge& halfEdge(std::uint32_t h) const { return m_halfEdges[h]; }
+        std::uint32_t target(std::uint32_t h) const { return m_halfEdges[h].to; }
+        std::uint32_t origin(std::uint32_t h) const { return m_halfEdges[m_halfEdges[h].prev].to; }
+        std::uint32_t twin(std::uint32_t h) const { return m_halfEdges[h].twin; }
+        std::uint32_t next(std::uint32_t h) const { return m_halfEdges[h].next; }
+        std::uint32_t prev(std::uint32_t h) const { return m_halfEdges[h].prev; }
+        std::uint32_t face(std::uint32_t h) const { return m_halfEdges[h].face; }
+        bool isBoundary(std::uint32_t h) const { return m_halfEdges[h].twin == INVALID_INDEX; }
+
+        std::uint32_t faceHalfEdge(std::uint32_t face) const { return m_faces[face]; }
+        std::uint32_t vertexHalfEdge(std::uint32_t vertex) const { return m_vertexHalfEdges[vertex]; }
+
+        const glm::vec3& position(std::uint32_t vertex) const { return m_points[vertex]; }
+        void setPosition(std::uint32_t vertex, const glm::vec3& position) { m_points[vertex] = position; }
+
+        // ---- Neighbourhood traversal ----
+        // fn(h) for every half-edge of the face, in order.
+        template<typename Func>
+        void forEachFaceHalfEdge(std::uint32_t face, Func&& fn) const {
+            const std::uint32_t start = m_faces[face];
+            std::uint32_t h = start;
+            do {
+                fn(h);
+                h = m_halfEdges[h].next;
+            } while (h != start);
+        }
+
+        // fn(h) for every half-edge leaving `vertex` (both directions around boundaries).
+        template<typename Func>
+        void forEachOutgoing(std::uint32_t vertex, Func&& fn) const {
+            const std::uint32_t start = m_vertexHalfEdges[vertex];
+            if (start == INVALID_INDEX) return;
+
+            std::uint32_t h = start;
+            while (true) {
+                fn(h);
+                const std::uint32_t t = m_halfEdges[h].twin;
+                if (t == INVALID_INDEX) break;
+                h = m_halfEdges[t].next;
+                if (h == start) return; // closed fan
+            }
+
+            // Hit a boundary: walk the other way from the start.
+            h = start;
+            while (true) {
+                const std::uint32_t t = m_halfEdges[m_halfEdges[h].prev].twin;
+                if (t == INVALID_INDEX || t == start) break;
+                h = t;
+                fn(h);
+            }
+        }
+
+        std::uint32_t faceSize(std::uint32_t face) const;
+        std::uint32_t valence(std::uint32_t vertex) const;
+        glm::vec3 faceNormal(std::uint32_t face) const;
+        glm::vec3 faceCenter(std::uint32_t face) const;
+        void faceNeighbours(std::uint32_t face, std::vector<std::uint32_t>& out) const;
+
+        // Half-edge from `from` to `to`, or INVALID_INDEX.
+        std::uint32_t findHalfEdge(std::uint32_t from, std::uint32_t to) const;
+
+        // Edge loop through `h` across quads (stops at poles, n-gons and boundaries).
+        void edgeLoop(std::uint32_t h, std::vector<std::uint32_t>& out) const;
+
+        // ---- Local edits (incremental, no rebuild) ----
+        std::uint32_t addVertex(const glm::vec3& position);
+
+        // Adds a face over existing vertices, linking twins with its neighbours.
+        // `corners` (optional) gives one attribute index per corner.
+        std::uint32_t addFace(std::span<const std::uint32_t> vertices,
+                              std::span<const std::uint32_t> corners = {});
+        void removeFace(std::uint32_t face);
+
+        // Inserts a vertex on the edge of `h` at parameter t; both incident faces
+        // gain a corner. Returns the new vertex.
+        std::uint32_t splitEdge(std::uint32_t h, float t = 0.5f);
+
+        // Extrudes the face along its normal by `distance`; returns the new cap face.
+        std::uint32_t extrudeFace(std::uint32_t face, float distance);
+
+        // Drops tombstoned faces/half-edges and unreferenced vertices/attributes.
+        void compact();
+
+    private:
+        // Empty faceSizes means every face is a triangle.
+        void build(const std::vector<Components::SVertex>& vertices,
+                   std::span<const std::uint32_t> faceSizes,
+                   std::span<const std::uint32_t> faceIndices);
+        std::uint32_t addAttribute(const Components::SVertex& vertex);
+        void linkTwins(std::uint32_t h);
+
+        std::vector<glm::vec3> m_points;               // topological vertex positions
+        std::vector<std::uint32_t> m_vertexHalfEdges;  // vertex -> an outgoing half-edge
+        std::vector<std::uint32_t> m_faces;            // face -> a half-edge (INVALID_INDEX when removed)
+        std::vector<SHalfEdge> m_halfEdges;
+        std::vector<Components::SVertex> m_attributes; // per-corner attributes
+    };
+
+} // namespace Kinetica::Geometry
+
+#endif
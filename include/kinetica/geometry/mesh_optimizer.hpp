@@ -0,0 +1,86 @@
+#ifndef KINETICA_GEOMETRY_MESH_OPTIMIZER_HPP
+#define KINETICA_GEOMETRY_MESH_OPTIMIZER_HPP
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../ecs/components/mesh.hpp"
+
+namespace Kinetica {
+    class CThreadPool;
+}
+
+namespace Kinetica::Geometry {
+
+    struct SMeshOptimizeSettings {
+        bool weld = true;
+        bool vertexCache = true;
+        bool overdraw = true;
+        bool vertexFetch = true;
+
+        // Welding merges vertices whose attributes all lie within these
+        // distances; a position tolerance of 0 welds exact duplicates only.
+        float positionTolerance = 0.0f;
+        float normalTolerance = 1e-3f;
+        float uvTolerance = 1e-5f;
+
+        // Overdraw ordering may worsen ACMR by at most this factor.
+        float overdrawThreshold = 1.05f;
+
+        // FIFO size used for the reported ACMR/ATVR.
+        std::uint32_t cacheSize = 16;
+    };
+
+    struct SMeshOptimizeStats {
+        std::uint32_t verticesBefore = 0;
+        std::uint32_t verticesAfter = 0;
+        std::uint32_t trianglesBefore = 0;
+        std::uint32_t trianglesAfter = 0; // degenerate triangles are dropped by welding
+        float acmrBefore = 0.0f;          // vertex shader invocations per triangle
+        float acmrAfter = 0.0f;
+        float atvrBefore = 0.0f;          // vertex shader invocations per vertex
+        float atvrAfter = 0.0f;
+        std::size_t bytesBefore = 0;      // CPU-side vertices + indices
+        std::size_t bytesAfter = 0;
+        double milliseconds = 0.0;
+    };
+
+    // ---- Individual passes ----
+
+    // Merges duplicate vertices and drops triangles that became degenerate.
+    // Returns the number of vertices removed.
+    std::uint32_t weldVertices(Components::SMesh& mesh, float positionTolerance, float normalTolerance,
+                               float uvTolerance);
+
+    // Reorders triangles for the post-transform vertex cache (Forsyth's
+    // linear-speed algorithm, simulated LRU of 32 entries).
+    void optimizeVertexCache(std::span<Components::SIndex> triangles, std::uint32_t vertexCount);
+
+    // Splits an already cache-optimized order into clusters and sorts them
+    // so outward-facing, outer clusters are drawn first (Sander et al.).
+    void optimizeOverdraw(std::span<Components::SIndex> triangles, std::span<const Components::SVertex> vertices,
+                          float threshold, std::uint32_t cacheSize = 16);
+
+    // Renumbers vertices in first-use order so fetches are sequential; drops
+    // unreferenced vertices.
+    void optimizeVertexFetch(Components::SMesh& mesh);
+
+    // Average cache miss ratio for a FIFO of `cacheSize` entries.
+    float computeACMR(std::span<const Components::SIndex> triangles, std::uint32_t vertexCount,
+                      std::uint32_t cacheSize = 16);
+
+    // ---- Pipeline ----
+
+    // Runs the enabled passes in order (weld, vertex cache, overdraw, vertex
+    // fetch) and marks the mesh for a full re-upload.
+    SMeshOptimizeStats optimizeMesh(Components::SMesh& mesh, const SMeshOptimizeSettings& settings = {});
+
+    // optimizeMesh() on every mesh, in parallel across meshes. `stats` is
+    // resized to one entry per mesh when given.
+    void optimizeMeshes(CThreadPool& pool, std::span<Components::SMesh* const> meshes,
+                        const SMeshOptimizeSettings& settings = {}, std::vector<SMeshOptimizeStats>* stats = nullptr);
+
+} // namespace Kinetica::Geometry
+
+#endif
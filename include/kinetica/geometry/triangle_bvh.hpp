@@ -0,0 +1,68 @@
+#ifndef KINETICA_GEOMETRY_TRIANGLE_BVH_HPP
+#define KINETICA_GEOMETRY_TRIANGLE_BVH_HPP
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../ecs/components/mesh.hpp"
+#include "../math/bounds.hpp"
+
+namespace Kinetica::Geometry {
+
+    struct SRayHit {
+        float t = 0.0f;
+        std::uint32_t triangle = 0;
+        float u = 0.0f; // barycentrics of corners b and c
+        float v = 0.0f;
+    };
+
+    // Static bounding volume hierarchy over the triangles of one SMesh, in the
+    // mesh's object space.
+    //
+    // build() uses a binned surface-area heuristic; refit() recomputes boxes
+    // bottom-up after vertices moved (topology unchanged). The BVH keeps no
+    // reference to the mesh, so queries take it again.
+    class CTriangleBVH {
+    public:
+        void build(const Components::SMesh& mesh);
+        void refit(const Components::SMesh& mesh);
+        void clear();
+
+        bool empty() const { return m_nodes.empty(); }
+        std::size_t nodeCount() const { return m_nodes.size(); }
+        std::size_t triangleCount() const { return m_triangles.size(); }
+        Math::SAABB bounds() const;
+
+        // Closest hit within (0, maxT].
+        bool intersect(const Components::SMesh& mesh, const Math::SRay& ray, float maxT, SRayHit& hit) const;
+        // Appends every hit within (0, maxT], unordered.
+        void intersectAll(const Components::SMesh& mesh, const Math::SRay& ray, float maxT, std::vector<SRayHit>& hits) const;
+
+        // Appends triangles not entirely behind one of the frustum planes, at most `limit`.
+        void overlapFrustum(const Components::SMesh& mesh, const Math::SFrustum& frustum, std::vector<std::uint32_t>& triangles,
+                            std::size_t limit = std::numeric_limits<std::size_t>::max()) const;
+
+    private:
+        struct SNode {
+            glm::vec3 min;
+            std::uint32_t leftFirst; // first child (inner) or first triangle (leaf)
+            glm::vec3 max;
+            std::uint32_t count;     // 0 for inner nodes; children are leftFirst and leftFirst + 1
+
+            bool isLeaf() const { return count != 0; }
+            Math::SAABB box() const { return {min, max}; }
+        };
+
+        template<typename Func>
+        void traverse(const Math::SRay& ray, float& maxT, Func&& leaf) const;
+
+        std::vector<SNode> m_nodes;
+        std::vector<std::uint32_t> m_triangles; // leaf ranges index this permutation
+    };
+
+} // namespace Kinetica::Geometry
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef KINETICA_IO_ASSET_LOADER_HPP
+#define KINETICA_IO_ASSET_LOADER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../ecs/registry.hpp"
+#include "../ecs/components/material.hpp"
+#include "../ecs/components/mesh.hpp"
+#include "../ecs/components/transform.hpp"
+#include "../geometry/mesh_optimizer.hpp"
+
+namespace Kinetica {
+    class IRenderBackend;
+    class CTransformHierarchy;
+}
+
+namespace Kinetica::IO {
+
+    enum class ELoadState : std::uint8_t {
+        Queued,
+        Loading,
+        Done,
+        Failed,
+        Cancelled,
+    };
+
+    struct SLoadProgress {
+        ELoadState state = ELoadState::Failed;
+        std::uint64_t fileBytes = 0;
+        std::uint64_t bytesDecoded = 0;  // geometry decoded on the loader threads
+        std::uint64_t bytesUploaded = 0; // geometry handed to the renderer
+        std::uint32_t entitiesTotal = 0;
+        std::uint32_t entitiesCreated = 0;
+
+        float fraction() const {
+            if (state == ELoadState::Done) return 1.0f;
+            return entitiesTotal > 0 ? float(entitiesCreated) / float(entitiesTotal) : 0.0f;
+        }
+    };
+
+    struct SLoadOptions {
+        bool optimizeMeshes = false; // run the mesh optimizer on the loader thread
+        Geometry::SMeshOptimizeSettings optimize;
+    };
+
+    // Per-frame limits for CAssetLoader::update. At least one entity is
+    // created per call, so a mesh larger than the budget still gets through.
+    struct SUploadBudget {
+        std::size_t bytes = std::size_t(32) << 20;
+        double milliseconds = 4.0;
+    };
+
+    // Loads scene files in the background and feeds the results to the render
+    // thread a few at a time.
+    //
+    // Loader threads map, decode and post-process files into self-contained
+    // entities; update() on the render thread creates them, uploads their
+    // meshes and links parents, within a byte/time budget. Decoding stalls once
+    // `maxQueuedBytes` are waiting, so a large file never sits in memory whole.
+    //
+    // The loader owns its threads rather than using CThreadPool: a thread that
+    // waits on the pool runs whatever is queued, and a decode task picked up
+    // by the render thread would stall the frame.
+    class CAssetLoader {
+    public:
+        using LoadHandle = std::uint32_t;
+        static constexpr LoadHandle INVALID_LOAD = 0;
+
+        explicit CAssetLoader(std::size_t threadCount = 2, std::size_t maxQueuedBytes = std::size_t(256) << 20);
+        ~CAssetLoader();
+
+        CAssetLoader(const CAssetLoader&) = delete;
+        CAssetLoader& operator=(const CAssetLoader&) = delete;
+
+        LoadHandle load(const std::string& path, const SLoadOptions& options = {});
+
+        // Stops decoding and drops what has not been created yet. Entities
+        // already in the scene stay.
+        void cancel(LoadHandle handle);
+        void cancelAll();
+
+        SLoadProgress progress(LoadHandle handle) const;
+        // True when nothing is queued, decoding or waiting for upload.
+        bool isIdle() const;
+
+        // Render thread. Creates pending entities and uploads their meshes
+        // through `renderer` (if any). Returns the number of entities created.
+        std::size_t update(CRegistry& registry, CTransformHierarchy* hierarchy, IRenderBackend* renderer,
+                           const SUploadBudget& budget = {});
+
+    private:
+        struct SPendingEntity {
+            LoadHandle request = INVALID_LOAD;
+            std::uint32_t fileIndex = 0;
+            std::uint32_t parent = 0xFFFFFFFFu; // file index
+            std::array<std::uint8_t, 16> uuid{};
+            bool hasTransform = false;
+            bool hasMesh = false;
+            bool hasMaterial = false;
+            Components::STransform transform;
+            Components::SMesh mesh;
+            Components::SMaterial material;
+            std::size_t bytes = 0;
+        };
+
+        struct SRequest {
+            std::string path;
+            SLoadOptions options;
+            std::atomic<ELoadState> state{ELoadState::Queued};
+            std::atomic<bool> cancelled{false};
+            std::atomic<bool> decodeFinished{false};
+            std::atomic<std::uint64_t> fileBytes{0};
+            std::atomic<std::uint64_t> bytesDecoded{0};
+            std::atomic<std::uint64_t> bytesUploaded{0};
+            std::atomic<std::uint32_t> entitiesTotal{0};
+            std::atomic<std::uint32_t> entitiesCreated{0};
+            std::uint32_t queued = 0; // entities in m_pending, guarded by m_mutex
+
+            // Render thread only.
+            std::vector<EntityID> entities;                                // by file index
+            std::unordered_multimap<std::uint32_t, std::uint32_t> orphans; // parent -> children waiting for it
+            std::size_t duplicateUuids = 0;
+            std::chrono::steady_clock::time_point start;
+        };
+
+        void workerLoop();
+        void decode(LoadHandle handle, SRequest& request);
+        void decodeImport(LoadHandle handle, SRequest& request);
+        bool push(SPendingEntity&& entity, SRequest& request);
+        void create(SPendingEntity& pending, SRequest& request, CRegistry& registry, CTransformHierarchy* hierarchy,
+                    IRenderBackend* renderer);
+        void finishRequests();
+        SRequest* find(LoadHandle handle) const;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_workAvailable;
+        std::condition_variable m_spaceAvailable;
+        std::vector<std::unique_ptr<SRequest>> m_requests; // handle - 1
+        std::deque<LoadHandle> m_queue;                    // requests waiting for a loader thread
+        std::deque<SPendingEntity> m_pending;
+        std::size_t m_pendingBytes = 0;
+        std::size_t m_maxQueuedBytes;
+        std::size_t m_busyWorkers = 0;
+        bool m_bStop = false;
+        std::vector<std::thread> m_workers;
+    };
+
+} // namespace Kinetica::IO
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef KINETICA_IO_BATCH_PROCESSOR_HPP
+#define KINETICA_IO_BATCH_PROCESSOR_HPP
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../geometry/mesh_optimizer.hpp"
+
+namespace Kinetica::IO {
+
+    enum class EBatchStep : std::uint8_t { Import, Validate, Optimize, Export, Thumbnail, Count };
+
+    const char* batchStepName(EBatchStep step);
+
+    // Parses "import,optimize,export" style lists. Import is implied when the
+    // list does not start with it. Returns false on an unknown step.
+    bool parseBatchPipeline(const std::string& text, std::vector<EBatchStep>& out);
+
+    struct SBatchOptions {
+        std::vector<EBatchStep> pipeline{EBatchStep::Import, EBatchStep::Validate};
+        // Export writes <outputDir>/<stem>.kin and Thumbnail <outputDir>/<stem>.png;
+        // empty writes next to the input.
+        std::string outputDir;
+        // Square thumbnail edge in pixels, rendered on the CPU.
+        std::uint32_t thumbnailSize = 512;
+        // Files processed at once; 0 uses one per hardware thread.
+        std::size_t jobs = 0;
+        // A file is only started while the estimated working set of the files
+        // in flight stays below this. One file is always admitted.
+        std::size_t memoryBudget = std::size_t(4) << 30;
+        Geometry::SMeshOptimizeSettings optimize;
+    };
+
+    struct SBatchFileResult {
+        std::string path;
+        bool ok = false;
+        std::vector<std::string> messages; // errors and validation findings
+        std::array<double, std::size_t(EBatchStep::Count)> stepMilliseconds{};
+        double waitMilliseconds = 0.0;     // blocked on the memory budget
+        std::uint64_t fileBytes = 0;
+        std::size_t objects = 0;
+        std::size_t meshes = 0;
+        std::size_t vertices = 0;
+        std::size_t triangles = 0;
+    };
+
+    struct SBatchSummary {
+        std::size_t succeeded = 0;
+        std::size_t failed = 0;
+        std::size_t jobs = 0;
+        std::uint64_t bytes = 0;
+        double wallMilliseconds = 0.0;
+        std::array<double, std::size_t(EBatchStep::Count)> stepMilliseconds{}; // summed over files
+    };
+
+    // Called once per file as it finishes, from a worker thread; calls are
+    // serialized.
+    using BatchCallback = std::function<void(const SBatchFileResult&)>;
+
+    // Runs the pipeline over `files` concurrently without touching any
+    // window or GL state. Files are parsed with intra-file parallelism on a
+    // shared pool, so a few large files still use every core.
+    SBatchSummary runBatch(const std::vector<std::string>& files, const SBatchOptions& options,
+                           const BatchCallback& onFile = {});
+
+    std::string formatBatchResult(const SBatchFileResult& result);
+    std::string formatBatchSummary(const SBatchSummary& summary);
+
+} // namespace Kinetica::IO
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef KINETICA_IO_IMPORTER_HPP
+#define KINETICA_IO_IMPORTER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../ecs/registry.hpp"
+#include "../ecs/components/material.hpp"
+#include "../ecs/components/mesh.hpp"
+#include "../ecs/components/transform.hpp"
+
+namespace Kinetica {
+    class CThreadPool;
+    class CTransformHierarchy;
+}
+
+namespace Kinetica::IO {
+
+    constexpr std::uint32_t IMPORT_NONE = 0xFFFFFFFFu;
+
+    struct SImportOptions {
+        // Worker pool for chunked parsing and per-mesh work. Without one the
+        // importer runs a temporary pool of its own.
+        CThreadPool* pool = nullptr;
+        // OBJ files are split into line-aligned chunks of about this size.
+        std::size_t chunkBytes = std::size_t(8) << 20;
+    };
+
+    // One entity to create: meshes carry at most one material, so an OBJ
+    // object with several `usemtl` runs becomes several objects.
+    struct SImportedObject {
+        std::string name;
+        Components::STransform transform;
+        bool hasMesh = false;
+        Components::SMesh mesh;
+        std::uint32_t material = IMPORT_NONE; // into SImportResult::materials
+        std::uint32_t parent = IMPORT_NONE;   // into SImportResult::objects
+    };
+
+    struct SImportResult {
+        std::vector<SImportedObject> objects;
+        std::vector<Components::SMaterial> materials;
+    };
+
+    // Wavefront OBJ (+ MTL). Faces are fan-triangulated; vertices are
+    // deduplicated by (position, uv, normal) index; missing normals are
+    // generated smooth.
+    bool importObj(const std::string& path, SImportResult& out, const SImportOptions& options = {});
+
+    // glTF 2.0, .gltf (external or data: URI buffers) or .glb. Triangle
+    // primitives only; nodes keep their hierarchy and TRS.
+    bool importGltf(const std::string& path, SImportResult& out, const SImportOptions& options = {});
+
+    // Dispatches on the extension (.obj, .gltf, .glb).
+    bool importFile(const std::string& path, SImportResult& out, const SImportOptions& options = {});
+    bool isImportable(const std::string& path);
+
+    // Creates the entities (moving the meshes out of `result`) and links
+    // parents through `hierarchy` when given. Returns them in object order.
+    std::vector<EntityID> instantiate(SImportResult& result, CRegistry& registry,
+                                      CTransformHierarchy* hierarchy = nullptr);
+
+} // namespace Kinetica::IO
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef KINETICA_IO_KIN_FILE_HPP
+#define KINETICA_IO_KIN_FILE_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "kin_format.hpp"
+#include "mapped_file.hpp"
+#include "../ecs/registry.hpp"
+#include "../ecs/components/material.hpp"
+#include "../math/bounds.hpp"
+
+namespace Kinetica {
+    class CTransformHierarchy;
+}
+
+namespace Kinetica::IO {
+
+    struct SKinMeshView {
+        std::span<const Components::SVertex> vertices;
+        std::span<const Components::SIndex> indices;
+        Math::SAABB bounds;
+    };
+
+    // Zero-copy view of a .kin file. open() maps the file and validates the
+    // header and section table; every accessor points into the mapping, which
+    // stays valid until close() or destruction.
+    class CKinReader {
+    public:
+        bool open(const std::string& path);
+        void close();
+        bool isOpen() const { return m_file.isOpen(); }
+        std::size_t fileSize() const { return m_file.size(); }
+
+        std::span<const SKinEntity> entities() const { return m_entities; }
+        std::span<const SKinTransform> transforms() const { return m_transforms; }
+        std::span<const SKinMaterial> materials() const { return m_materials; }
+        std::span<const SKinMesh> meshes() const { return m_meshes; }
+
+        SKinMeshView mesh(std::uint32_t index) const;
+        Components::SMaterial material(std::uint32_t index) const;
+
+        // Creates one entity per record with its components; meshes are
+        // copied into SMesh, which owns editable geometry. Parents are linked
+        // through `hierarchy` when given. Returns the entities in file order.
+        std::vector<EntityID> instantiate(CRegistry& registry, CTransformHierarchy* hierarchy = nullptr) const;
+
+    private:
+        template<typename T>
+        bool bindSection(const SKinSection& section, std::span<const T>& out);
+        bool validate();
+
+        CMappedFile m_file;
+        std::span<const std::uint8_t> m_geometry;
+        std::span<const SKinEntity> m_entities;
+        std::span<const SKinTransform> m_transforms;
+        std::span<const SKinMaterial> m_materials;
+        std::span<const SKinMesh> m_meshes;
+        std::span<const char> m_strings;
+    };
+
+    // Streaming .kin writer. Geometry goes to disk as soon as it is added; only
+    // the small per-entity tables are kept until finish().
+    class CKinWriter {
+    public:
+        CKinWriter() = default;
+        ~CKinWriter();
+
+        CKinWriter(const CKinWriter&) = delete;
+        CKinWriter& operator=(const CKinWriter&) = delete;
+
+        bool open(const std::string& path);
+        bool isOpen() const { return m_stream.is_open(); }
+
+        // Each returns the record's index, or KIN_NONE on failure.
+        std::uint32_t addMesh(std::span<const Components::SVertex> vertices,
+                              std::span<const Components::SIndex> indices, const Math::SAABB& bounds);
+        std::uint32_t addMaterial(const Components::SMaterial& material);
+        std::uint32_t addEntity(const CUUID& uuid, const Components::STransform* transform,
+                                std::uint32_t parent = KIN_NONE, std::uint32_t mesh = KIN_NONE,
+                                std::uint32_t material = KIN_NONE);
+
+        // Writes the tables and section table, patches the header and closes
+        // the file. Without it the file is left invalid (zero magic).
+        bool finish();
+
+    private:
+        bool writeAligned(const void* data, std::size_t size);
+        template<typename T>
+        void writeSection(EKinSection type, const std::vector<T>& records);
+
+        std::ofstream m_stream;
+        std::string m_path;
+        std::uint64_t m_position = 0;
+        std::uint64_t m_geometryBegin = 0;
+        std::vector<SKinEntity> m_entities;
+        std::vector<SKinTransform> m_transforms;
+        std::vector<SKinMaterial> m_materials;
+        std::vector<SKinMesh> m_meshes;
+        std::vector<char> m_strings;
+        std::vector<SKinSection> m_sections;
+        bool m_bFailed = false;
+    };
+
+    // Writes every entity with its transform, mesh, material and parent link.
+    bool saveScene(CRegistry& registry, const std::string& path);
+
+    // Opens `path` and instantiates it into `registry`.
+    bool loadScene(const std::string& path, CRegistry& registry, CTransformHierarchy* hierarchy = nullptr);
+
+} // namespace Kinetica::IO
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef KINETICA_IO_KIN_FORMAT_HPP
+#define KINETICA_IO_KIN_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../ecs/components/mesh.hpp"
+#include "../ecs/components/transform.hpp"
+
+// On-disk layout of .kin scene files.
+//
+//   SKinHeader (64 bytes)
+//   geometry payload   vertices and indices, each range 16-byte aligned
+//   tables             entities, transforms, materials, meshes, strings
+//   section table      SKinSection[sectionCount]
+//
+// Records are little-endian PODs whose layout matches the in-memory types, so
+// a mapped file is used in place. The geometry payload comes first so the
+// writer can stream it; the small tables and the section table follow.
+namespace Kinetica::IO {
+
+    constexpr std::uint32_t KIN_MAGIC = 0x314E494Bu;       // "KIN1"
+    constexpr std::uint32_t KIN_VERSION = 1;
+    constexpr std::uint32_t KIN_BYTE_ORDER = 0x01020304u;  // reads back swapped on big-endian hosts
+    constexpr std::uint32_t KIN_NONE = 0xFFFFFFFFu;
+    constexpr std::size_t KIN_PAYLOAD_ALIGNMENT = 16;
+
+    enum class EKinSection : std::uint32_t {
+        Geometry = 1,   // raw bytes, addressed by SKinMesh offsets
+        Entities = 2,   // SKinEntity
+        Transforms = 3, // SKinTransform, parallel to Entities
+        Materials = 4,  // SKinMaterial
+        Meshes = 5,     // SKinMesh
+        Strings = 6,    // UTF-8, addressed by offset/length
+    };
+
+    struct SKinHeader {
+        std::uint32_t magic = KIN_MAGIC;
+        std::uint32_t version = KIN_VERSION;
+        std::uint32_t byteOrder = KIN_BYTE_ORDER;
+        std::uint32_t sectionCount = 0;
+        std::uint64_t sectionTableOffset = 0;
+        std::uint64_t fileSize = 0;
+        std::uint8_t reserved[32] = {};
+    };
+
+    struct SKinSection {
+        EKinSection type;
+        std::uint32_t elementSize; // 1 for raw sections
+        std::uint64_t offset;
+        std::uint64_t size;        // in bytes
+    };
+
+    enum EKinComponent : std::uint32_t {
+        KIN_COMPONENT_TRANSFORM = 1u << 0,
+        KIN_COMPONENT_MESH = 1u << 1,
+        KIN_COMPONENT_MATERIAL = 1u << 2,
+    };
+
+    struct SKinEntity {
+        std::uint8_t uuid[16];
+        std::uint32_t components; // EKinComponent bits
+        std::uint32_t parent;     // entity index or KIN_NONE
+        std::uint32_t mesh;       // mesh index or KIN_NONE
+        std::uint32_t material;   // material index or KIN_NONE
+    };
+
+    // The leading, persistent part of STransform.
+    struct SKinTransform {
+        float position[3];
+        float rotation[3];
+        float scale[3];
+    };
+
+    struct SKinMaterial {
+        float baseColor[3];
+        float metallic;
+        float roughness;
+        std::uint32_t useVertexColor;
+        std::uint32_t nameOffset; // into Strings
+        std::uint32_t nameLength;
+    };
+
+    struct SKinMesh {
+        std::uint64_t vertexOffset; // bytes from the start of the Geometry section
+        std::uint64_t indexOffset;
+        std::uint32_t vertexCount;
+        std::uint32_t triangleCount;
+        float boundsMin[3];
+        float boundsMax[3];
+    };
+
+    static_assert(sizeof(SKinHeader) == 64);
+    static_assert(sizeof(SKinSection) == 24);
+    static_assert(sizeof(SKinEntity) == 32);
+    static_assert(sizeof(SKinTransform) == 36);
+    static_assert(sizeof(SKinMaterial) == 32);
+    static_assert(sizeof(SKinMesh) == 48);
+
+    // Geometry is used straight from the mapping.
+    static_assert(sizeof(Components::SVertex) == 32 && alignof(Components::SVertex) <= KIN_PAYLOAD_ALIGNMENT);
+    static_assert(sizeof(Components::SIndex) == 12 && alignof(Components::SIndex) <= KIN_PAYLOAD_ALIGNMENT);
+    static_assert(offsetof(Components::STransform, position) == offsetof(SKinTransform, position) &&
+                  offsetof(Components::STransform, rotation) == offsetof(SKinTransform, rotation) &&
+                  offsetof(Components::STransform, scale) == offsetof(SKinTransform, scale));
+
+} // namespace Kinetica::IO
+
+#endif
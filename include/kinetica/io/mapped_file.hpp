@@ -0,0 +1,43 @@
+#ifndef KINETICA_IO_MAPPED_FILE_HPP
+#define KINETICA_IO_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Kinetica::IO {
+
+    // Read-only memory mapping of a whole file. Pages are faulted in on first
+    // touch, so opening costs the same for any file size.
+    class CMappedFile {
+    public:
+        CMappedFile() = default;
+        ~CMappedFile();
+
+        CMappedFile(const CMappedFile&) = delete;
+        CMappedFile& operator=(const CMappedFile&) = delete;
+        CMappedFile(CMappedFile&& other) noexcept;
+        CMappedFile& operator=(CMappedFile&& other) noexcept;
+
+        bool open(const std::string& path);
+        void close();
+
+        bool isOpen() const { return m_data != nullptr; }
+        const std::uint8_t* data() const { return m_data; }
+        std::size_t size() const { return m_size; }
+
+        // Hints that [offset, offset + size) will be read soon.
+        void prefetch(std::size_t offset, std::size_t size) const;
+
+    private:
+        const std::uint8_t* m_data = nullptr;
+        std::size_t m_size = 0;
+#ifdef _WIN32
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#endif
+    };
+
+} // namespace Kinetica::IO
+
+#endif
@@ -1,34 +1,15 @@
 #ifndef KINETICA_LOG_HPP
 #define KINETICA_LOG_HPP
 
-#include <iostream>
-#include <string>
-#include <sstream>
-#include <chrono>
-#include <thread>
-
-// ---- Terminal detection ----
-#ifdef _WIN32
-#include <io.h>
-#define K_IS_TERMINAL _isatty(_fileno(stdout))
-#else
-#include <unistd.h>
-#define K_IS_TERMINAL isatty(STDOUT_FILENO)
-#endif
-
-// ---- C++20 source_location support ----
-#if __cplusplus >= 202002L && !defined(__apple_build_version__) // Apple Clang lags
-#include <source_location>
-#define K_HAVE_SOURCE_LOCATION 1
-#else
-#define K_HAVE_SOURCE_LOCATION 0
-#endif
-
-// ---- enable timestamps ----
-#define K_LOG_TIMESTAMPS
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
 
 namespace Kinetica::Log {
 
+    enum class ELogLevel : std::uint8_t { Debug, Info, Warn, Error, Off };
+
     // ---- ANSI color definitions (your brand palette) ----
     namespace Color {
         constexpr const char* reset     = "\033[0m";
@@ -39,132 +20,54 @@ namespace Kinetica::Log {
         constexpr const char* error     = "\033[38;2;255;85;85m";   // soft red
     }
 
-    // ---- Helper: current time as HH:MM:SS.mmm ----
-    #ifdef K_LOG_TIMESTAMPS
-    inline std::string timestamp() {
-        auto now = std::chrono::system_clock::now();
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-        std::time_t t = std::chrono::system_clock::to_time_t(now);
-        std::tm tm = *std::localtime(&t);
-        char buf[20];
-        std::strftime(buf, sizeof(buf), "%H:%M:%S", &tm);
-        return std::string(buf) + "." + std::to_string(ms.count());
+    namespace Detail {
+#ifdef KINETICA_DEBUG_LOG
+        inline std::atomic<ELogLevel> s_level{ELogLevel::Debug};
+#else
+        inline std::atomic<ELogLevel> s_level{ELogLevel::Warn};
+#endif
     }
-    #endif
-
-    // ---- Core logging function (C++20 version) ----
-    #if K_HAVE_SOURCE_LOCATION
-    template<typename... Args>
-    inline void log_impl(const char* level, const char* color,
-                         const std::string& fmt, std::source_location loc = std::source_location::current()) {
-        std::ostringstream oss;
-        #ifdef K_LOG_TIMESTAMPS
-        oss << "[" << timestamp() << "] ";
-        #endif
-        oss << fmt;
-
-        if (K_IS_TERMINAL) {
-            std::cout << Color::kinetica << "[ KINETICA ] " << Color::reset
-            << color << level << Color::reset << " "
-            << loc.file_name() << ":" << loc.line()
-            << " - " << oss.str() << "\n";
-        } else {
-            std::cout << "[ KINETICA ] " << level << " "
-            << loc.file_name() << ":" << loc.line()
-            << " - " << oss.str() << "\n";
-        }
-                         }
-                         #endif
-
-                         // ---- Core logging function (pre-C++20 fallback) ----
-                         template<typename... Args>
-                         inline void log_impl(const char* level, const char* color,
-                                              const std::string& fmt, const char* file, int line) {
-                             std::ostringstream oss;
-                             #ifdef K_LOG_TIMESTAMPS
-                             oss << "[" << timestamp() << "] ";
-                             #endif
-                             oss << fmt;
 
-                             if (K_IS_TERMINAL) {
-                                 std::cout << Color::kinetica << "[ KINETICA ] " << Color::reset
-                                 << color << level << Color::reset << " "
-                                 << file << ":" << line
-                                 << " - " << oss.str() << "\n";
-                             } else {
-                                 std::cout << "[ KINETICA ] " << level << " "
-                                 << file << ":" << line
-                                 << " - " << oss.str() << "\n";
-                             }
-                                              }
+    // The KLOG_* macros check this before evaluating their message.
+    inline bool enabled(ELogLevel level) { return level >= Detail::s_level.load(std::memory_order_relaxed); }
+
+    void setLevel(ELogLevel level);
+    ELogLevel level();
+    const char* levelName(ELogLevel level);
+    // "debug", "info", "warn", "error" or "off".
+    bool parseLevel(std::string_view text, ELogLevel& out);
+
+    // Copies the record into the calling thread's ring buffer; a background
+    // thread formats and writes it. When the ring is full, Warn and Error wait
+    // for space and Debug and Info are dropped. `file` must be a literal.
+    void write(ELogLevel level, const char* file, std::uint32_t line, std::string_view message);
+
+    // Blocks until everything written before the call has been output.
+    void flush();
+    // Drains the rings and stops the background thread; later messages are
+    // written synchronously. Runs at exit.
+    void shutdown();
+    // stdout by default. Applies to records formatted after the call.
+    void setOutput(std::FILE* file);
+
+    struct SLogStats {
+        std::uint64_t written = 0; // formatted and output
+        std::uint64_t dropped = 0; // Debug/Info lost to a full ring
+        std::uint64_t blocked = 0; // Warn/Error that had to wait for space
+    };
+    SLogStats stats();
 
 } // namespace Kinetica::Log
 
 // ---- Macros: DEBUG/INFO/WARN/ERROR ----
-
-#ifdef KINETICA_DEBUG_LOG
-// Debug builds: all levels enabled
-#if K_HAVE_SOURCE_LOCATION
-#define KLOG_DEBUG(fmt) ::Kinetica::Log::log_impl("DEBUG", ::Kinetica::Log::Color::debug, fmt)
-#define KLOG_INFO(fmt)  ::Kinetica::Log::log_impl("INFO",  ::Kinetica::Log::Color::info,  fmt)
-#define KLOG_WARN(fmt)  ::Kinetica::Log::log_impl("WARN",  ::Kinetica::Log::Color::warn,  fmt)
-#define KLOG_ERROR(fmt) ::Kinetica::Log::log_impl("ERROR", ::Kinetica::Log::Color::error, fmt)
-#else
-#define KLOG_DEBUG(fmt) ::Kinetica::Log::log_impl("DEBUG", ::Kinetica::Log::Color::debug, fmt, __FILE__, __LINE__)
-#define KLOG_INFO(fmt)  ::Kinetica::Log::log_impl("INFO",  ::Kinetica::Log::Color::info,  fmt, __FILE__, __LINE__)
-#define KLOG_WARN(fmt)  ::Kinetica::Log::log_impl("WARN",  ::Kinetica::Log::Color::warn,  fmt, __FILE__, __LINE__)
-#define KLOG_ERROR(fmt) ::Kinetica::Log::log_impl("ERROR", ::Kinetica::Log::Color::error, fmt, __FILE__, __LINE__)
-#endif
-#else
-// Release builds: only WARN/ERROR
-#if K_HAVE_SOURCE_LOCATION
-#define KLOG_DEBUG(fmt) (void)0
-#define KLOG_INFO(fmt)  (void)0
-#define KLOG_WARN(fmt)  ::Kinetica::Log::log_impl("WARN",  "", fmt)
-#define KLOG_ERROR(fmt) ::Kinetica::Log::log_impl("ERROR", "", fmt)
-#else
-#define KLOG_DEBUG(fmt) (void)0
-#define KLOG_INFO(fmt)  (void)0
-#define KLOG_WARN(fmt)  ::Kinetica::Log::log_impl("WARN",  "", fmt, __FILE__, __LINE__)
-#define KLOG_ERROR(fmt) ::Kinetica::Log::log_impl("ERROR", "", fmt, __FILE__, __LINE__)
-#endif
-#endif
-
-// ---- Formatted logging helper (C++17 and above) ----
-// Usage: KLOG_DEBUG_F("Loaded {} models in {:.2f}s", count, elapsed);
-#if __cplusplus >= 201703L
-#include <fmt/core.h>
-#undef KLOG_DEBUG
-#undef KLOG_INFO
-#undef KLOG_WARN
-#undef KLOG_ERROR
-
-// ---- Public macros ----
-#ifdef KINETICA_DEBUG_LOG
-#if K_HAVE_SOURCE_LOCATION
-#define KLOG_DEBUG(msg) ::Kinetica::Log::log_impl("DEBUG", ::Kinetica::Log::Color::debug, std::string(msg))
-#define KLOG_INFO(msg)  ::Kinetica::Log::log_impl("INFO",  ::Kinetica::Log::Color::info,  std::string(msg))
-#define KLOG_WARN(msg)  ::Kinetica::Log::log_impl("WARN",  ::Kinetica::Log::Color::warn,  std::string(msg))
-#define KLOG_ERROR(msg) ::Kinetica::Log::log_impl("ERROR", ::Kinetica::Log::Color::error, std::string(msg))
-    #else
-        #define KLOG_DEBUG(msg) ::Kinetica::Log::log_impl("DEBUG", ::Kinetica::Log::Color::debug, std::string(msg), __FILE__, __LINE__)
-        #define KLOG_INFO(msg)  ::Kinetica::Log::log_impl("INFO",  ::Kinetica::Log::Color::info,  std::string(msg), __FILE__, __LINE__)
-        #define KLOG_WARN(msg)  ::Kinetica::Log::log_impl("WARN",  ::Kinetica::Log::Color::warn,  std::string(msg), __FILE__, __LINE__)
-        #define KLOG_ERROR(msg) ::Kinetica::Log::log_impl("ERROR", ::Kinetica::Log::Color::error, std::string(msg), __FILE__, __LINE__)
-    #endif
-#else
-    #if K_HAVE_SOURCE_LOCATION
-        #define KLOG_DEBUG(msg) (void)0
-        #define KLOG_INFO(msg)  (void)0
-        #define KLOG_WARN(msg)  ::Kinetica::Log::log_impl("WARN",  "", std::string(msg))
-        #define KLOG_ERROR(msg) ::Kinetica::Log::log_impl("ERROR", "", std::string(msg))
-    #else
-        #define KLOG_DEBUG(msg) (void)0
-        #define KLOG_INFO(msg)  (void)0
-        #define KLOG_WARN(msg)  ::Kinetica::Log::log_impl("WARN",  "", std::string(msg), __FILE__, __LINE__)
-        #define KLOG_ERROR(msg) ::Kinetica::Log::log_impl("ERROR", "", std::string(msg), __FILE__, __LINE__)
-    #endif
-#endif
-#endif
+// The message (anything convertible to std::string_view) is not evaluated
+// when the level is filtered out.
+#define KINETICA_LOG_AT(level, msg)                                                                   \
+    (::Kinetica::Log::enabled(level) ? ::Kinetica::Log::write(level, __FILE__, __LINE__, (msg)) : void(0))
+
+#define KLOG_DEBUG(msg) KINETICA_LOG_AT(::Kinetica::Log::ELogLevel::Debug, msg)
+#define KLOG_INFO(msg)  KINETICA_LOG_AT(::Kinetica::Log::ELogLevel::Info,  msg)
+#define KLOG_WARN(msg)  KINETICA_LOG_AT(::Kinetica::Log::ELogLevel::Warn,  msg)
+#define KLOG_ERROR(msg) KINETICA_LOG_AT(::Kinetica::Log::ELogLevel::Error, msg)
 
 #endif // KINETICA_LOG_HPP
@@ -0,0 +1,111 @@
+#ifndef KINETICA_MATH_BOUNDS_HPP
+#define KINETICA_MATH_BOUNDS_HPP
+
+#include <algorithm>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+namespace Kinetica::Math {
+
+    // Points are origin + t * direction; direction need not be normalized, so a
+    // ray keeps its parameter under affine transforms.
+    struct SRay {
+        glm::vec3 origin{0.0f};
+        glm::vec3 direction{0.0f, 0.0f, -1.0f};
+        glm::vec3 invDirection{0.0f, 0.0f, -1.0f};
+
+        SRay() = default;
+        SRay(const glm::vec3& o, const glm::vec3& d)
+            : origin(o), direction(d), invDirection(1.0f / d.x, 1.0f / d.y, 1.0f / d.z) {}
+
+        glm::vec3 at(float t) const { return origin + direction * t; }
+
+        SRay transformed(const glm::mat4& m) const;
+
+        // Ray through a point in normalized device coordinates, from the near
+        // plane towards the far plane (t = 1 at the far plane).
+        static SRay fromNdc(const glm::mat4& viewProjection, float ndcX, float ndcY);
+    };
+
+    struct SAABB {
+        glm::vec3 min{ std::numeric_limits<float>::max()};
+        glm::vec3 max{-std::numeric_limits<float>::max()};
+
+        bool isEmpty() const { return min.x > max.x || min.y > max.y || min.z > max.z; }
+
+        glm::vec3 center() const { return (min + max) * 0.5f; }
+        glm::vec3 extent() const { return (max - min) * 0.5f; }
+
+        float surfaceArea() const {
+            const glm::vec3 d = max - min;
+            return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+        }
+
+        void expand(const glm::vec3& p) {
+            min = glm::vec3(std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z));
+            max = glm::vec3(std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z));
+        }
+
+        void expand(const SAABB& b) {
+            min = glm::vec3(std::min(min.x, b.min.x), std::min(min.y, b.min.y), std::min(min.z, b.min.z));
+            max = glm::vec3(std::max(max.x, b.max.x), std::max(max.y, b.max.y), std::max(max.z, b.max.z));
+        }
+
+        bool contains(const SAABB& b) const {
+            return min.x <= b.min.x && min.y <= b.min.y && min.z <= b.min.z &&
+                   b.max.x <= max.x && b.max.y <= max.y && b.max.z <= max.z;
+        }
+
+        bool overlaps(const SAABB& b) const {
+            return min.x <= b.max.x && b.min.x <= max.x && min.y <= b.max.y && b.min.y <= max.y &&
+                   min.z <= b.max.z && b.min.z <= max.z;
+        }
+
+        // Slab test; on a hit within [0, maxT], tEntry is where the ray enters (0 if inside).
+        bool intersects(const SRay& ray, float maxT, float& tEntry) const {
+            const float tx0 = (min.x - ray.origin.x) * ray.invDirection.x, tx1 = (max.x - ray.origin.x) * ray.invDirection.x;
+            const float ty0 = (min.y - ray.origin.y) * ray.invDirection.y, ty1 = (max.y - ray.origin.y) * ray.invDirection.y;
+            const float tz0 = (min.z - ray.origin.z) * ray.invDirection.z, tz1 = (max.z - ray.origin.z) * ray.invDirection.z;
+            const float tNear = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), 0.0f));
+            const float tFar = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::min(std::max(tz0, tz1), maxT));
+            tEntry = tNear;
+            return tNear <= tFar;
+        }
+
+        static SAABB merged(const SAABB& a, const SAABB& b) {
+            SAABB r = a;
+            r.expand(b);
+            return r;
+        }
+
+        // Bounds of this box under an affine transform (Arvo: centre moves with
+        // the matrix, extent with its absolute value).
+        SAABB transformed(const glm::mat4& m) const;
+    };
+
+    enum class EContainment {
+        Outside,
+        Intersects,
+        Inside,
+    };
+
+    // Six normalized planes (left, right, bottom, top, near, far) pointing inwards,
+    // stored as structure-of-arrays for the SIMD box test. Slots 6 and 7 hold
+    // planes that every box is inside of.
+    struct SFrustum {
+        alignas(16) float nx[8];
+        alignas(16) float ny[8];
+        alignas(16) float nz[8];
+        alignas(16) float d[8];
+
+        // Gribb/Hartmann extraction from projection * view.
+        static SFrustum fromMatrix(const glm::mat4& viewProjection);
+
+        EContainment classify(const SAABB& box) const;
+        bool intersects(const SAABB& box) const { return classify(box) != EContainment::Outside; }
+    };
+
+} // namespace Kinetica::Math
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef KINETICA_MATH_TRANSFORM_BATCH_HPP
+#define KINETICA_MATH_TRANSFORM_BATCH_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../ecs/components/transform.hpp"
+
+namespace Kinetica::Math {
+
+    // Structure-of-arrays view over position / euler rotation / scale.
+    struct STransformSoA {
+        const float* px; const float* py; const float* pz;
+        const float* rx; const float* ry; const float* rz;
+        const float* sx; const float* sy; const float* sz;
+    };
+
+    // Owning SoA scratch, filled from STransform components.
+    struct STransformSoABuffer {
+        std::vector<float> px, py, pz, rx, ry, rz, sx, sy, sz;
+
+        void resize(std::size_t count);
+        void set(std::size_t i, const Components::STransform& transform);
+        STransformSoA view() const;
+    };
+
+    enum class ESimdLevel {
+        Scalar,
+        SSE2,
+        AVX2,
+    };
+
+    // Widest kernel supported by this CPU (and this build).
+    ESimdLevel activeSimdLevel();
+    const char* simdLevelName(ESimdLevel level);
+
+    // out[i] = translate(p) * rotateZ(rz) * rotateY(ry) * rotateX(rx) * scale(s),
+    // i.e. exactly what STransform::getMatrix() builds, written directly instead
+    // of through five 4x4 multiplies. Dispatches to the widest available kernel.
+    void composeTRS(const STransformSoA& in, glm::mat4* out, std::size_t count);
+
+    // Forces a specific kernel (falls back to scalar if unsupported). For tests/benchmarks.
+    void composeTRS(const STransformSoA& in, glm::mat4* out, std::size_t count, ESimdLevel level);
+
+} // namespace Kinetica::Math
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef KINETICA_PROFILER_HPP
+#define KINETICA_PROFILER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Set by the build (KINETICA_ENABLE_PROFILER). Without it every KPROFILE_*
+// macro expands to nothing; the functions below stay callable and report an
+// empty profile.
+#ifndef KINETICA_PROFILE
+#define KINETICA_PROFILE 0
+#endif
+
+namespace Kinetica::Profile {
+
+    inline std::uint64_t now() {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // Recording is off until enabled; a zone then costs two clock reads and
+    // a push into the thread's ring buffer.
+    void setEnabled(bool enabled);
+    bool enabled();
+
+    // Appends a finished zone to the calling thread's buffer. `name` must
+    // stay valid for the process lifetime (a literal or an interned name).
+    void record(const char* name, std::uint64_t begin, std::uint64_t end);
+    // GPU time of a pass submitted at `cpuBegin`, as read back from a timer query.
+    void recordGpu(const char* name, std::uint64_t cpuBegin, std::uint64_t duration);
+
+    // Stable copy of a runtime name, e.g. a system name.
+    const char* intern(std::string_view name);
+    void setThreadName(std::string_view name);
+
+    // Closes the frame: records a "Frame" zone since the previous call and
+    // moves every thread's zones into the rolling window. Calls must not
+    // overlap; they may come from different threads if serialized.
+    void endFrame();
+
+    struct SZoneStats {
+        std::string name;
+        bool gpu = false;
+        std::size_t count = 0;       // occurrences in the window
+        double perFrame = 0.0;       // average occurrences per frame
+        double minMs = 0.0;
+        double avgMs = 0.0;
+        double p99Ms = 0.0;
+        double maxMs = 0.0;
+    };
+
+    // Per-zone duration statistics over the last `frames` frames of the
+    // window, most time per frame first. GPU zones get a " (GPU)" suffix.
+    std::vector<SZoneStats> summarize(std::size_t frames = 300);
+    std::string formatSummary(const std::vector<SZoneStats>& zones);
+
+    // Chrome trace-event JSON (chrome://tracing, Perfetto) of the window.
+    bool writeChromeTrace(const std::string& path);
+
+    struct SProfileStats {
+        std::uint64_t zones = 0;   // collected
+        std::uint64_t dropped = 0; // lost to a full thread buffer
+    };
+    SProfileStats stats();
+
+    class CScopedZone {
+    public:
+        explicit CScopedZone(const char* name) : m_name(enabled() ? name : nullptr), m_begin(m_name ? now() : 0) {}
+        ~CScopedZone() {
+            if (m_name) record(m_name, m_begin, now());
+        }
+
+        CScopedZone(const CScopedZone&) = delete;
+        CScopedZone& operator=(const CScopedZone&) = delete;
+
+    private:
+        const char* m_name;
+        std::uint64_t m_begin;
+    };
+
+} // namespace Kinetica::Profile
+
+#define KINETICA_PROFILE_CONCAT_IMPL(a, b) a##b
+#define KINETICA_PROFILE_CONCAT(a, b) KINETICA_PROFILE_CONCAT_IMPL(a, b)
+
+#if KINETICA_PROFILE
+#define KPROFILE_SCOPE(name) \
+    ::Kinetica::Profile::CScopedZone KINETICA_PROFILE_CONCAT(kprofileZone, __LINE__)(name)
+#define KPROFILE_FRAME() ::Kinetica::Profile::endFrame()
+#define KPROFILE_THREAD(name) ::Kinetica::Profile::setThreadName(name)
+#else
+#define KPROFILE_SCOPE(name) static_cast<void>(0)
+#define KPROFILE_FRAME() static_cast<void>(0)
+#define KPROFILE_THREAD(name) static_cast<void>(0)
+#endif
+
+#endif // KINETICA_PROFILER_HPP
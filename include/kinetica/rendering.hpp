@@ -6,7 +6,10 @@
 #endif
 
 #include <GL/glew.h>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 
 #include <kinetica/ecs/registry.hpp>
@@ -15,21 +18,31 @@
 #include <kinetica/ecs/components/material.hpp>
 #include <kinetica/ecs/components/mesh.hpp>
 
+#include <kinetica/rendering/batching.hpp>
+#include <kinetica/rendering/geometry_arena.hpp>
+#include <kinetica/rendering/gpu_timer.hpp>
+#include <kinetica/rendering/render_backend.hpp>
+#include <kinetica/rendering/render_queue.hpp>
+#include <kinetica/rendering/vertex_format.hpp>
+
 #include <kinetica/window.hpp>
 
 namespace Kinetica {
 
-    class CRenderer {
+    // OpenGL backend.
+    class CRenderer : public IRenderBackend {
     public:
-        CRenderer(const Kinetica::CWindow& window);
-        ~CRenderer();
+        // Meshes are stored on the GPU in `format`; see SVertexFormat.
+        CRenderer(const Kinetica::CWindow& window, const SVertexFormat& format = SVertexFormat::compact());
+        ~CRenderer() override;
 
         CRenderer(const CRenderer&) = delete;
         CRenderer& operator=(const CRenderer&) = delete;
 
-        bool isValid() const { return m_bValid; }
-        void clear();
-        void present();
+        bool isValid() const override { return m_bValid; }
+        void clear() override;
+        // Call once per frame before the swap; reads back finished GPU timers.
+        void present() override;
 
         void renderEntity(
             const Components::STransform& transform,
@@ -37,15 +50,89 @@ namespace Kinetica {
             const Components::SMaterial& material
         );
 
-        void setViewProjection(const glm::mat4& view, const glm::mat4& proj);
-        void uploadMesh(Kinetica::Components::SMesh& mesh);
+        // Same, with an explicit model matrix (e.g. a world matrix from CTransformHierarchy).
+        void renderEntity(
+            const glm::mat4& model,
+            const Components::SMesh& mesh,
+            const Components::SMaterial& material
+        ) override;
+
+        // Batched path: submit() queues a draw with a sort key and may be called
+        // from several threads at once (e.g. from CView::parallelEach).
+        // flushBatches() radix-sorts the queue and draws every mesh with one
+        // instanced call, or the whole queue with one glMultiDrawElementsIndirect
+        // when supported; without the instanced shader it walks the sorted list
+        // with renderEntity, skipping redundant state changes.
+        void submit(
+            const glm::mat4& model,
+            const Components::SMesh& mesh,
+            const Components::SMaterial& material
+        ) override;
+        void flushBatches() override;
+
+        const SRenderStats& stats() const override { return m_stats; }
+        bool hasMultiDrawIndirect() const { return m_bMultiDrawIndirect; }
+
+        void setViewProjection(const glm::mat4& view, const glm::mat4& proj) override;
+        // Sub-allocates the mesh in the shared geometry arena. Full upload when
+        // mesh.isDirty, otherwise only the dirty ranges and appended data.
+        void uploadMesh(Kinetica::Components::SMesh& mesh) override;
+        void releaseMesh(Kinetica::Components::SMesh& mesh) override;
+
+        CGeometryArena* geometryArena() { return m_arena.get(); }
+        const SVertexFormat& vertexFormat() const { return m_format; }
 
     private:
         bool m_bValid = false;
 
         GLuint m_shaderProgram = 0;
+        SVertexFormat m_format;
+        std::unique_ptr<CGeometryArena> m_arena;
+        GLuint m_boundVao = 0;
+        SRenderStats m_stats;
+        CGpuTimer m_gpuTimer; // KPROFILE_GPU_SCOPE around the passes
+
+        void useProgram(GLuint program);
+        const SPositionDequant& dequant(std::uint32_t geometry) const;
+        void uploadVertexRange(Components::SMesh& mesh, std::uint32_t first, std::uint32_t count);
+        void uploadIndexRange(Components::SMesh& mesh, std::uint32_t firstTriangle, std::uint32_t triangleCount);
+        void drawImmediate(const glm::mat4& model, std::uint32_t geometry,
+                           std::uint32_t indexCount, std::uint32_t vertexCount,
+                           const Components::SMaterial& material);
+
+        // Redundant-state filter for the per-entity path.
+        GLuint m_currentProgram = 0;
+        bool m_bMaterialCached = false;
+        glm::vec4 m_cachedMaterialA{0.0f};
+        glm::vec4 m_cachedMaterialB{0.0f};
+        glm::mat4 m_view{1.0f};
+        std::uint32_t m_dequantGeometry = 0xFFFFFFFFu; // whose dequantization uniforms are set
+
+        // Geometry handle -> position dequantization of its vertices.
+        std::vector<SPositionDequant> m_dequant;
+        std::vector<std::uint8_t> m_vertexScratch;
+        std::vector<std::uint16_t> m_indexScratch;
+
+        // --- Batching ---
+        void setInstanceAttributes(std::size_t firstInstance);
+
+        GLuint m_instancedProgram = 0;
+        GLuint m_batchVao = 0;
+        std::uint32_t m_batchVaoGeneration = 0xFFFFFFFFu;
+        GLuint m_instanceBuffer = 0;
+        std::size_t m_instanceCapacity = 0; // bytes
+        GLuint m_materialBuffer = 0;
+        GLuint m_materialTexture = 0;
+        GLuint m_indirectBuffer = 0;
+        bool m_bMultiDrawIndirect = false;
+
+        CRenderQueue m_queue;
+        SBatchList m_batchList;
+        std::vector<glm::vec4> m_materialTexels; // two per material
 
         GLint m_uModelLoc = -1;
+        GLint m_uPositionScaleLoc = -1;
+        GLint m_uPositionOffsetLoc = -1;
         GLint m_uBaseColorLoc = -1;
         GLint m_uMetallicLoc = -1;
         GLint m_uRoughnessLoc = -1;
@@ -0,0 +1,58 @@
+#ifndef KINETICA_RENDERING_BATCHING_HPP
+#define KINETICA_RENDERING_BATCHING_HPP
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace Kinetica {
+
+    // One queued draw: an arena allocation, how much of it to draw, and the
+    // instance data that ends up in the per-instance vertex stream.
+    struct SDrawItem {
+        std::uint32_t geometry;    // CGeometryArena handle
+        std::uint32_t indexCount;  // 0 draws non-indexed
+        std::uint32_t vertexCount;
+        std::uint32_t material;    // index into the frame's material table
+        glm::mat4 model;
+    };
+
+    // Per-instance vertex attributes (locations 3-6 model, 7 material, 8-9 the
+    // mesh's position dequantization, see SPositionDequant).
+    struct SInstanceData {
+        glm::mat4 model;
+        glm::vec3 positionOffset{0.0f};
+        std::uint32_t material = 0;
+        glm::vec3 positionScale{1.0f};
+        std::uint32_t padding = 0;
+    };
+
+    // A run of instances sharing one mesh; becomes one instanced draw or one
+    // indirect command.
+    struct SDrawBatch {
+        std::uint32_t geometry;
+        std::uint32_t indexCount;
+        std::uint32_t vertexCount;
+        std::uint32_t firstInstance;
+        std::uint32_t instanceCount;
+    };
+
+    struct SBatchList {
+        std::vector<SInstanceData> instances;
+        std::vector<SDrawBatch> batches;
+
+        void clear() {
+            instances.clear();
+            batches.clear();
+        }
+    };
+
+    // Groups items by mesh, then material (so a mesh's instances are contiguous
+    // and sorted by material), and emits one batch per mesh.
+    void buildBatches(std::span<const SDrawItem> items, SBatchList& out);
+
+} // namespace Kinetica
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef KINETICA_RENDERING_GEOMETRY_ARENA_HPP
+#define KINETICA_RENDERING_GEOMETRY_ARENA_HPP
+
+#include <GL/glew.h>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "vertex_format.hpp"
+
+namespace Kinetica {
+
+    // Best-fit range allocator over [0, capacity) with coalescing on free.
+    // Works in abstract units (vertices, indices); knows nothing about GL.
+    class CRangeAllocator {
+    public:
+        static constexpr std::uint32_t INVALID_OFFSET = 0xFFFFFFFFu;
+
+        explicit CRangeAllocator(std::uint32_t capacity = 0);
+
+        // Returns the offset (a multiple of `alignment`) of `size` free units, or INVALID_OFFSET.
+        std::uint32_t allocate(std::uint32_t size, std::uint32_t alignment = 1);
+        void free(std::uint32_t offset, std::uint32_t size);
+
+        // Extends the range; the new tail merges with a trailing free block.
+        void grow(std::uint32_t capacity);
+        // Everything below `used` is allocated, the rest is one free block.
+        void reset(std::uint32_t capacity, std::uint32_t used);
+
+        std::uint32_t capacity() const { return m_capacity; }
+        std::uint32_t freeSpace() const { return m_free; }
+        std::uint32_t largestFreeBlock() const;
+        std::size_t freeBlockCount() const { return m_byOffset.size(); }
+
+    private:
+        void insertFree(std::uint32_t offset, std::uint32_t size);
+        void eraseFree(std::map<std::uint32_t, std::uint32_t>::iterator it);
+
+        std::uint32_t m_capacity = 0;
+        std::uint32_t m_free = 0;
+        std::map<std::uint32_t, std::uint32_t> m_byOffset;    // offset -> size
+        std::multimap<std::uint32_t, std::uint32_t> m_bySize; // size -> offset
+    };
+
+    // One large vertex buffer and index buffer shared by every mesh with the same
+    // vertex layout, behind a single VAO. Meshes get sub-ranges and are drawn with
+    // glDrawElementsBaseVertex, so indices stay mesh-local. Each range holds 16-
+    // or 32-bit indices; the index buffer is managed in 2-byte units and 32-bit
+    // ranges are kept 4-byte aligned.
+    //
+    // Allocations are addressed through stable handles: growing the buffers or
+    // defragmenting moves data on the GPU but never invalidates a handle.
+    class CGeometryArena {
+    public:
+        static constexpr std::uint32_t INVALID_HANDLE = 0xFFFFFFFFu;
+
+        struct SAllocation {
+            std::uint32_t vertexOffset = 0;
+            std::uint32_t vertexCapacity = 0;
+            std::uint32_t indexOffset = 0;   // in elements of indexType
+            std::uint32_t indexCapacity = 0;
+            GLenum indexType = GL_UNSIGNED_INT;
+            bool live = false;
+
+            std::size_t indexByteOffset() const { return std::size_t(indexOffset) * indexSize(indexType); }
+        };
+
+        static std::uint32_t indexSize(GLenum type) { return type == GL_UNSIGNED_SHORT ? 2 : 4; }
+
+        explicit CGeometryArena(SVertexLayout layout,
+                                std::uint32_t initialVertices = 1u << 20,
+                                std::uint32_t initialIndices = 3u << 20);
+        ~CGeometryArena();
+
+        CGeometryArena(const CGeometryArena&) = delete;
+        CGeometryArena& operator=(const CGeometryArena&) = delete;
+
+        // Reserves room for a mesh; grows the buffers when needed. indexType is
+        // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT.
+        std::uint32_t allocate(std::uint32_t vertexCount, std::uint32_t indexCount, GLenum indexType = GL_UNSIGNED_INT);
+        // Moves a handle to a range of the new size. Contents are not preserved;
+        // on failure the handle is released.
+        bool reallocate(std::uint32_t handle, std::uint32_t vertexCount, std::uint32_t indexCount,
+                        GLenum indexType = GL_UNSIGNED_INT);
+        void free(std::uint32_t handle);
+
+        // first/count are relative to the allocation; vertex data is in the layout's
+        // encoding, index data in the allocation's index type.
+        void uploadVertices(std::uint32_t handle, std::uint32_t first, std::uint32_t count, const void* data);
+        void uploadIndices(std::uint32_t handle, std::uint32_t first, std::uint32_t count, const void* data);
+
+        const SAllocation* allocation(std::uint32_t handle) const;
+
+        // Packs all live ranges to the front of fresh buffers.
+        void defragment();
+        // 0 when free space is one block, towards 1 as it splinters.
+        float fragmentation() const;
+
+        GLuint vao() const { return m_vao; }
+        GLuint vertexBuffer() const { return m_vbo; }
+        GLuint indexBuffer() const { return m_ebo; }
+        // Bumped whenever growth or defragmentation replaces the buffers, so
+        // VAOs built on top of the arena know to re-attach.
+        std::uint32_t generation() const { return m_generation; }
+        void bind() const { glBindVertexArray(m_vao); }
+
+        // Points the bound VAO's layout attributes and element buffer at the arena.
+        void attachTo() const;
+        // Expects the arena VAO to be bound; draws non-indexed when indexCount is 0.
+        void draw(std::uint32_t handle, std::uint32_t indexCount, std::uint32_t vertexCount) const;
+
+        const SVertexLayout& layout() const { return m_layout; }
+        std::uint32_t liveAllocations() const { return m_liveCount; }
+
+        // GPU bytes of both buffers, and the part of them in use.
+        std::size_t capacityBytes() const;
+        std::size_t usedBytes() const;
+
+    private:
+        static constexpr std::uint32_t INDEX_UNIT = 2; // bytes
+
+        void growVertices(std::uint32_t required);
+        void growIndices(std::uint32_t requiredUnits);
+        void attachBuffers();
+
+        SVertexLayout m_layout;
+        GLuint m_vao = 0;
+        GLuint m_vbo = 0;
+        GLuint m_ebo = 0;
+        CRangeAllocator m_vertices;
+        CRangeAllocator m_indices;
+
+        std::vector<SAllocation> m_allocations;
+        std::vector<std::uint32_t> m_freeHandles;
+        std::uint32_t m_liveCount = 0;
+        std::uint32_t m_generation = 0;
+    };
+
+} // namespace Kinetica
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef KINETICA_RENDERING_GPU_TIMER_HPP
+#define KINETICA_RENDERING_GPU_TIMER_HPP
+
+#include <GL/glew.h>
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <kinetica/profiler.hpp>
+
+namespace Kinetica {
+
+    // GL_TIME_ELAPSED queries from a recycled pool. Passes are bracketed by
+    // begin()/end() and cannot nest (a nested begin is ignored). collect()
+    // reads finished queries without stalling, usually a frame or two later,
+    // and hands them to Profile::recordGpu. Needs the GL context that
+    // created it; does nothing while profiling is disabled.
+    class CGpuTimer {
+    public:
+        CGpuTimer() = default;
+        ~CGpuTimer();
+
+        CGpuTimer(const CGpuTimer&) = delete;
+        CGpuTimer& operator=(const CGpuTimer&) = delete;
+
+        void begin(const char* name);
+        void end();
+        void collect();
+
+    private:
+        static constexpr std::size_t MAX_IN_FLIGHT = 64;
+
+        struct SPending {
+            GLuint query;
+            const char* name;
+            std::uint64_t cpuBegin;
+        };
+
+        std::vector<GLuint> m_free;
+        std::deque<SPending> m_pending; // oldest first; the back may still be open
+        bool m_open = false;
+    };
+
+    class CGpuZone {
+    public:
+        CGpuZone(CGpuTimer& timer, const char* name) : m_timer(timer) { m_timer.begin(name); }
+        ~CGpuZone() { m_timer.end(); }
+
+        CGpuZone(const CGpuZone&) = delete;
+        CGpuZone& operator=(const CGpuZone&) = delete;
+
+    private:
+        CGpuTimer& m_timer;
+    };
+
+} // namespace Kinetica
+
+#if KINETICA_PROFILE
+#define KPROFILE_GPU_SCOPE(timer, name) \
+    ::Kinetica::CGpuZone KINETICA_PROFILE_CONCAT(kprofileGpuZone, __LINE__)(timer, name)
+#define KPROFILE_GPU_COLLECT(timer) (timer).collect()
+#else
+#define KPROFILE_GPU_SCOPE(timer, name) static_cast<void>(0)
+#define KPROFILE_GPU_COLLECT(timer) static_cast<void>(0)
+#endif
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef KINETICA_RENDERING_IMAGE_IO_HPP
+#define KINETICA_RENDERING_IMAGE_IO_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Kinetica {
+
+    // 8-bit images, rows top to bottom, tightly packed; `channels` is 3 (RGB)
+    // or 4 (RGBA). PPM drops alpha.
+    bool writePPM(const std::string& path, std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels,
+                  std::uint32_t channels);
+    // Deflate with fixed Huffman codes and per-row filter selection; no
+    // zlib dependency.
+    bool writePNG(const std::string& path, std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels,
+                  std::uint32_t channels);
+    // Picks the format from the extension (.png, otherwise PPM).
+    bool writeImage(const std::string& path, std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels,
+                    std::uint32_t channels);
+
+    // Binary PPM (P6, maxval 255) into RGB pixels, for golden-image checks.
+    bool readPPM(const std::string& path, std::uint32_t& width, std::uint32_t& height, std::vector<std::uint8_t>& rgb);
+
+} // namespace Kinetica
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef KINETICA_RENDERING_RENDER_BACKEND_HPP
+#define KINETICA_RENDERING_RENDER_BACKEND_HPP
+
+#include <cstdint>
+
+#include <glm/glm.hpp>
+
+#include <kinetica/ecs/components/material.hpp>
+#include <kinetica/ecs/components/mesh.hpp>
+
+namespace Kinetica {
+
+    // Counters for the current frame, reset by clear().
+    struct SRenderStats {
+        std::uint32_t drawCalls = 0;
+        std::uint32_t instances = 0;
+        std::uint32_t batches = 0;
+        std::uint32_t programBinds = 0;
+        std::uint32_t materialUploads = 0;
+        std::uint32_t trianglesRasterized = 0; // CPU backend only
+    };
+
+    // What the frame loop, the asset loader and tools need from a renderer.
+    // CRenderer draws through OpenGL; CSoftwareRenderer rasterizes on the CPU
+    // without any window or GL context.
+    class IRenderBackend {
+    public:
+        virtual ~IRenderBackend() = default;
+
+        virtual bool isValid() const = 0;
+        virtual void clear() = 0;
+        virtual void present() = 0;
+        virtual void setViewProjection(const glm::mat4& view, const glm::mat4& proj) = 0;
+
+        // Makes the mesh's current data drawable and clears its dirty state.
+        virtual void uploadMesh(Components::SMesh& mesh) = 0;
+        virtual void releaseMesh(Components::SMesh& mesh) = 0;
+
+        virtual void renderEntity(const glm::mat4& model, const Components::SMesh& mesh,
+                                  const Components::SMaterial& material) = 0;
+
+        // Thread-safe queueing; flushBatches() draws everything submitted
+        // since the last flush. Meshes must stay alive until then.
+        virtual void submit(const glm::mat4& model, const Components::SMesh& mesh,
+                            const Components::SMaterial& material) = 0;
+        virtual void flushBatches() = 0;
+
+        virtual const SRenderStats& stats() const = 0;
+    };
+
+} // namespace Kinetica
+
+#endif
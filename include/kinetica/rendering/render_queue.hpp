@@ -0,0 +1,111 @@
+#ifndef KINETICA_RENDERING_RENDER_QUEUE_HPP
+#define KINETICA_RENDERING_RENDER_QUEUE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../ecs/components/material.hpp"
+
+namespace Kinetica {
+
+    // 64-bit draw sort key, most significant field first:
+    //   pass (4) | shader (8) | material (18) | mesh (18) | depth (16)
+    // Sorting by key groups draws by the most expensive state change first.
+    namespace DrawKey {
+        constexpr std::uint32_t DEPTH_BITS = 16;
+        constexpr std::uint32_t MESH_BITS = 18;
+        constexpr std::uint32_t MATERIAL_BITS = 18;
+        constexpr std::uint32_t SHADER_BITS = 8;
+        constexpr std::uint32_t PASS_BITS = 4;
+
+        constexpr std::uint32_t MESH_SHIFT = DEPTH_BITS;
+        constexpr std::uint32_t MATERIAL_SHIFT = MESH_SHIFT + MESH_BITS;
+        constexpr std::uint32_t SHADER_SHIFT = MATERIAL_SHIFT + MATERIAL_BITS;
+        constexpr std::uint32_t PASS_SHIFT = SHADER_SHIFT + SHADER_BITS;
+        static_assert(PASS_SHIFT + PASS_BITS == 64);
+
+        constexpr std::uint64_t field(std::uint64_t value, std::uint32_t bits, std::uint32_t shift) {
+            return (value & ((std::uint64_t(1) << bits) - 1)) << shift;
+        }
+
+        constexpr std::uint64_t make(std::uint32_t pass, std::uint32_t shader, std::uint32_t material,
+                                     std::uint32_t mesh, std::uint32_t depth) {
+            return field(pass, PASS_BITS, PASS_SHIFT) | field(shader, SHADER_BITS, SHADER_SHIFT) |
+                   field(material, MATERIAL_BITS, MATERIAL_SHIFT) | field(mesh, MESH_BITS, MESH_SHIFT) |
+                   field(depth, DEPTH_BITS, 0);
+        }
+
+        // Front-to-back bucket for a view-space distance (log scale, ~65k units).
+        std::uint32_t depthBucket(float viewDepth);
+
+        // Hash of a material's shading values, sized for the material field.
+        std::uint32_t materialHash(const Components::SMaterial& material);
+    } // namespace DrawKey
+
+    struct SSortEntry {
+        std::uint64_t key;
+        std::uint32_t value;
+    };
+
+    // Stable LSD radix sort on the key, 8 bits per pass. Passes where every key
+    // has the same byte are skipped, so narrow keys cost only a few passes.
+    void radixSort(std::vector<SSortEntry>& entries, std::vector<SSortEntry>& scratch);
+
+    struct SRenderCommand {
+        glm::mat4 model;
+        std::uint32_t geometry;    // CGeometryArena handle
+        std::uint32_t indexCount;
+        std::uint32_t vertexCount;
+        const Components::SMaterial* material;
+    };
+
+    // Per-frame list of draws. Every thread appends to its own buffer without
+    // locking (a mutex is only taken the first time a thread pushes), sort()
+    // merges them into one radix-sorted order. sort() and clear() must not run
+    // concurrently with push().
+    class CRenderQueue {
+    public:
+        CRenderQueue();
+        CRenderQueue(const CRenderQueue&) = delete;
+        CRenderQueue& operator=(const CRenderQueue&) = delete;
+
+        void push(std::uint64_t key, const SRenderCommand& command);
+
+        void sort();
+        void clear();
+
+        std::size_t size() const { return m_sorted.size(); }
+        std::uint64_t key(std::size_t i) const { return m_sorted[i].key; }
+        const SRenderCommand& command(std::size_t i) const {
+            const std::uint32_t v = m_sorted[i].value;
+            return m_buffers[v >> SLOT_SHIFT]->commands[v & ((1u << SLOT_SHIFT) - 1)];
+        }
+
+    private:
+        // Sorted values pack (thread slot, command index) into 32 bits.
+        static constexpr std::uint32_t SLOT_SHIFT = 24;
+
+        struct SThreadBuffer {
+            std::vector<SSortEntry> entries;
+            std::vector<SRenderCommand> commands;
+        };
+
+        SThreadBuffer& local();
+
+        std::uint64_t m_id;
+        std::mutex m_mutex;
+        std::unordered_map<std::thread::id, std::uint32_t> m_slots;
+        std::vector<std::unique_ptr<SThreadBuffer>> m_buffers;
+        std::vector<SSortEntry> m_sorted;
+        std::vector<SSortEntry> m_scratch;
+    };
+
+} // namespace Kinetica
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef KINETICA_RENDERING_SOFTWARE_RENDERER_HPP
+#define KINETICA_RENDERING_SOFTWARE_RENDERER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <kinetica/rendering/render_backend.hpp>
+
+namespace Kinetica {
+
+    class CThreadPool;
+
+    // Tile-based CPU rasterizer with the shading of basic.frag. flushBatches()
+    // transforms vertices, sets up and bins triangles into 64x64 tiles and
+    // rasterizes the tiles in parallel with 4-wide edge functions and a depth
+    // buffer. Meshes are drawn straight from their CPU arrays.
+    class CSoftwareRenderer : public IRenderBackend {
+    public:
+        static constexpr std::uint32_t TILE_SIZE = 64;
+
+        // Without a pool, a private one is created for the tile work.
+        CSoftwareRenderer(std::uint32_t width, std::uint32_t height, CThreadPool* pool = nullptr);
+        ~CSoftwareRenderer() override;
+
+        CSoftwareRenderer(const CSoftwareRenderer&) = delete;
+        CSoftwareRenderer& operator=(const CSoftwareRenderer&) = delete;
+
+        bool isValid() const override { return m_width > 0 && m_height > 0; }
+        void clear() override;
+        void present() override {}
+        void setViewProjection(const glm::mat4& view, const glm::mat4& proj) override;
+
+        // Nothing to copy: only clears the mesh's dirty state.
+        void uploadMesh(Components::SMesh& mesh) override;
+        void releaseMesh(Components::SMesh& mesh) override;
+
+        // Draws immediately (a submit followed by a flush).
+        void renderEntity(const glm::mat4& model, const Components::SMesh& mesh,
+                          const Components::SMaterial& material) override;
+        void submit(const glm::mat4& model, const Components::SMesh& mesh,
+                    const Components::SMaterial& material) override;
+        void flushBatches() override;
+
+        const SRenderStats& stats() const override { return m_stats; }
+
+        void resize(std::uint32_t width, std::uint32_t height);
+        void setClearColor(const glm::vec3& color) { m_clearColor = color; }
+
+        std::uint32_t width() const { return m_width; }
+        std::uint32_t height() const { return m_height; }
+        // Rows top to bottom, `stride()` pixels apart; RGBA8 with R in the low byte.
+        const std::uint32_t* colorBuffer() const { return m_color.data(); }
+        const float* depthBuffer() const { return m_depth.data(); }
+        std::uint32_t stride() const { return m_stride; }
+
+        // Tightly packed RGBA8 copy of the color buffer.
+        std::vector<std::uint8_t> readPixels() const;
+        // PNG or PPM, by extension.
+        bool writeImage(const std::string& path) const;
+
+    private:
+        struct SDraw {
+            glm::mat4 model;
+            const Components::SMesh* mesh;
+            glm::vec3 albedo;
+            bool uvAlbedo; // SMaterial::useVertexColor: albedo = (u, v, 0)
+        };
+        struct SClipVertex;
+        struct STriangle;
+
+        CThreadPool& pool();
+
+        std::uint32_t m_width = 0;
+        std::uint32_t m_height = 0;
+        std::uint32_t m_stride = 0; // width rounded up to the SIMD width
+        std::uint32_t m_tilesX = 0;
+        std::uint32_t m_tilesY = 0;
+        std::vector<std::uint32_t> m_color;
+        std::vector<float> m_depth;
+        glm::vec3 m_clearColor{0.0f, 1.0f, 0.615f}; // CRenderer's glClearColor
+
+        glm::mat4 m_viewProjection{1.0f};
+        CThreadPool* m_pool = nullptr;
+        std::unique_ptr<CThreadPool> m_ownPool;
+
+        std::mutex m_submitMutex;
+        std::vector<SDraw> m_draws;
+        SRenderStats m_stats;
+
+        // Per-flush scratch, kept for its capacity.
+        std::vector<std::size_t> m_vertexOffsets;   // per draw, plus the total
+        std::vector<std::size_t> m_triangleOffsets;
+        std::vector<SClipVertex> m_clipVertices;
+        std::vector<std::vector<STriangle>> m_chunkTriangles;
+        std::vector<std::vector<std::uint32_t>> m_bins; // [chunk * tiles + tile] -> triangles of the chunk
+    };
+
+} // namespace Kinetica
+
+#endif
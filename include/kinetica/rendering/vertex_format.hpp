@@ -0,0 +1,97 @@
+#ifndef KINETICA_RENDERING_VERTEX_FORMAT_HPP
+#define KINETICA_RENDERING_VERTEX_FORMAT_HPP
+
+#include <GL/glew.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../ecs/components/mesh.hpp"
+#include "../math/bounds.hpp"
+
+namespace Kinetica {
+
+    struct SVertexAttribute {
+        GLuint location;
+        GLint components;
+        GLenum type;
+        GLboolean normalized;
+        std::uint32_t offset;
+    };
+
+    struct SVertexLayout {
+        std::uint32_t stride = 0;
+        std::vector<SVertexAttribute> attributes;
+
+        // Components::SVertex as is: float position, normal, uv.
+        static SVertexLayout standard();
+    };
+
+    enum class EPositionEncoding : std::uint8_t {
+        Float32,  ///< 12 bytes
+        Unorm16,  ///< 8 bytes, quantized relative to the mesh bounds
+    };
+
+    enum class ENormalEncoding : std::uint8_t {
+        Float32,       ///< 12 bytes
+        Octahedral16,  ///< 4 bytes (2 x unorm8, padded)
+        Octahedral32,  ///< 4 bytes (2 x unorm16)
+    };
+
+    enum class EUVEncoding : std::uint8_t {
+        Float32,  ///< 8 bytes
+        Half16,   ///< 4 bytes, any range
+        Unorm16,  ///< 4 bytes, clamped to [0, 1]
+    };
+
+    // GPU encoding of Components::SVertex. Attribute locations are fixed
+    // (0 position, 1 normal, 2 uv); shaders are compiled with
+    // KINETICA_OCTAHEDRAL_NORMALS when normals are octahedral.
+    struct SVertexFormat {
+        EPositionEncoding position = EPositionEncoding::Unorm16;
+        ENormalEncoding normal = ENormalEncoding::Octahedral32;
+        EUVEncoding uv = EUVEncoding::Half16;
+        bool allow16BitIndices = true; // for meshes with at most 65536 vertices
+
+        static SVertexFormat standard(); // 32-byte float vertices, 32-bit indices
+        static SVertexFormat compact();  // 16-byte vertices, 16-bit indices where possible
+
+        SVertexLayout layout() const;
+        std::uint32_t stride() const { return layout().stride; }
+        bool octahedralNormals() const { return normal != ENormalEncoding::Float32; }
+
+        // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT for a mesh of `vertexCount` vertices.
+        GLenum indexType(std::uint32_t vertexCount) const {
+            return allow16BitIndices && vertexCount <= 65536u ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        }
+    };
+
+    // Maps decoded positions back to object space: p = decoded * scale + offset.
+    // Identity for float positions.
+    struct SPositionDequant {
+        glm::vec3 scale{1.0f};
+        glm::vec3 offset{0.0f};
+
+        // Quantization box for `bounds`, grown by `margin` times its extent on each side.
+        static SPositionDequant fromBounds(const Math::SAABB& bounds, float margin = 0.0f);
+        bool covers(const glm::vec3& p) const;
+    };
+
+    // Writes vertices in `format` to out (vertices.size() * stride bytes).
+    void encodeVertices(const SVertexFormat& format, std::span<const Components::SVertex> vertices,
+                        const SPositionDequant& dequant, std::uint8_t* out);
+
+    // ---- Scalar codecs ----
+    std::uint16_t floatToHalf(float value);
+    float halfToFloat(std::uint16_t half);
+
+    // Unit vector <-> octahedral coordinates in [-1, 1]^2.
+    glm::vec2 octahedralEncode(const glm::vec3& n);
+    glm::vec3 octahedralDecode(const glm::vec2& e);
+
+} // namespace Kinetica
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef KINETICA_THREAD_POOL_HPP
+#define KINETICA_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Kinetica {
+
+    // Counts the outstanding tasks of one batch of work; see CThreadPool::wait.
+    class CTaskGroup {
+    public:
+        bool done() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class CThreadPool;
+        std::atomic<std::size_t> m_pending{0};
+        std::atomic<bool> m_failed{false};
+        std::exception_ptr m_error; // first exception thrown by a task, set once
+    };
+
+    // Work-stealing thread pool. Every worker owns a deque: it pushes and pops
+    // its own work at the back (LIFO, cache-warm) and steals from the front of
+    // the others when it runs dry. Threads that wait on a group help execute
+    // tasks, so tasks may spawn and wait on nested work; once nothing is left
+    // to run they sleep until the group finishes or new work is queued.
+    class CThreadPool {
+    public:
+        using Task = std::function<void()>;
+
+        // threadCount == 0 uses one worker per hardware thread, minus the caller.
+        explicit CThreadPool(std::size_t threadCount = 0);
+        ~CThreadPool();
+
+        CThreadPool(const CThreadPool&) = delete;
+        CThreadPool& operator=(const CThreadPool&) = delete;
+
+        std::size_t threadCount() const { return m_workers.size(); }
+
+        void submit(CTaskGroup& group, Task task);
+        // Returns once every task of the group has finished, then rethrows
+        // the first exception any of them threw.
+        void wait(CTaskGroup& group);
+
+        // Splits [0, count) into ranges of at most `grain` items, runs
+        // fn(begin, end) on them in parallel and waits for completion.
+        void parallelFor(std::size_t count, std::size_t grain,
+                         const std::function<void(std::size_t, std::size_t)>& fn);
+
+    private:
+        struct STask {
+            Task fn;
+            CTaskGroup* group = nullptr;
+        };
+
+        struct SWorkerQueue {
+            std::mutex mutex;
+            std::deque<STask> tasks;
+        };
+
+        void workerLoop(std::size_t index);
+        bool tryRunOne(std::size_t preferredQueue);
+        bool popTask(std::size_t queue, bool back, STask& out);
+        void run(STask& task);
+        void finish(CTaskGroup& group);
+
+        std::vector<std::unique_ptr<SWorkerQueue>> m_queues;  // one per worker + one for external submitters
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeup;
+        std::condition_variable m_groupDone;  // sleeping wait() callers
+        std::size_t m_waiters = 0;            // guarded by m_sleepMutex
+        std::atomic<std::size_t> m_queued{0};
+        std::atomic<bool> m_stop{false};
+    };
+
+} // namespace Kinetica
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <string>
 #include <cstdint>
+#include <vector>
 
 namespace Kinetica {
 
@@ -21,6 +22,7 @@ namespace Kinetica {
         UserCancelled     = 5,  ///< User explicitly quit during startup or operation
         PluginLoadError   = 6,  ///< Failed to load a required or user-specified plugin
         RenderFailure     = 7,  ///< Rendering pipeline encountered an unrecoverable error
+        BatchFailed       = 8,  ///< Headless batch run finished with failed files
     };
 
     // =============================================================================
@@ -49,9 +51,18 @@ namespace Kinetica {
         bool showHelp = false;
         bool showVersion = false;
         bool headless = false;
-        std::string logLevel = "info";
+        std::string logLevel; ///< empty = build default (warn, or debug with KINETICA_DEBUG_LOG)
         std::string pluginDir;
+        bool profile = false;
+        std::string profileTrace;    ///< Chrome trace written at exit; empty = summary only
         std::vector<std::string> filesToOpen;
+
+        // Headless batch processing
+        std::string pipeline;        ///< e.g. "import,optimize,export"; empty = validate
+        std::string outputDir;       ///< where export and thumbnail write their files
+        std::size_t jobs = 0;        ///< files processed at once, 0 = hardware threads
+        std::size_t memoryBudgetMB = 0; ///< 0 = default
+        std::size_t thumbnailSize = 0;  ///< 0 = default
     };
 
 } // namespace Kinetica
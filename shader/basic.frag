@@ -1,7 +1,7 @@
 #version 330 core
 in vec3 FragPos;
 in vec3 Normal;
-in vec3 Color;
+in vec2 UV;
 
 uniform vec3 uBaseColor;
 uniform float uMetallic;
@@ -11,7 +11,8 @@ uniform bool uUseVertexColor;
 out vec4 FragColor;
 
 void main() {
-    vec3 albedo = uUseVertexColor ? Color : uBaseColor;
+    // SVertex carries no colour; vertex-colour mode visualizes the UVs instead.
+    vec3 albedo = uUseVertexColor ? vec3(UV, 0.0) : uBaseColor;
     float NdotL = max(dot(normalize(Normal), vec3(0,1,0)), 0.2);
     FragColor = vec4(albedo * NdotL, 1.0);
 }
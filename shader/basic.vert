@@ -1,19 +1,34 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
-layout (location = 2) in vec3 aColor;
+layout (location = 2) in vec2 aUV;
 
 uniform mat4 uModel;
 uniform mat4 uView;
 uniform mat4 uProjection;
 
+// Quantized positions arrive in [0, 1] and are mapped back to mesh space.
+uniform vec3 uPositionScale;
+uniform vec3 uPositionOffset;
+
 out vec3 FragPos;
 out vec3 Normal;
-out vec3 Color;
+out vec2 UV;
+
+vec3 decodeNormal(vec3 n) {
+#ifdef KINETICA_OCTAHEDRAL_NORMALS
+    vec2 e = n.xy * 2.0 - 1.0;
+    vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (v.z < 0.0) v.xy = (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(v);
+#else
+    return n;
+#endif
+}
 
 void main() {
-    FragPos = vec3(uModel * vec4(aPos, 1.0));
-    Normal = mat3(transpose(inverse(uModel))) * aNormal;
-    Color = aColor;
+    FragPos = vec3(uModel * vec4(aPos * uPositionScale + uPositionOffset, 1.0));
+    Normal = mat3(transpose(inverse(uModel))) * decodeNormal(aNormal);
+    UV = aUV;
     gl_Position = uProjection * uView * vec4(FragPos, 1.0);
 }
@@ -0,0 +1,15 @@
+#version 330 core
+in vec3 FragPos;
+in vec3 Normal;
+in vec2 UV;
+flat in vec4 MaterialA;
+flat in vec4 MaterialB;
+
+out vec4 FragColor;
+
+void main() {
+    // SVertex carries no colour; vertex-colour mode visualizes the UVs instead.
+    vec3 albedo = MaterialB.y > 0.5 ? vec3(UV, 0.0) : MaterialA.rgb;
+    float NdotL = max(dot(normalize(Normal), vec3(0,1,0)), 0.2);
+    FragColor = vec4(albedo * NdotL, 1.0);
+}
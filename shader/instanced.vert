@@ -0,0 +1,40 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aUV;
+layout (location = 3) in mat4 aModel;            // per instance, locations 3-6
+layout (location = 7) in uint aMaterial;         // per instance
+layout (location = 8) in vec3 aPositionOffset;   // per instance, the mesh's dequantization
+layout (location = 9) in vec3 aPositionScale;    // per instance
+
+uniform mat4 uView;
+uniform mat4 uProjection;
+
+// Two texels per material: (baseColor, metallic), (roughness, useVertexColor, -, -)
+uniform samplerBuffer uMaterials;
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 UV;
+flat out vec4 MaterialA;
+flat out vec4 MaterialB;
+
+vec3 decodeNormal(vec3 n) {
+#ifdef KINETICA_OCTAHEDRAL_NORMALS
+    vec2 e = n.xy * 2.0 - 1.0;
+    vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (v.z < 0.0) v.xy = (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(v);
+#else
+    return n;
+#endif
+}
+
+void main() {
+    FragPos = vec3(aModel * vec4(aPos * aPositionScale + aPositionOffset, 1.0));
+    Normal = mat3(transpose(inverse(aModel))) * decodeNormal(aNormal);
+    UV = aUV;
+    MaterialA = texelFetch(uMaterials, int(aMaterial) * 2);
+    MaterialB = texelFetch(uMaterials, int(aMaterial) * 2 + 1);
+    gl_Position = uProjection * uView * vec4(FragPos, 1.0);
+}
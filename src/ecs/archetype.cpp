@@ -0,0 +1,251 @@
+#include <kinetica/ecs/archetype.hpp>
+
+#include <algorithm>
+
+namespace Kinetica {
+
+    static std::size_t alignUp(std::size_t value, std::size_t align) {
+        return (value + align - 1) & ~(align - 1);
+    }
+
+    CArchetype::CArchetype(std::vector<std::uint32_t> signature, std::vector<const SComponentInfo*> infos)
+        : m_signature(std::move(signature)), m_infos(std::move(infos)) {
+        for (std::size_t i = 0; i < m_signature.size(); ++i) {
+            if (m_signature[i] >= m_columnOf.size()) m_columnOf.resize(m_signature[i] + 1, -1);
+            m_columnOf[m_signature[i]] = static_cast<int>(i);
+        }
+
+        std::size_t rowBytes = sizeof(SEntityHandle);
+        for (const SComponentInfo* componentInfo : m_infos) rowBytes += componentInfo->size;
+
+        // Chunks hold at least one row, even for components bigger than CHUNK_BYTES.
+        m_chunkBytes = std::max(CHUNK_BYTES, alignUp(rowBytes * 2, CHUNK_ALIGN));
+
+        // Largest capacity whose aligned SoA layout still fits in one chunk.
+        auto layout = [&](std::uint32_t capacity) {
+            m_columnOffsets.clear();
+            std::size_t offset = sizeof(SEntityHandle) * capacity;
+            for (const SComponentInfo* componentInfo : m_infos) {
+                offset = alignUp(offset, componentInfo->align);
+                m_columnOffsets.push_back(offset);
+                offset += componentInfo->size * capacity;
+            }
+            return offset;
+        };
+
+        std::uint32_t capacity = static_cast<std::uint32_t>(m_chunkBytes / rowBytes);
+        while (capacity > 1 && layout(capacity) > m_chunkBytes) --capacity;
+        layout(capacity);
+        m_chunkCapacity = capacity;
+    }
+
+    CArchetype::~CArchetype() {
+        for (std::uint32_t row = 0; row < m_count; ++row) {
+            for (std::size_t c = 0; c < m_infos.size(); ++c) {
+                info(static_cast<int>(c)).destroy(component(row, static_cast<int>(c)));
+            }
+        }
+    }
+
+    std::uint32_t CArchetype::chunkSize(std::size_t chunk) const {
+        const std::size_t begin = chunk * m_chunkCapacity;
+        return static_cast<std::uint32_t>(std::min<std::size_t>(m_chunkCapacity, m_count - begin));
+    }
+
+    bool CArchetype::hasAll(const std::vector<std::uint32_t>& sortedTypes) const {
+        return std::includes(m_signature.begin(), m_signature.end(), sortedTypes.begin(), sortedTypes.end());
+    }
+
+    std::uint32_t CArchetype::pushEntity(SEntityHandle entity) {
+        const std::uint32_t row = m_count;
+        if (row / m_chunkCapacity >= m_chunks.size()) {
+            m_chunks.emplace_back(static_cast<std::byte*>(::operator new[](m_chunkBytes, std::align_val_t(CHUNK_ALIGN))));
+        }
+        entities(row / m_chunkCapacity)[row % m_chunkCapacity] = entity;
+        ++m_count;
+        return row;
+    }
+
+    SEntityHandle CArchetype::swapRemove(std::uint32_t row) {
+        const std::uint32_t last = m_count - 1;
+        SEntityHandle moved{};
+
+        for (std::size_t c = 0; c < m_infos.size(); ++c) {
+            const int column = static_cast<int>(c);
+            info(column).destroy(component(row, column));
+            if (row != last) {
+                info(column).moveConstruct(component(row, column), component(last, column));
+                info(column).destroy(component(last, column));
+            }
+        }
+        if (row != last) {
+            moved = entityAt(last);
+            entities(row / m_chunkCapacity)[row % m_chunkCapacity] = moved;
+        }
+        --m_count;
+
+        // Keep one spare chunk around to avoid thrashing at chunk boundaries.
+        while (m_chunks.size() > chunkCount() + 1) m_chunks.pop_back();
+        return moved;
+    }
+
+    // ---- CArchetypeStorage ----
+
+    const CArchetypeStorage::SLocation* CArchetypeStorage::locate(SEntityHandle entity) const {
+        if (entity.index >= m_locations.size()) return nullptr;
+        const SLocation& loc = m_locations[entity.index];
+        if (loc.archetype == NO_ARCHETYPE) return nullptr;
+        if (m_archetypes[loc.archetype]->entityAt(loc.row) != entity) return nullptr;
+        return &loc;
+    }
+
+    std::uint32_t CArchetypeStorage::findOrCreateArchetype(const std::vector<std::uint32_t>& signature) {
+        auto it = m_archetypeIndex.find(signature);
+        if (it != m_archetypeIndex.end()) return it->second;
+
+        std::vector<const SComponentInfo*> infos;
+        infos.reserve(signature.size());
+        for (std::uint32_t typeId : signature) infos.push_back(m_infos[typeId]);
+
+        const auto index = static_cast<std::uint32_t>(m_archetypes.size());
+        m_archetypes.push_back(std::make_unique<CArchetype>(signature, std::move(infos)));
+        m_archetypeIndex.emplace(signature, index);
+
+        // Keep cached queries current.
+        std::lock_guard<std::mutex> lock(m_queryMutex);
+        for (auto& bucket : m_queries) {
+            for (auto& query : bucket.second) {
+                if (m_archetypes[index]->hasAll(query->types)) query->archetypes.push_back(index);
+            }
+        }
+        return index;
+    }
+
+    std::uint32_t CArchetypeStorage::transition(std::uint32_t from, std::uint32_t typeId, bool add) {
+        if (from != NO_ARCHETYPE) {
+            auto& edges = add ? m_archetypes[from]->addEdges : m_archetypes[from]->removeEdges;
+            auto it = edges.find(typeId);
+            if (it != edges.end()) return it->second;
+        }
+
+        std::vector<std::uint32_t> signature;
+        if (from != NO_ARCHETYPE) signature = m_archetypes[from]->signature();
+        if (add) {
+            signature.insert(std::lower_bound(signature.begin(), signature.end(), typeId), typeId);
+        } else {
+            signature.erase(std::lower_bound(signature.begin(), signature.end(), typeId));
+        }
+
+        const std::uint32_t target = findOrCreateArchetype(signature);
+        if (from != NO_ARCHETYPE) {
+            (add ? m_archetypes[from]->addEdges : m_archetypes[from]->removeEdges)[typeId] = target;
+        }
+        return target;
+    }
+
+    void CArchetypeStorage::removeRow(std::uint32_t archetype, std::uint32_t row) {
+        const SEntityHandle moved = m_archetypes[archetype]->swapRemove(row);
+        if (moved.isValid()) m_locations[moved.index].row = row;
+    }
+
+    void CArchetypeStorage::moveEntity(SEntityHandle entity, std::uint32_t target, std::uint32_t constructType) {
+        SLocation& loc = m_locations[entity.index];
+        CArchetype& dst = *m_archetypes[target];
+        const std::uint32_t newRow = dst.pushEntity(entity);
+
+        if (loc.archetype != NO_ARCHETYPE) {
+            CArchetype& src = *m_archetypes[loc.archetype];
+            for (std::uint32_t typeId : dst.signature()) {
+                const int srcColumn = src.column(typeId);
+                if (srcColumn < 0) continue;
+                m_infos[typeId]->moveConstruct(dst.component(newRow, dst.column(typeId)),
+                                               src.component(loc.row, srcColumn));
+            }
+            // Moved-from values are destroyed by swapRemove.
+            removeRow(loc.archetype, loc.row);
+        }
+
+        if (constructType != NO_ARCHETYPE) {
+            m_infos[constructType]->construct(dst.component(newRow, dst.column(constructType)));
+        }
+        loc = { target, newRow };
+    }
+
+    void* CArchetypeStorage::add(SEntityHandle entity, std::uint32_t typeId, const SComponentInfo& info) {
+        if (typeId >= m_infos.size()) m_infos.resize(typeId + 1, nullptr);
+        m_infos[typeId] = &info;
+
+        if (entity.index >= m_locations.size()) m_locations.resize(entity.index + 1);
+
+        const SLocation* loc = locate(entity);
+        const std::uint32_t from = loc ? loc->archetype : NO_ARCHETYPE;
+        if (loc) {
+            const int column = m_archetypes[from]->column(typeId);
+            if (column >= 0) return m_archetypes[from]->component(loc->row, column);
+        } else {
+            m_locations[entity.index] = SLocation{};
+        }
+
+        const std::uint32_t target = transition(from, typeId, true);
+        moveEntity(entity, target, typeId);
+        const SLocation& now = m_locations[entity.index];
+        return m_archetypes[now.archetype]->component(now.row, m_archetypes[now.archetype]->column(typeId));
+    }
+
+    void CArchetypeStorage::remove(SEntityHandle entity, std::uint32_t typeId) {
+        const SLocation* loc = locate(entity);
+        if (!loc || m_archetypes[loc->archetype]->column(typeId) < 0) return;
+
+        const std::uint32_t from = loc->archetype;
+        if (m_archetypes[from]->signature().size() == 1) {
+            removeRow(from, loc->row);
+            m_locations[entity.index] = SLocation{};
+            return;
+        }
+        moveEntity(entity, transition(from, typeId, false), NO_ARCHETYPE);
+    }
+
+    void* CArchetypeStorage::get(SEntityHandle entity, std::uint32_t typeId) {
+        const SLocation* loc = locate(entity);
+        if (!loc) return nullptr;
+        CArchetype& arch = *m_archetypes[loc->archetype];
+        const int column = arch.column(typeId);
+        return column >= 0 ? arch.component(loc->row, column) : nullptr;
+    }
+
+    bool CArchetypeStorage::has(SEntityHandle entity, std::uint32_t typeId) const {
+        const SLocation* loc = locate(entity);
+        return loc && m_archetypes[loc->archetype]->column(typeId) >= 0;
+    }
+
+    void CArchetypeStorage::destroy(SEntityHandle entity) {
+        const SLocation* loc = locate(entity);
+        if (!loc) return;
+        removeRow(loc->archetype, loc->row);
+        m_locations[entity.index] = SLocation{};
+    }
+
+    const std::vector<std::uint32_t>& CArchetypeStorage::query(const std::uint32_t* sortedTypes, std::size_t count) {
+        // FNV-1a over the type ids; collisions are resolved by comparing the lists.
+        std::uint64_t hash = 14695981039346656037ull;
+        for (std::size_t i = 0; i < count; ++i) {
+            hash = (hash ^ sortedTypes[i]) * 1099511628211ull;
+        }
+
+        std::lock_guard<std::mutex> lock(m_queryMutex);
+        auto& bucket = m_queries[hash];
+        for (const auto& cached : bucket) {
+            if (std::equal(cached->types.begin(), cached->types.end(), sortedTypes, sortedTypes + count)) {
+                return cached->archetypes;
+            }
+        }
+
+        SQuery& created = *bucket.emplace_back(std::make_unique<SQuery>());
+        created.types.assign(sortedTypes, sortedTypes + count);
+        for (std::uint32_t i = 0; i < m_archetypes.size(); ++i) {
+            if (m_archetypes[i]->hasAll(created.types)) created.archetypes.push_back(i);
+        }
+        return created.archetypes;
+    }
+
+} // namespace Kinetica
@@ -0,0 +1,114 @@
+#include <kinetica/ecs/command_buffer.hpp>
+
+#include <atomic>
+
+namespace Kinetica {
+
+    bool CCommandBuffer::empty() const {
+        if (m_spawnCount > 0 || !m_removes.empty() || !m_destroys.empty()) return false;
+        for (const auto& list : m_adds) {
+            if (list && !list->empty()) return false;
+        }
+        return true;
+    }
+
+    void CCommandBuffer::clear() {
+        m_spawnCount = 0;
+        for (auto& list : m_adds) {
+            if (list) list->clear();
+        }
+        m_removes.clear();
+        m_destroys.clear();
+    }
+
+    void CCommandBuffer::flush(CRegistry& registry) {
+        CCommandBuffer* self = this;
+        applyAll(registry, &self, 1);
+    }
+
+    void CCommandBuffer::applyAll(CRegistry& registry, CCommandBuffer* const* buffers, std::size_t count) {
+        // 1. Spawns, and bind every buffer's deferred entities to real ones.
+        std::size_t totalSpawns = 0;
+        for (std::size_t b = 0; b < count; ++b) totalSpawns += buffers[b]->m_spawnCount;
+        registry.reserveEntities(totalSpawns);
+
+        std::vector<EntityID> spawned;
+        std::size_t maxTypes = 0;
+        for (std::size_t b = 0; b < count; ++b) {
+            CCommandBuffer& buffer = *buffers[b];
+            spawned.clear();
+            for (std::uint32_t i = 0; i < buffer.m_spawnCount; ++i) spawned.push_back(registry.createEntity());
+            for (auto& list : buffer.m_adds) {
+                if (list) list->resolve(spawned);
+            }
+            maxTypes = std::max(maxTypes, buffer.m_adds.size());
+        }
+
+        // 2. Adds: merge each type's lists across buffers, then insert sorted.
+        for (std::size_t typeId = 0; typeId < maxTypes; ++typeId) {
+            IAddList* merged = nullptr;
+            for (std::size_t b = 0; b < count; ++b) {
+                auto& adds = buffers[b]->m_adds;
+                if (typeId >= adds.size() || !adds[typeId] || adds[typeId]->empty()) continue;
+                if (!merged) merged = adds[typeId].get();
+                else merged->absorb(*adds[typeId]);
+            }
+            if (merged) merged->apply(registry);
+        }
+
+        // 3. Removes, grouped by type and in entity order.
+        std::vector<SRemove> removes;
+        for (std::size_t b = 0; b < count; ++b) {
+            auto& source = buffers[b]->m_removes;
+            removes.insert(removes.end(), source.begin(), source.end());
+        }
+        std::stable_sort(removes.begin(), removes.end(), [](const SRemove& a, const SRemove& b) {
+            return a.typeId != b.typeId ? a.typeId < b.typeId : a.entity.index < b.entity.index;
+        });
+        for (const SRemove& remove : removes) remove.apply(registry, remove.entity);
+
+        // 4. Destroys.
+        for (std::size_t b = 0; b < count; ++b) {
+            for (EntityID entity : buffers[b]->m_destroys) registry.destroyEntity(entity);
+        }
+
+        for (std::size_t b = 0; b < count; ++b) buffers[b]->clear();
+    }
+
+    // ---- CCommandQueue ----
+
+    static std::atomic<std::uint64_t> s_nextQueueId{1};
+
+    // One-entry cache of the last queue/buffer this thread used, so the common
+    // case of local() is two compares and no lock.
+    struct SLocalBufferCache {
+        std::uint64_t queueId = 0;
+        CCommandBuffer* buffer = nullptr;
+    };
+    static thread_local SLocalBufferCache t_localBuffer;
+
+    CCommandQueue::CCommandQueue() : m_id(s_nextQueueId.fetch_add(1, std::memory_order_relaxed)) {}
+
+    CCommandBuffer& CCommandQueue::local() {
+        if (t_localBuffer.queueId == m_id) return *t_localBuffer.buffer;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& buffer = m_buffers[std::this_thread::get_id()];
+        if (!buffer) buffer = std::make_unique<CCommandBuffer>();
+        t_localBuffer = { m_id, buffer.get() };
+        return *buffer;
+    }
+
+    void CCommandQueue::flush(CRegistry& registry) {
+        std::vector<CCommandBuffer*> buffers;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            buffers.reserve(m_buffers.size());
+            for (auto& pair : m_buffers) {
+                if (!pair.second->empty()) buffers.push_back(pair.second.get());
+            }
+        }
+        CCommandBuffer::applyAll(registry, buffers.data(), buffers.size());
+    }
+
+} // namespace Kinetica
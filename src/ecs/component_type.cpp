@@ -0,0 +1,63 @@
+#include <kinetica/ecs/component_type.hpp>
+#include <kinetica/log.hpp>
+
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Kinetica {
+
+    namespace {
+        struct SComponentTypeTable {
+            std::mutex mutex;
+            std::unordered_map<std::string, std::uint32_t> ids;
+            std::vector<std::string> names;
+            std::vector<const SComponentInfo*> infos;
+        };
+
+        SComponentTypeTable& table() {
+            static SComponentTypeTable instance;
+            return instance;
+        }
+    }
+
+    std::uint32_t registerComponentType(std::string_view name, const SComponentInfo& info) {
+        auto& t = table();
+        std::lock_guard<std::mutex> lock(t.mutex);
+
+        auto it = t.ids.find(std::string(name));
+        if (it != t.ids.end()) return it->second;
+
+        const auto id = static_cast<std::uint32_t>(t.names.size());
+        if (id >= MAX_COMPONENT_TYPES) {
+            KLOG_ERROR("Too many component types (max " + std::to_string(MAX_COMPONENT_TYPES) + "), cannot register " + std::string(name));
+            std::abort();
+        }
+
+        t.ids.emplace(std::string(name), id);
+        t.names.emplace_back(name);
+        t.infos.push_back(&info);
+        return id;
+    }
+
+    std::uint32_t componentTypeCount() {
+        auto& t = table();
+        std::lock_guard<std::mutex> lock(t.mutex);
+        return static_cast<std::uint32_t>(t.names.size());
+    }
+
+    const SComponentInfo* componentTypeInfo(std::uint32_t id) {
+        auto& t = table();
+        std::lock_guard<std::mutex> lock(t.mutex);
+        return id < t.infos.size() ? t.infos[id] : nullptr;
+    }
+
+    std::string_view componentTypeName(std::uint32_t id) {
+        auto& t = table();
+        std::lock_guard<std::mutex> lock(t.mutex);
+        return id < t.names.size() ? std::string_view(t.names[id]) : std::string_view();
+    }
+
+} // namespace Kinetica
@@ -0,0 +1,246 @@
+#include <kinetica/ecs/picking.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace Kinetica {
+
+    using Components::SMesh;
+
+    namespace {
+
+        // Maps the NDC rectangle onto the full [-1, 1] range, so planes extracted
+        // from (result * viewProjection) bound exactly the rectangle.
+        glm::mat4 rectangleViewProjection(const glm::mat4& viewProjection, glm::vec2 ndcMin, glm::vec2 ndcMax) {
+            const float width = std::max(ndcMax.x - ndcMin.x, 1e-6f);
+            const float height = std::max(ndcMax.y - ndcMin.y, 1e-6f);
+            glm::mat4 rect(1.0f);
+            rect[0][0] = 2.0f / width;
+            rect[1][1] = 2.0f / height;
+            rect[3][0] = -(ndcMin.x + ndcMax.x) / width;
+            rect[3][1] = -(ndcMin.y + ndcMax.y) / height;
+            return rect * viewProjection;
+        }
+
+        // Crossing-number test.
+        bool insidePolygon(std::span<const glm::vec2> polygon, float x, float y) {
+            bool inside = false;
+            for (std::size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+                const glm::vec2 a = polygon[i], b = polygon[j];
+                if ((a.y > y) != (b.y > y) && x < (b.x - a.x) * (y - a.y) / (b.y - a.y) + a.x) inside = !inside;
+            }
+            return inside;
+        }
+
+    } // namespace
+
+    CPicking::CPicking(CRegistry& registry, const CTransformHierarchy& hierarchy, const CSceneCulling& culling)
+        : m_registry(registry), m_hierarchy(hierarchy), m_culling(culling) {}
+
+    const Geometry::CTriangleBVH* CPicking::meshBVH(EntityID entity) {
+        const SMesh* mesh = m_registry.getComponent<SMesh>(entity);
+        return mesh ? meshBVH(entity, *mesh) : nullptr;
+    }
+
+    const Geometry::CTriangleBVH* CPicking::meshBVH(EntityID entity, const SMesh& mesh) {
+        if (entity.index >= m_cache.size()) m_cache.resize(entity.index + 1);
+        SCacheEntry& entry = m_cache[entity.index];
+
+        const bool sameMesh = entry.entity == entity && entry.meshIdentity == mesh.identity && !entry.bvh.empty();
+        if (!sameMesh || entry.indexRevision != mesh.indexRevision || entry.triangleCount != mesh.indices.size() ||
+            entry.vertexCount != mesh.vertices.size()) {
+            entry.bvh.build(mesh);
+            ++m_stats.builds;
+        } else if (entry.vertexRevision != mesh.vertexRevision) {
+            entry.bvh.refit(mesh);
+            ++m_stats.refits;
+        }
+        entry.entity = entity;
+        entry.meshIdentity = mesh.identity;
+        entry.vertexRevision = mesh.vertexRevision;
+        entry.indexRevision = mesh.indexRevision;
+        entry.vertexCount = mesh.vertices.size();
+        entry.triangleCount = mesh.indices.size();
+        return &entry.bvh;
+    }
+
+    void CPicking::collectGarbage() {
+        for (SCacheEntry& entry : m_cache) {
+            if (entry.bvh.empty()) continue;
+            if (!m_registry.isAlive(entry.entity) || !m_registry.hasComponent<SMesh>(entry.entity)) entry = SCacheEntry{};
+        }
+    }
+
+    SPickHit CPicking::makeHit(EntityID entity, const SMesh& mesh, const glm::mat4& world, const Math::SRay& ray,
+                               const Geometry::SRayHit& h) const {
+        SPickHit hit;
+        hit.entity = entity;
+        hit.triangle = h.triangle;
+        hit.t = h.t;
+        hit.u = h.u;
+        hit.v = h.v;
+        hit.position = ray.at(h.t);
+
+        // Nearest corner and edge by world-space distance, so a non-uniform
+        // scale or a sliver triangle cannot skew them.
+        const Components::SIndex& tri = mesh.indices[h.triangle];
+        const std::uint32_t corners[3] = {tri.a, tri.b, tri.c};
+        glm::vec3 points[3];
+        for (int i = 0; i < 3; ++i) {
+            const Components::SVertex& v = mesh.vertices[corners[i]];
+            points[i] = glm::vec3(world * glm::vec4(v.x, v.y, v.z, 1.0f));
+        }
+        float vertexDistance = std::numeric_limits<float>::max();
+        float edgeDistance = std::numeric_limits<float>::max();
+        for (std::uint32_t i = 0; i < 3; ++i) {
+            const glm::vec3 toCorner = hit.position - points[i];
+            const float d = glm::dot(toCorner, toCorner);
+            if (d < vertexDistance) {
+                vertexDistance = d;
+                hit.vertex = corners[i];
+            }
+
+            const glm::vec3 edge = points[(i + 1) % 3] - points[i];
+            const float length2 = glm::dot(edge, edge);
+            const float s = length2 > 0.0f ? std::clamp(glm::dot(toCorner, edge) / length2, 0.0f, 1.0f) : 0.0f;
+            const glm::vec3 offset = toCorner - edge * s;
+            const float e = glm::dot(offset, offset);
+            if (e < edgeDistance) {
+                edgeDistance = e;
+                hit.edge = i;
+            }
+        }
+        return hit;
+    }
+
+    bool CPicking::pick(const Math::SRay& ray, SPickHit& hit, float maxT) {
+        m_stats.meshesTested = 0;
+        bool found = false;
+        m_culling.tree().raycast(ray, maxT, [&](std::uint32_t userData, float) {
+            const EntityID entity = m_culling.entityOf(userData);
+            const SMesh* mesh = m_registry.getComponent<SMesh>(entity);
+            const glm::mat4* world = m_hierarchy.worldMatrix(entity);
+            if (!mesh || !world) return maxT;
+
+            ++m_stats.meshesTested;
+            const Geometry::CTriangleBVH* bvh = meshBVH(entity, *mesh);
+            Geometry::SRayHit h;
+            // The object-space ray keeps the world-space parameter.
+            if (bvh->intersect(*mesh, ray.transformed(glm::inverse(*world)), maxT, h)) {
+                maxT = h.t;
+                hit = makeHit(entity, *mesh, *world, ray, h);
+                found = true;
+            }
+            return maxT;
+        });
+        return found;
+    }
+
+    void CPicking::pickAll(const Math::SRay& ray, std::vector<SPickHit>& hits, float maxT) {
+        m_stats.meshesTested = 0;
+        hits.clear();
+        m_culling.tree().raycast(ray, maxT, [&](std::uint32_t userData, float) {
+            const EntityID entity = m_culling.entityOf(userData);
+            const SMesh* mesh = m_registry.getComponent<SMesh>(entity);
+            const glm::mat4* world = m_hierarchy.worldMatrix(entity);
+            if (!mesh || !world) return maxT;
+
+            ++m_stats.meshesTested;
+            m_rayHits.clear();
+            meshBVH(entity, *mesh)->intersectAll(*mesh, ray.transformed(glm::inverse(*world)), maxT, m_rayHits);
+            for (const Geometry::SRayHit& h : m_rayHits) hits.push_back(makeHit(entity, *mesh, *world, ray, h));
+            return maxT;
+        });
+        std::sort(hits.begin(), hits.end(), [](const SPickHit& a, const SPickHit& b) { return a.t < b.t; });
+    }
+
+    void CPicking::candidates(const glm::mat4& rectViewProjection, std::vector<EntityID>& out) const {
+        out.clear();
+        m_culling.tree().query(Math::SFrustum::fromMatrix(rectViewProjection),
+            [&](std::uint32_t userData) { out.push_back(m_culling.entityOf(userData)); });
+    }
+
+    void CPicking::selectBox(const glm::mat4& viewProjection, glm::vec2 ndcMin, glm::vec2 ndcMax, std::vector<EntityID>& out) {
+        m_stats.meshesTested = 0;
+        out.clear();
+        const glm::mat4 rect = rectangleViewProjection(viewProjection, ndcMin, ndcMax);
+        candidates(rect, m_candidates);
+
+        for (EntityID entity : m_candidates) {
+            const SMesh* mesh = m_registry.getComponent<SMesh>(entity);
+            const glm::mat4* world = m_hierarchy.worldMatrix(entity);
+            if (!mesh || !world) continue;
+
+            // Planes of rect * world are the selection frustum in object space.
+            const Math::SFrustum local = Math::SFrustum::fromMatrix(rect * *world);
+            if (!mesh->boundsDirty && !mesh->localBounds.isEmpty() &&
+                local.classify(mesh->localBounds) == Math::EContainment::Inside) {
+                out.push_back(entity);
+                continue;
+            }
+            ++m_stats.meshesTested;
+            m_triangleScratch.clear();
+            meshBVH(entity, *mesh)->overlapFrustum(*mesh, local, m_triangleScratch, 1);
+            if (!m_triangleScratch.empty()) out.push_back(entity);
+        }
+    }
+
+    void CPicking::selectLasso(const glm::mat4& viewProjection, std::span<const glm::vec2> ndcPolygon, std::vector<EntityID>& out) {
+        m_stats.meshesTested = 0;
+        out.clear();
+        if (ndcPolygon.size() < 3) return;
+
+        glm::vec2 lo = ndcPolygon[0], hi = ndcPolygon[0];
+        for (const glm::vec2& p : ndcPolygon) {
+            lo = glm::vec2(std::min(lo.x, p.x), std::min(lo.y, p.y));
+            hi = glm::vec2(std::max(hi.x, p.x), std::max(hi.y, p.y));
+        }
+        const glm::mat4 rect = rectangleViewProjection(viewProjection, lo, hi);
+        candidates(rect, m_candidates);
+
+        const Math::SRay anchor = Math::SRay::fromNdc(viewProjection, ndcPolygon[0].x, ndcPolygon[0].y);
+        for (EntityID entity : m_candidates) {
+            const SMesh* mesh = m_registry.getComponent<SMesh>(entity);
+            const glm::mat4* world = m_hierarchy.worldMatrix(entity);
+            if (!mesh || !world) continue;
+
+            ++m_stats.meshesTested;
+            const Geometry::CTriangleBVH* bvh = meshBVH(entity, *mesh);
+            m_triangleScratch.clear();
+            bvh->overlapFrustum(*mesh, Math::SFrustum::fromMatrix(rect * *world), m_triangleScratch);
+
+            const glm::mat4 mvp = viewProjection * *world;
+            bool selected = false;
+            for (std::uint32_t triangle : m_triangleScratch) {
+                const Components::SIndex& tri = mesh->indices[triangle];
+                for (std::uint32_t index : {tri.a, tri.b, tri.c}) {
+                    const Components::SVertex& v = mesh->vertices[index];
+                    const glm::vec4 clip = mvp * glm::vec4(v.x, v.y, v.z, 1.0f);
+                    if (clip.w > 0.0f && insidePolygon(ndcPolygon, clip.x / clip.w, clip.y / clip.w)) {
+                        selected = true;
+                        break;
+                    }
+                }
+                if (selected) break;
+            }
+
+            // A lasso drawn entirely inside one large triangle contains no vertex.
+            Geometry::SRayHit h;
+            if (!selected && !m_triangleScratch.empty())
+                selected = bvh->intersect(*mesh, anchor.transformed(glm::inverse(*world)), 1.0f, h);
+            if (selected) out.push_back(entity);
+        }
+    }
+
+    void CPicking::selectTriangles(EntityID entity, const glm::mat4& viewProjection, glm::vec2 ndcMin, glm::vec2 ndcMax,
+                                   std::vector<std::uint32_t>& out) {
+        out.clear();
+        const SMesh* mesh = m_registry.getComponent<SMesh>(entity);
+        const glm::mat4* world = m_hierarchy.worldMatrix(entity);
+        if (!mesh || !world) return;
+
+        const glm::mat4 rect = rectangleViewProjection(viewProjection, ndcMin, ndcMax);
+        meshBVH(entity, *mesh)->overlapFrustum(*mesh, Math::SFrustum::fromMatrix(rect * *world), out);
+    }
+
+} // namespace Kinetica
@@ -1,21 +1,121 @@
 #include <kinetica/ecs/registry.hpp>
 #include <kinetica/uuid.hpp>
+#include <kinetica/log.hpp>
+
+#include <algorithm>
 
 namespace Kinetica {
-    const EntityID INVALID_ENTITY = CUUID::nil();
+    const EntityID INVALID_ENTITY = SEntityHandle{};
+
+    EntityID CRegistry::allocateEntity() {
+        std::uint32_t index;
+        if (!m_freeIndices.empty()) {
+            index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+        } else {
+            index = static_cast<std::uint32_t>(m_versions.size());
+            m_versions.push_back(0);
+            m_entitySlots.push_back(INVALID_SLOT);
+            m_uuids.emplace_back();
+            m_masks.emplace_back();
+        }
+
+        EntityID id{ index, m_versions[index] };
+        m_entitySlots[index] = static_cast<std::uint32_t>(m_entities.size());
+        m_entities.push_back(id);
+        return id;
+    }
+
+    void CRegistry::reserveEntities(std::size_t count) {
+        const std::size_t reused = std::min(count, m_freeIndices.size());
+        const std::size_t slots = m_versions.size() + (count - reused);
+        m_entities.reserve(m_entities.size() + count);
+        m_entitySlots.reserve(slots);
+        m_versions.reserve(slots);
+        m_uuids.reserve(slots);
+        m_masks.reserve(slots);
+    }
 
     EntityID CRegistry::createEntity() {
-        EntityID id =  CUUID::generate();
-        m_entities.insert(id);
+        return allocateEntity();
+    }
+
+    EntityID CRegistry::createEntity(const CUUID& uuid) {
+        if (!uuid.isValid() || m_uuidToEntity.count(uuid) > 0) {
+            KLOG_WARN("Cannot create entity: UUID " + uuid.toString() + " is invalid or already in use");
+            return INVALID_ENTITY;
+        }
+
+        EntityID id = allocateEntity();
+        m_uuids[id.index] = uuid;
+        m_uuidToEntity.emplace(uuid, id);
         return id;
     }
 
     void CRegistry::destroyEntity(EntityID id) {
-        if (m_entities.erase(id) == 0) return;
+        if (!isAlive(id)) return;
+
+        // Only visit the pools the entity actually has a component in.
+        const ComponentMask& mask = m_masks[id.index];
+        for (std::uint32_t typeId = 0; typeId < m_removeHooks.size(); ++typeId) {
+            if (mask.test(typeId)) runRemoveHook(id, typeId);
+        }
+        if (m_mode == EStorageMode::Archetype) {
+            m_archetypes.destroy(id);
+        } else {
+            for (std::uint32_t typeId = 0; typeId < m_storages.size(); ++typeId) {
+                if (mask.test(typeId)) m_storages[typeId]->erase(id);
+            }
+        }
+        for (std::uint32_t typeId = 0; typeId < m_typeVersions.size(); ++typeId) {
+            if (mask.test(typeId)) ++m_typeVersions[typeId];
+        }
+        m_masks[id.index].reset();
+
+        // Swap-and-pop out of the live list.
+        const std::uint32_t slot = m_entitySlots[id.index];
+        const EntityID last = m_entities.back();
+        m_entities[slot] = last;
+        m_entitySlots[last.index] = slot;
+        m_entities.pop_back();
+        m_entitySlots[id.index] = INVALID_SLOT;
+
+        if (m_uuids[id.index].isValid()) {
+            m_uuidToEntity.erase(m_uuids[id.index]);
+            m_uuids[id.index] = CUUID();
+        }
+
+        ++m_versions[id.index];
+        m_freeIndices.push_back(id.index);
+    }
 
-        for (auto& pair : m_storages) {
-            pair.second->erase(id);
+    void CRegistry::runRemoveHook(EntityID entity, std::uint32_t typeId) {
+        if (typeId >= m_removeHooks.size() || !m_removeHooks[typeId]) return;
+        void* component = m_mode == EStorageMode::Archetype ? m_archetypes.get(entity, typeId)
+                                                            : m_storages[typeId]->get(entity);
+        if (component) m_removeHooks[typeId](entity, component);
+    }
+
+    const CUUID& CRegistry::getUUID(EntityID id) {
+        static const CUUID invalid;
+        if (!isAlive(id)) return invalid;
+
+        CUUID& uuid = m_uuids[id.index];
+        if (!uuid.isValid()) {
+            uuid = CUUID::generate();
+            m_uuidToEntity.emplace(uuid, id);
         }
+        return uuid;
+    }
+
+    const ComponentMask& CRegistry::getMask(EntityID id) const {
+        static const ComponentMask empty;
+        return isAlive(id) ? m_masks[id.index] : empty;
+    }
+
+    EntityID CRegistry::findEntity(const CUUID& uuid) const {
+        auto it = m_uuidToEntity.find(uuid);
+        return (it != m_uuidToEntity.end()) ? it->second : INVALID_ENTITY;
     }
 
 } // namespace Kinetica
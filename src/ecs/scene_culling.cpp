@@ -0,0 +1,89 @@
+#include <kinetica/ecs/scene_culling.hpp>
+
+namespace Kinetica {
+
+    using Components::SMesh;
+    using Components::STransform;
+    using Geometry::CDynamicBVH;
+
+    static Math::SAABB worldBounds(const SMesh& mesh, const glm::mat4& world) {
+        if (mesh.localBounds.isEmpty()) {
+            const glm::vec3 origin(world[3]);
+            return {origin, origin};
+        }
+        return mesh.localBounds.transformed(world);
+    }
+
+    CSceneCulling::CSceneCulling(CRegistry& registry, float margin) : m_registry(registry), m_tree(margin) {}
+
+    void CSceneCulling::rebuildProxies(const CTransformHierarchy& hierarchy) {
+        // Mark every current owner, create missing proxies, then drop the rest.
+        ++m_pass;
+        m_registry.view<STransform, SMesh>().each([&](EntityID entity, const STransform& transform, SMesh& mesh) {
+            if (entity.index >= m_slots.size()) m_slots.resize(entity.index + 1);
+            SSlot& slot = m_slots[entity.index];
+            if (slot.proxy != CDynamicBVH::NULL_NODE && slot.entity != entity) {
+                m_tree.destroyProxy(slot.proxy);
+                slot.proxy = CDynamicBVH::NULL_NODE;
+            }
+            slot.entity = entity;
+            slot.seen = m_pass;
+            if (slot.proxy != CDynamicBVH::NULL_NODE) return;
+
+            if (mesh.boundsDirty) mesh.updateBounds();
+            const glm::mat4* world = hierarchy.worldMatrix(entity);
+            slot.proxy = m_tree.createProxy(worldBounds(mesh, world ? *world : transform.getMatrix()), entity.index);
+        });
+
+        for (SSlot& slot : m_slots) {
+            if (slot.proxy == CDynamicBVH::NULL_NODE || slot.seen == m_pass) continue;
+            m_tree.destroyProxy(slot.proxy);
+            slot = SSlot{};
+        }
+    }
+
+    void CSceneCulling::refit(EntityID entity, const glm::mat4& world) {
+        if (entity.index >= m_slots.size()) return;
+        const SSlot& slot = m_slots[entity.index];
+        if (slot.proxy == CDynamicBVH::NULL_NODE || slot.entity != entity) return;
+
+        SMesh* mesh = m_registry.getComponent<SMesh>(entity);
+        if (!mesh) return;
+        if (mesh->boundsDirty) mesh->updateBounds();
+
+        ++m_stats.refitted;
+        if (m_tree.moveProxy(slot.proxy, worldBounds(*mesh, world))) ++m_stats.reinserted;
+    }
+
+    void CSceneCulling::update(const CTransformHierarchy& hierarchy) {
+        m_stats.refitted = 0;
+        m_stats.reinserted = 0;
+
+        if (m_transformVersion != m_registry.componentVersion<STransform>() ||
+            m_meshVersion != m_registry.componentVersion<SMesh>()) {
+            rebuildProxies(hierarchy);
+            m_transformVersion = m_registry.componentVersion<STransform>();
+            m_meshVersion = m_registry.componentVersion<SMesh>();
+        }
+
+        // Moved entities (the hierarchy already narrowed these to changed subtrees)...
+        hierarchy.forEachUpdated([&](EntityID entity, const glm::mat4& world) { refit(entity, world); });
+
+        // ...and edited meshes that did not move.
+        m_registry.view<STransform, SMesh>().each([&](EntityID entity, const STransform& transform, SMesh& mesh) {
+            if (!mesh.boundsDirty) return;
+            const glm::mat4* world = hierarchy.worldMatrix(entity);
+            refit(entity, world ? *world : transform.getMatrix());
+        });
+
+        m_stats.proxies = m_tree.proxyCount();
+    }
+
+    void CSceneCulling::cull(const glm::mat4& viewProjection, std::vector<EntityID>& out) {
+        out.clear();
+        const Math::SFrustum frustum = Math::SFrustum::fromMatrix(viewProjection);
+        m_stats.nodesTested = m_tree.query(frustum, [&](std::uint32_t index) { out.push_back(m_slots[index].entity); });
+        m_stats.visible = out.size();
+    }
+
+} // namespace Kinetica
@@ -0,0 +1,66 @@
+#include <kinetica/ecs/scheduler.hpp>
+#include <kinetica/profiler.hpp>
+
+namespace Kinetica {
+
+    CScheduler::CScheduler(CRegistry& registry, CThreadPool& pool)
+        : m_registry(registry), m_pool(pool) {}
+
+    void CScheduler::addSystem(std::string name, const SSystemAccess& access, SystemFn fn) {
+        m_systems.push_back({ std::move(name), access, std::move(fn), {}, 0 });
+        m_systems.back().zone = Profile::intern(m_systems.back().name);
+        m_graphDirty = true;
+    }
+
+    void CScheduler::buildGraph() {
+        for (auto& system : m_systems) {
+            system.successors.clear();
+            system.dependencies = 0;
+        }
+
+        // A later system depends on every earlier one it conflicts with.
+        for (std::size_t later = 0; later < m_systems.size(); ++later) {
+            for (std::size_t earlier = 0; earlier < later; ++earlier) {
+                if (m_systems[earlier].access.conflictsWith(m_systems[later].access)) {
+                    m_systems[earlier].successors.push_back(later);
+                    ++m_systems[later].dependencies;
+                }
+            }
+        }
+
+        m_remaining = std::make_unique<std::atomic<std::size_t>[]>(m_systems.size());
+        m_graphDirty = false;
+    }
+
+    void CScheduler::launch(std::size_t index, CTaskGroup& group) {
+        m_pool.submit(group, [this, index, &group] {
+            SSystem& system = m_systems[index];
+            {
+                KPROFILE_SCOPE(system.zone);
+                system.fn(m_registry, m_pool);
+            }
+
+            for (std::size_t next : system.successors) {
+                if (m_remaining[next].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    launch(next, group);
+                }
+            }
+        });
+    }
+
+    void CScheduler::run() {
+        if (m_systems.empty()) return;
+        if (m_graphDirty) buildGraph();
+
+        for (std::size_t i = 0; i < m_systems.size(); ++i) {
+            m_remaining[i].store(m_systems[i].dependencies, std::memory_order_relaxed);
+        }
+
+        CTaskGroup group;
+        for (std::size_t i = 0; i < m_systems.size(); ++i) {
+            if (m_systems[i].dependencies == 0) launch(i, group);
+        }
+        m_pool.wait(group);
+    }
+
+} // namespace Kinetica
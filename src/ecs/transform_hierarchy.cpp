@@ -0,0 +1,201 @@
+#include <kinetica/ecs/transform_hierarchy.hpp>
+#include <kinetica/math/transform_batch.hpp>
+
+#include <algorithm>
+
+namespace Kinetica {
+
+    using Components::SHierarchy;
+    using Components::STransform;
+
+    CTransformHierarchy::CTransformHierarchy(CRegistry& registry) : m_registry(registry) {}
+
+    bool CTransformHierarchy::setParent(EntityID child, EntityID parent) {
+        if (!m_registry.isAlive(child)) return false;
+        if (parent.isValid()) {
+            if (!m_registry.isAlive(parent)) return false;
+            for (EntityID it = parent; it.isValid();) {
+                if (it == child) return false;
+                const SHierarchy* h = m_registry.getComponent<SHierarchy>(it);
+                it = (h && m_registry.isAlive(h->parent)) ? h->parent : INVALID_ENTITY;
+            }
+        }
+
+        // Adding may move existing SHierarchy values, so fetch pointers afterwards.
+        m_registry.addComponent<SHierarchy>(child);
+        if (parent.isValid()) m_registry.addComponent<SHierarchy>(parent);
+
+        SHierarchy& node = *m_registry.getComponent<SHierarchy>(child);
+
+        // Unlink from the previous parent's child list.
+        if (SHierarchy* oldParent = m_registry.getComponent<SHierarchy>(node.parent)) {
+            if (oldParent->firstChild == child) oldParent->firstChild = node.nextSibling;
+        }
+        if (SHierarchy* prev = m_registry.getComponent<SHierarchy>(node.prevSibling)) prev->nextSibling = node.nextSibling;
+        if (SHierarchy* next = m_registry.getComponent<SHierarchy>(node.nextSibling)) next->prevSibling = node.prevSibling;
+
+        node.parent = parent;
+        node.prevSibling = INVALID_ENTITY;
+        node.nextSibling = INVALID_ENTITY;
+
+        if (parent.isValid()) {
+            SHierarchy& parentNode = *m_registry.getComponent<SHierarchy>(parent);
+            node.nextSibling = parentNode.firstChild;
+            if (SHierarchy* next = m_registry.getComponent<SHierarchy>(parentNode.firstChild)) next->prevSibling = child;
+            parentNode.firstChild = child;
+        }
+
+        m_topologyDirty = true;
+        return true;
+    }
+
+    void CTransformHierarchy::rebuildOrder() {
+        m_order.clear();
+        m_parentPos.clear();
+        std::fill(m_positions.begin(), m_positions.end(), NO_POSITION);
+
+        std::vector<EntityID> roots;
+        m_registry.view<STransform>().each([&](EntityID entity, STransform&) {
+            const SHierarchy* h = m_registry.getComponent<SHierarchy>(entity);
+            if (!h || !m_registry.hasComponent<STransform>(h->parent)) roots.push_back(entity);
+        });
+        std::sort(roots.begin(), roots.end());
+
+        struct SFrame {
+            EntityID entity;
+            std::uint32_t parentPos;
+        };
+        std::vector<SFrame> stack;
+        std::vector<EntityID> children;
+
+        for (EntityID root : roots) {
+            stack.push_back({ root, NO_POSITION });
+            while (!stack.empty()) {
+                const SFrame frame = stack.back();
+                stack.pop_back();
+
+                const auto pos = static_cast<std::uint32_t>(m_order.size());
+                m_order.push_back(frame.entity);
+                m_parentPos.push_back(frame.parentPos);
+                if (frame.entity.index >= m_positions.size()) m_positions.resize(frame.entity.index + 1, NO_POSITION);
+                m_positions[frame.entity.index] = pos;
+
+                const SHierarchy* h = m_registry.getComponent<SHierarchy>(frame.entity);
+                if (!h) continue;
+
+                // Push children reversed so they come out in sibling order.
+                children.clear();
+                for (EntityID c = h->firstChild; m_registry.isAlive(c);) {
+                    if (m_registry.hasComponent<STransform>(c)) children.push_back(c);
+                    const SHierarchy* ch = m_registry.getComponent<SHierarchy>(c);
+                    c = ch ? ch->nextSibling : INVALID_ENTITY;
+                }
+                for (auto it = children.rbegin(); it != children.rend(); ++it) stack.push_back({ *it, pos });
+            }
+        }
+
+        // Preorder: a subtree ends where the furthest of its descendants ends.
+        const auto count = static_cast<std::uint32_t>(m_order.size());
+        m_subtreeEnd.resize(count);
+        for (std::uint32_t p = 0; p < count; ++p) m_subtreeEnd[p] = p + 1;
+        for (std::uint32_t p = count; p-- > 0;) {
+            if (m_parentPos[p] != NO_POSITION) {
+                m_subtreeEnd[m_parentPos[p]] = std::max(m_subtreeEnd[m_parentPos[p]], m_subtreeEnd[p]);
+            }
+        }
+        m_world.resize(count);
+
+        m_transformVersion = m_registry.componentVersion<STransform>();
+        m_hierarchyVersion = m_registry.componentVersion<SHierarchy>();
+        m_topologyDirty = false;
+    }
+
+    void CTransformHierarchy::updateRange(std::uint32_t begin, std::uint32_t end) {
+        // Locals are composed in blocks: gather SoA, run the batch kernel, then
+        // chain with the parents (which always precede their children).
+        constexpr std::uint32_t BLOCK = 256;
+        thread_local Math::STransformSoABuffer soa;
+        thread_local std::vector<const STransform*> transforms;
+        thread_local std::vector<glm::mat4> locals;
+        soa.resize(BLOCK);
+        transforms.resize(BLOCK);
+        locals.resize(BLOCK);
+
+        for (std::uint32_t blockBegin = begin; blockBegin < end; blockBegin += BLOCK) {
+            const std::uint32_t count = std::min(BLOCK, end - blockBegin);
+            for (std::uint32_t k = 0; k < count; ++k) {
+                transforms[k] = m_registry.getComponent<STransform>(m_order[blockBegin + k]);
+                soa.set(k, *transforms[k]);
+            }
+            Math::composeTRS(soa.view(), locals.data(), count);
+
+            for (std::uint32_t k = 0; k < count; ++k) {
+                const std::uint32_t p = blockBegin + k;
+                const STransform& transform = *transforms[k];
+                transform.matrix = locals[k];
+                transform.isDirty = false;
+                transform.isWorldDirty = false;
+                m_world[p] = (m_parentPos[p] == NO_POSITION) ? locals[k] : m_world[m_parentPos[p]] * locals[k];
+            }
+        }
+    }
+
+    void CTransformHierarchy::updateRanges(CThreadPool* pool) {
+        m_lastUpdateCount = 0;
+        for (const SRange& range : m_ranges) m_lastUpdateCount += range.end - range.begin;
+
+        // Disjoint subtrees are independent.
+        constexpr std::size_t PARALLEL_THRESHOLD = 4096;
+        if (pool && m_ranges.size() > 1 && m_lastUpdateCount >= PARALLEL_THRESHOLD) {
+            pool->parallelFor(m_ranges.size(), 1, [this](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) updateRange(m_ranges[i].begin, m_ranges[i].end);
+            });
+            return;
+        }
+        for (const SRange& range : m_ranges) updateRange(range.begin, range.end);
+    }
+
+    void CTransformHierarchy::update(CThreadPool* pool) {
+        m_ranges.clear();
+
+        const bool structureChanged = m_topologyDirty
+            || m_transformVersion != m_registry.componentVersion<STransform>()
+            || m_hierarchyVersion != m_registry.componentVersion<SHierarchy>();
+        if (structureChanged) {
+            rebuildOrder();
+            for (std::uint32_t p = 0; p < m_order.size(); p = m_subtreeEnd[p]) {
+                m_ranges.push_back({ p, m_subtreeEnd[p] });
+            }
+            updateRanges(pool);
+            return;
+        }
+
+        // Find changed transforms with one linear scan of the pool...
+        m_dirty.clear();
+        m_registry.view<STransform>().each([&](EntityID entity, const STransform& transform) {
+            if (transform.isDirty || transform.isWorldDirty) m_dirty.push_back(m_positions[entity.index]);
+        });
+        if (m_dirty.empty()) {
+            m_lastUpdateCount = 0;
+            return;
+        }
+
+        // ...then keep only the outermost dirty subtrees.
+        std::sort(m_dirty.begin(), m_dirty.end());
+        std::uint32_t coveredEnd = 0;
+        for (std::uint32_t p : m_dirty) {
+            if (p < coveredEnd) continue;
+            m_ranges.push_back({ p, m_subtreeEnd[p] });
+            coveredEnd = m_subtreeEnd[p];
+        }
+        updateRanges(pool);
+    }
+
+    const glm::mat4* CTransformHierarchy::worldMatrix(EntityID entity) const {
+        if (entity.index >= m_positions.size()) return nullptr;
+        const std::uint32_t pos = m_positions[entity.index];
+        if (pos == NO_POSITION || pos >= m_order.size() || m_order[pos] != entity) return nullptr;
+        return &m_world[pos];
+    }
+
+} // namespace Kinetica
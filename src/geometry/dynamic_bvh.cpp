@@ -0,0 +1,210 @@
+#include <kinetica/geometry/dynamic_bvh.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace Kinetica::Geometry {
+
+    using Math::SAABB;
+
+    CDynamicBVH::CDynamicBVH(float margin) : m_margin(margin) {}
+
+    std::uint32_t CDynamicBVH::allocateNode() {
+        if (m_freeList == NULL_NODE) {
+            m_nodes.emplace_back();
+            return static_cast<std::uint32_t>(m_nodes.size() - 1);
+        }
+        const std::uint32_t id = m_freeList;
+        m_freeList = m_nodes[id].parent;
+        m_nodes[id] = SNode{};
+        return id;
+    }
+
+    void CDynamicBVH::freeNode(std::uint32_t id) {
+        m_nodes[id].parent = m_freeList;
+        m_nodes[id].height = -1;
+        m_freeList = id;
+    }
+
+    std::uint32_t CDynamicBVH::createProxy(const SAABB& box, std::uint32_t userData) {
+        const std::uint32_t leaf = allocateNode();
+        const glm::vec3 margin(m_margin);
+        m_nodes[leaf].box.min = box.min - margin;
+        m_nodes[leaf].box.max = box.max + margin;
+        m_nodes[leaf].userData = userData;
+        m_nodes[leaf].height = 0;
+        insertLeaf(leaf);
+        ++m_proxyCount;
+        return leaf;
+    }
+
+    void CDynamicBVH::destroyProxy(std::uint32_t proxy) {
+        if (proxy >= m_nodes.size() || !m_nodes[proxy].isLeaf() || m_nodes[proxy].height != 0) return;
+        removeLeaf(proxy);
+        freeNode(proxy);
+        --m_proxyCount;
+    }
+
+    bool CDynamicBVH::moveProxy(std::uint32_t proxy, const SAABB& box) {
+        if (m_nodes[proxy].box.contains(box)) return false;
+
+        removeLeaf(proxy);
+        const glm::vec3 margin(m_margin);
+        m_nodes[proxy].box.min = box.min - margin;
+        m_nodes[proxy].box.max = box.max + margin;
+        insertLeaf(proxy);
+        return true;
+    }
+
+    void CDynamicBVH::insertLeaf(std::uint32_t leaf) {
+        if (m_root == NULL_NODE) {
+            m_root = leaf;
+            m_nodes[leaf].parent = NULL_NODE;
+            return;
+        }
+
+        // Descend towards the sibling that minimizes the added surface area.
+        const SAABB leafBox = m_nodes[leaf].box;
+        std::uint32_t index = m_root;
+        while (!m_nodes[index].isLeaf()) {
+            const SNode& node = m_nodes[index];
+            const float area = node.box.surfaceArea();
+            const float combinedArea = SAABB::merged(node.box, leafBox).surfaceArea();
+
+            // Cost of pairing with this node, and the cost pushed down to children.
+            const float cost = 2.0f * combinedArea;
+            const float inheritance = 2.0f * (combinedArea - area);
+
+            auto childCost = [&](std::uint32_t child) {
+                const SAABB merged = SAABB::merged(leafBox, m_nodes[child].box);
+                if (m_nodes[child].isLeaf()) return merged.surfaceArea() + inheritance;
+                return merged.surfaceArea() - m_nodes[child].box.surfaceArea() + inheritance;
+            };
+            const float cost1 = childCost(node.child1);
+            const float cost2 = childCost(node.child2);
+
+            if (cost < cost1 && cost < cost2) break;
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        const std::uint32_t sibling = index;
+        const std::uint32_t oldParent = m_nodes[sibling].parent;
+        const std::uint32_t newParent = allocateNode();
+        m_nodes[newParent].parent = oldParent;
+        m_nodes[newParent].box = SAABB::merged(leafBox, m_nodes[sibling].box);
+        m_nodes[newParent].height = m_nodes[sibling].height + 1;
+        m_nodes[newParent].child1 = sibling;
+        m_nodes[newParent].child2 = leaf;
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent = newParent;
+
+        if (oldParent == NULL_NODE) {
+            m_root = newParent;
+        } else if (m_nodes[oldParent].child1 == sibling) {
+            m_nodes[oldParent].child1 = newParent;
+        } else {
+            m_nodes[oldParent].child2 = newParent;
+        }
+
+        refitFrom(m_nodes[leaf].parent);
+    }
+
+    void CDynamicBVH::removeLeaf(std::uint32_t leaf) {
+        if (leaf == m_root) {
+            m_root = NULL_NODE;
+            return;
+        }
+
+        const std::uint32_t parent = m_nodes[leaf].parent;
+        const std::uint32_t grandParent = m_nodes[parent].parent;
+        const std::uint32_t sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+        if (grandParent == NULL_NODE) {
+            m_root = sibling;
+            m_nodes[sibling].parent = NULL_NODE;
+            freeNode(parent);
+            return;
+        }
+
+        if (m_nodes[grandParent].child1 == parent) {
+            m_nodes[grandParent].child1 = sibling;
+        } else {
+            m_nodes[grandParent].child2 = sibling;
+        }
+        m_nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        refitFrom(grandParent);
+    }
+
+    void CDynamicBVH::refitFrom(std::uint32_t id) {
+        while (id != NULL_NODE) {
+            id = balance(id);
+            SNode& node = m_nodes[id];
+            node.box = SAABB::merged(m_nodes[node.child1].box, m_nodes[node.child2].box);
+            node.height = 1 + std::max(m_nodes[node.child1].height, m_nodes[node.child2].height);
+            id = node.parent;
+        }
+    }
+
+    // Rotates `a` up or down if its children's heights differ by more than one;
+    // returns the node now at a's position.
+    std::uint32_t CDynamicBVH::balance(std::uint32_t iA) {
+        SNode* A = &m_nodes[iA];
+        if (A->isLeaf() || A->height < 2) return iA;
+
+        const std::uint32_t iB = A->child1;
+        const std::uint32_t iC = A->child2;
+        const std::int32_t diff = m_nodes[iC].height - m_nodes[iB].height;
+
+        // Promote the taller child's taller child.
+        auto rotate = [&](std::uint32_t iUp, std::uint32_t iOther, bool upIsChild2) {
+            SNode& Up = m_nodes[iUp];
+            const std::uint32_t iF = Up.child1;
+            const std::uint32_t iG = Up.child2;
+
+            Up.child1 = iA;
+            Up.parent = A->parent;
+            A->parent = iUp;
+
+            if (Up.parent == NULL_NODE) {
+                m_root = iUp;
+            } else if (m_nodes[Up.parent].child1 == iA) {
+                m_nodes[Up.parent].child1 = iUp;
+            } else {
+                m_nodes[Up.parent].child2 = iUp;
+            }
+
+            const bool fTaller = m_nodes[iF].height > m_nodes[iG].height;
+            const std::uint32_t keep = fTaller ? iF : iG;
+            const std::uint32_t give = fTaller ? iG : iF;
+            Up.child2 = keep;
+            if (upIsChild2) {
+                A->child2 = give;
+            } else {
+                A->child1 = give;
+            }
+            m_nodes[give].parent = iA;
+
+            A->box = SAABB::merged(m_nodes[iOther].box, m_nodes[give].box);
+            Up.box = SAABB::merged(A->box, m_nodes[keep].box);
+            A->height = 1 + std::max(m_nodes[iOther].height, m_nodes[give].height);
+            Up.height = 1 + std::max(A->height, m_nodes[keep].height);
+            return iUp;
+        };
+
+        if (diff > 1) return rotate(iC, iB, true);
+        if (diff < -1) return rotate(iB, iC, false);
+        return iA;
+    }
+
+    float CDynamicBVH::areaRatio() const {
+        if (m_root == NULL_NODE) return 0.0f;
+        const float rootArea = m_nodes[m_root].box.surfaceArea();
+        float total = 0.0f;
+        for (const SNode& node : m_nodes) {
+            if (node.height > 0) total += node.box.surfaceArea();
+        }
+        return rootArea > 0.0f ? total / rootArea : 0.0f;
+    }
+
+} // namespace Kinetica::Geometry
@@ -0,0 +1,497 @@
+#include <kinetica/geometry/half_edge_mesh.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace Kinetica::Geometry {
+
+    using Components::SVertex;
+
+    namespace {
+
+        std::uint32_t positionBits(float f) {
+            // + 0.0f folds -0 into +0 so mirrored seams weld.
+            return std::bit_cast<std::uint32_t>(f + 0.0f);
+        }
+
+        std::uint64_t hashPosition(const SVertex& v) {
+            std::uint64_t h = 1469598103934665603ull;
+            for (std::uint32_t bits : {positionBits(v.x), positionBits(v.y), positionBits(v.z)}) {
+                h ^= bits;
+                h *= 1099511628211ull;
+            }
+            return h ^ (h >> 29);
+        }
+
+        bool samePosition(const SVertex& a, const SVertex& b) {
+            return positionBits(a.x) == positionBits(b.x) && positionBits(a.y) == positionBits(b.y) &&
+                   positionBits(a.z) == positionBits(b.z);
+        }
+
+        SVertex lerp(const SVertex& a, const SVertex& b, float t) {
+            SVertex r{};
+            r.x = a.x + (b.x - a.x) * t;
+            r.y = a.y + (b.y - a.y) * t;
+            r.z = a.z + (b.z - a.z) * t;
+            glm::vec3 n(a.nx + (b.nx - a.nx) * t, a.ny + (b.ny - a.ny) * t, a.nz + (b.nz - a.nz) * t);
+            const float len = glm::length(n);
+            if (len > 0.0f) n /= len;
+            r.nx = n.x;
+            r.ny = n.y;
+            r.nz = n.z;
+            r.u = a.u + (b.u - a.u) * t;
+            r.v = a.v + (b.v - a.v) * t;
+            return r;
+        }
+
+    } // namespace
+
+    // ---- Construction ----
+
+    CHalfEdgeMesh CHalfEdgeMesh::fromMesh(const Components::SMesh& mesh) {
+        static_assert(sizeof(Components::SIndex) == 3 * sizeof(std::uint32_t));
+        CHalfEdgeMesh result;
+        result.build(mesh.vertices, {},
+                     std::span<const std::uint32_t>(reinterpret_cast<const std::uint32_t*>(mesh.indices.data()),
+                                                    mesh.indices.size() * 3));
+        return result;
+    }
+
+    CHalfEdgeMesh CHalfEdgeMesh::fromPolygons(const std::vector<SVertex>& vertices,
+                                              std::span<const std::uint32_t> faceSizes,
+                                              std::span<const std::uint32_t> faceIndices) {
+        CHalfEdgeMesh result;
+        if (!faceSizes.empty()) result.build(vertices, faceSizes, faceIndices);
+        return result;
+    }
+
+    void CHalfEdgeMesh::build(const std::vector<SVertex>& vertices,
+                              std::span<const std::uint32_t> faceSizes,
+                              std::span<const std::uint32_t> faceIndices) {
+        m_attributes = vertices;
+
+        // Weld attribute vertices into topological vertices. Open addressing keeps
+        // this a single pass over flat arrays; std::unordered_map dominated the build.
+        std::vector<std::uint32_t> pointOf(vertices.size());
+        {
+            const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(16, vertices.size() * 2));
+            std::vector<std::uint32_t> table(capacity, INVALID_INDEX); // attribute index of the point's first vertex
+            m_points.reserve(vertices.size());
+            for (std::size_t i = 0; i < vertices.size(); ++i) {
+                std::size_t slot = hashPosition(vertices[i]) & (capacity - 1);
+                while (table[slot] != INVALID_INDEX && !samePosition(vertices[table[slot]], vertices[i]))
+                    slot = (slot + 1) & (capacity - 1);
+                if (table[slot] == INVALID_INDEX) {
+                    table[slot] = static_cast<std::uint32_t>(i);
+                    pointOf[i] = static_cast<std::uint32_t>(m_points.size());
+                    m_points.emplace_back(vertices[i].x, vertices[i].y, vertices[i].z);
+                } else {
+                    pointOf[i] = pointOf[table[slot]];
+                }
+            }
+        }
+        m_vertexHalfEdges.assign(m_points.size(), INVALID_INDEX);
+
+        // Face cycles.
+        const bool triangles = faceSizes.empty();
+        const std::size_t faceTotal = triangles ? faceIndices.size() / 3 : faceSizes.size();
+        m_faces.reserve(faceTotal);
+        m_halfEdges.reserve(faceIndices.size());
+
+        std::size_t cursor = 0;
+        for (std::size_t f = 0; f < faceTotal; ++f) {
+            const std::uint32_t n = triangles ? 3u : faceSizes[f];
+            const std::size_t first = cursor;
+            cursor += n;
+            if (cursor > faceIndices.size()) break;
+            if (n < 3) continue;
+
+            // Skip faces that collapse after welding; they cannot be linked consistently.
+            bool degenerate = false;
+            for (std::uint32_t k = 0; k < n && !degenerate; ++k) {
+                const std::uint32_t a = faceIndices[first + k];
+                const std::uint32_t b = faceIndices[first + (k + 1) % n];
+                degenerate = a >= vertices.size() || b >= vertices.size() || pointOf[a] == pointOf[b];
+            }
+            if (degenerate) continue;
+
+            const auto face = static_cast<std::uint32_t>(m_faces.size());
+            const auto base = static_cast<std::uint32_t>(m_halfEdges.size());
+            m_faces.push_back(base);
+            for (std::uint32_t k = 0; k < n; ++k) {
+                SHalfEdge& h = m_halfEdges.emplace_back();
+                h.to = pointOf[faceIndices[first + (k + 1) % n]];
+                h.next = base + (k + 1) % n;
+                h.prev = base + (k + n - 1) % n;
+                h.face = face;
+                h.corner = faceIndices[first + k];
+            }
+        }
+
+        // Bucket half-edges by origin (counting sort), then pair each a->b with a
+        // b->a found in b's bucket. Linear for bounded valence, no hashing.
+        const std::size_t halfEdgeTotal = m_halfEdges.size();
+        std::vector<std::uint32_t> offsets(m_points.size() + 1, 0);
+        for (std::size_t h = 0; h < halfEdgeTotal; ++h) ++offsets[origin(static_cast<std::uint32_t>(h)) + 1];
+        for (std::size_t v = 0; v < m_points.size(); ++v) offsets[v + 1] += offsets[v];
+
+        std::vector<std::uint32_t> outgoing(halfEdgeTotal);
+        {
+            std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (std::size_t h = 0; h < halfEdgeTotal; ++h)
+                outgoing[fill[origin(static_cast<std::uint32_t>(h))]++] = static_cast<std::uint32_t>(h);
+        }
+
+        for (std::size_t hi = 0; hi < halfEdgeTotal; ++hi) {
+            const auto h = static_cast<std::uint32_t>(hi);
+            const std::uint32_t a = origin(h);
+            if (m_vertexHalfEdges[a] == INVALID_INDEX) m_vertexHalfEdges[a] = h;
+            if (m_halfEdges[h].twin != INVALID_INDEX) continue;
+            const std::uint32_t b = m_halfEdges[h].to;
+
+            for (std::uint32_t i = offsets[b]; i < offsets[b + 1]; ++i) {
+                const std::uint32_t g = outgoing[i];
+                if (m_halfEdges[g].to == a && m_halfEdges[g].twin == INVALID_INDEX) {
+                    m_halfEdges[h].twin = g;
+                    m_halfEdges[g].twin = h;
+                    break;
+                }
+            }
+        }
+    }
+
+    void CHalfEdgeMesh::toMesh(Components::SMesh& mesh) const {
+        mesh.vertices.clear();
+        mesh.indices.clear();
+
+        std::vector<std::uint32_t> remap(m_attributes.size(), INVALID_INDEX);
+        auto emit = [&](std::uint32_t h) {
+            const std::uint32_t corner = m_halfEdges[h].corner;
+            std::uint32_t& slot = remap[corner];
+            if (slot == INVALID_INDEX) {
+                slot = static_cast<std::uint32_t>(mesh.vertices.size());
+                SVertex v = m_attributes[corner];
+                const glm::vec3& p = m_points[origin(h)];
+                v.x = p.x;
+                v.y = p.y;
+                v.z = p.z;
+                mesh.vertices.push_back(v);
+            }
+            return slot;
+        };
+
+        for (std::uint32_t f = 0; f < m_faces.size(); ++f) {
+            if (m_faces[f] == INVALID_INDEX) continue;
+            const std::uint32_t h0 = m_faces[f];
+            const std::uint32_t i0 = emit(h0);
+            for (std::uint32_t h = m_halfEdges[h0].next; m_halfEdges[h].next != h0; h = m_halfEdges[h].next)
+                mesh.indices.push_back({i0, emit(h), emit(m_halfEdges[h].next)});
+        }
+        mesh.markReplaced();
+    }
+
+    // ---- Queries ----
+
+    std::uint32_t CHalfEdgeMesh::faceSize(std::uint32_t face) const {
+        std::uint32_t n = 0;
+        forEachFaceHalfEdge(face, [&](std::uint32_t) { ++n; });
+        return n;
+    }
+
+    std::uint32_t CHalfEdgeMesh::valence(std::uint32_t vertex) const {
+        std::uint32_t n = 0;
+        forEachOutgoing(vertex, [&](std::uint32_t h) {
+            ++n;
+            // Incoming boundary edge without an outgoing counterpart.
+            if (m_halfEdges[m_halfEdges[h].prev].twin == INVALID_INDEX) ++n;
+        });
+        return n;
+    }
+
+    glm::vec3 CHalfEdgeMesh::faceNormal(std::uint32_t face) const {
+        // Newell's method, robust for non-planar n-gons.
+        glm::vec3 n(0.0f);
+        forEachFaceHalfEdge(face, [&](std::uint32_t h) {
+            const glm::vec3& a = m_points[origin(h)];
+            const glm::vec3& b = m_points[m_halfEdges[h].to];
+            n.x += (a.y - b.y) * (a.z + b.z);
+            n.y += (a.z - b.z) * (a.x + b.x);
+            n.z += (a.x - b.x) * (a.y + b.y);
+        });
+        const float len = glm::length(n);
+        return len > 0.0f ? n / len : n;
+    }
+
+    glm::vec3 CHalfEdgeMesh::faceCenter(std::uint32_t face) const {
+        glm::vec3 c(0.0f);
+        std::uint32_t n = 0;
+        forEachFaceHalfEdge(face, [&](std::uint32_t h) {
+            c += m_points[m_halfEdges[h].to];
+            ++n;
+        });
+        return c / static_cast<float>(n);
+    }
+
+    void CHalfEdgeMesh::faceNeighbours(std::uint32_t face, std::vector<std::uint32_t>& out) const {
+        out.clear();
+        forEachFaceHalfEdge(face, [&](std::uint32_t h) {
+            const std::uint32_t t = m_halfEdges[h].twin;
+            if (t != INVALID_INDEX) out.push_back(m_halfEdges[t].face);
+        });
+    }
+
+    std::uint32_t CHalfEdgeMesh::findHalfEdge(std::uint32_t from, std::uint32_t to) const {
+        std::uint32_t found = INVALID_INDEX;
+        forEachOutgoing(from, [&](std::uint32_t h) {
+            if (found == INVALID_INDEX && m_halfEdges[h].to == to) found = h;
+        });
+        return found;
+    }
+
+    void CHalfEdgeMesh::edgeLoop(std::uint32_t h, std::vector<std::uint32_t>& out) const {
+        out.clear();
+        if (!isHalfEdgeValid(h)) return;
+
+        // Across a regular (valence 4) vertex the loop continues on the edge that
+        // shares no face with the incoming one.
+        auto step = [&](std::uint32_t e) -> std::uint32_t {
+            if (valence(m_halfEdges[e].to) != 4) return INVALID_INDEX;
+            const std::uint32_t t = m_halfEdges[m_halfEdges[e].next].twin;
+            return t == INVALID_INDEX ? INVALID_INDEX : m_halfEdges[t].next;
+        };
+
+        out.push_back(h);
+        std::uint32_t e = h;
+        while ((e = step(e)) != INVALID_INDEX && e != h) out.push_back(e);
+        if (e == h) return;
+
+        std::vector<std::uint32_t> back;
+        e = m_halfEdges[h].twin;
+        while (e != INVALID_INDEX && (e = step(e)) != INVALID_INDEX) {
+            const std::uint32_t t = m_halfEdges[e].twin;
+            back.push_back(t != INVALID_INDEX ? t : e);
+        }
+        out.insert(out.begin(), back.rbegin(), back.rend());
+    }
+
+    // ---- Edits ----
+
+    std::uint32_t CHalfEdgeMesh::addVertex(const glm::vec3& position) {
+        m_points.push_back(position);
+        m_vertexHalfEdges.push_back(INVALID_INDEX);
+        return static_cast<std::uint32_t>(m_points.size() - 1);
+    }
+
+    std::uint32_t CHalfEdgeMesh::addAttribute(const SVertex& vertex) {
+        m_attributes.push_back(vertex);
+        return static_cast<std::uint32_t>(m_attributes.size() - 1);
+    }
+
+    void CHalfEdgeMesh::linkTwins(std::uint32_t h) {
+        const std::uint32_t a = origin(h);
+        const std::uint32_t b = m_halfEdges[h].to;
+        std::uint32_t match = INVALID_INDEX;
+        forEachOutgoing(b, [&](std::uint32_t g) {
+            if (match == INVALID_INDEX && g != h && m_halfEdges[g].to == a && m_halfEdges[g].twin == INVALID_INDEX)
+                match = g;
+        });
+        // While faces are added one by one a vertex can sit on two fans that
+        // are not linked yet; the twin is then reachable from a's side.
+        if (match == INVALID_INDEX) {
+            forEachOutgoing(a, [&](std::uint32_t g) {
+                const std::uint32_t p = m_halfEdges[g].prev;
+                if (match == INVALID_INDEX && p != h && origin(p) == b && m_halfEdges[p].twin == INVALID_INDEX)
+                    match = p;
+            });
+        }
+        if (match == INVALID_INDEX) return;
+        m_halfEdges[h].twin = match;
+        m_halfEdges[match].twin = h;
+    }
+
+    std::uint32_t CHalfEdgeMesh::addFace(std::span<const std::uint32_t> vertices,
+                                         std::span<const std::uint32_t> corners) {
+        const auto n = static_cast<std::uint32_t>(vertices.size());
+        if (n < 3) return INVALID_INDEX;
+        for (std::uint32_t v : vertices)
+            if (v >= m_points.size()) return INVALID_INDEX;
+
+        const auto face = static_cast<std::uint32_t>(m_faces.size());
+        const auto base = static_cast<std::uint32_t>(m_halfEdges.size());
+        m_faces.push_back(base);
+
+        for (std::uint32_t k = 0; k < n; ++k) {
+            SHalfEdge h;
+            h.to = vertices[(k + 1) % n];
+            h.next = base + (k + 1) % n;
+            h.prev = base + (k + n - 1) % n;
+            h.face = face;
+            h.corner = k < corners.size() ? corners[k] : INVALID_INDEX;
+            m_halfEdges.push_back(h);
+        }
+
+        // Corners without attributes get the position and the flat face normal.
+        const glm::vec3 normal = faceNormal(face);
+        for (std::uint32_t k = 0; k < n; ++k) {
+            SHalfEdge& h = m_halfEdges[base + k];
+            if (h.corner != INVALID_INDEX && h.corner < m_attributes.size()) continue;
+            const glm::vec3& p = m_points[vertices[k]];
+            h.corner = addAttribute({p.x, p.y, p.z, normal.x, normal.y, normal.z, 0.0f, 0.0f});
+        }
+
+        for (std::uint32_t k = 0; k < n; ++k)
+            if (m_vertexHalfEdges[vertices[k]] == INVALID_INDEX) m_vertexHalfEdges[vertices[k]] = base + k;
+        for (std::uint32_t k = 0; k < n; ++k)
+            if (m_halfEdges[base + k].twin == INVALID_INDEX) linkTwins(base + k);
+        return face;
+    }
+
+    void CHalfEdgeMesh::removeFace(std::uint32_t face) {
+        if (!isFaceValid(face)) return;
+
+        // Re-home vertices whose outgoing half-edge belongs to this face first,
+        // while the twin links are still intact.
+        forEachFaceHalfEdge(face, [&](std::uint32_t h) {
+            const std::uint32_t v = origin(h);
+            if (m_vertexHalfEdges[v] != h) return;
+            std::uint32_t alt = INVALID_INDEX;
+            if (const std::uint32_t t = m_halfEdges[h].twin; t != INVALID_INDEX)
+                alt = m_halfEdges[t].next;
+            else
+                alt = m_halfEdges[m_halfEdges[h].prev].twin;
+            m_vertexHalfEdges[v] = alt;
+        });
+
+        std::vector<std::uint32_t> cycle;
+        forEachFaceHalfEdge(face, [&](std::uint32_t h) { cycle.push_back(h); });
+        for (std::uint32_t h : cycle) {
+            if (const std::uint32_t t = m_halfEdges[h].twin; t != INVALID_INDEX) m_halfEdges[t].twin = INVALID_INDEX;
+            m_halfEdges[h].twin = INVALID_INDEX;
+            m_halfEdges[h].face = INVALID_INDEX;
+        }
+        m_faces[face] = INVALID_INDEX;
+    }
+
+    std::uint32_t CHalfEdgeMesh::splitEdge(std::uint32_t h, float t) {
+        if (!isHalfEdgeValid(h)) return INVALID_INDEX;
+
+        const std::uint32_t a = origin(h);
+        const std::uint32_t b = m_halfEdges[h].to;
+        const std::uint32_t m = addVertex(m_points[a] + (m_points[b] - m_points[a]) * t);
+
+        // Inserts m after `e` inside e's face, returning the new half-edge m -> old target.
+        auto insert = [&](std::uint32_t e, float param) {
+            const SHalfEdge old = m_halfEdges[e];
+            const auto ne = static_cast<std::uint32_t>(m_halfEdges.size());
+            SHalfEdge h2;
+            h2.to = old.to;
+            h2.next = old.next;
+            h2.prev = e;
+            h2.face = old.face;
+            h2.corner = addAttribute(lerp(m_attributes[old.corner], m_attributes[m_halfEdges[old.next].corner], param));
+            m_halfEdges.push_back(h2);
+            m_halfEdges[old.next].prev = ne;
+            m_halfEdges[e].next = ne;
+            m_halfEdges[e].to = m;
+            return ne;
+        };
+
+        const std::uint32_t tw = m_halfEdges[h].twin;
+        const std::uint32_t h2 = insert(h, t);
+        m_vertexHalfEdges[m] = h2;
+        if (tw != INVALID_INDEX) {
+            const std::uint32_t t2 = insert(tw, 1.0f - t);
+            m_halfEdges[h].twin = t2;   // a->m  / m->a
+            m_halfEdges[t2].twin = h;
+            m_halfEdges[tw].twin = h2;  // b->m  / m->b
+            m_halfEdges[h2].twin = tw;
+        }
+        return m;
+    }
+
+    std::uint32_t CHalfEdgeMesh::extrudeFace(std::uint32_t face, float distance) {
+        if (!isFaceValid(face)) return INVALID_INDEX;
+
+        const glm::vec3 offset = faceNormal(face) * distance;
+        std::vector<std::uint32_t> ring;
+        std::vector<std::uint32_t> corners;
+        forEachFaceHalfEdge(face, [&](std::uint32_t h) {
+            ring.push_back(origin(h));
+            corners.push_back(m_halfEdges[h].corner);
+        });
+        removeFace(face);
+
+        const auto n = static_cast<std::uint32_t>(ring.size());
+        std::vector<std::uint32_t> cap(n);
+        for (std::uint32_t k = 0; k < n; ++k) {
+            cap[k] = addVertex(m_points[ring[k]] + offset);
+            corners[k] = addAttribute(m_attributes[corners[k]]);
+        }
+        const std::uint32_t capFace = addFace(cap, corners);
+
+        for (std::uint32_t k = 0; k < n; ++k) {
+            const std::uint32_t k1 = (k + 1) % n;
+            const std::uint32_t side[4] = {ring[k], ring[k1], cap[k1], cap[k]};
+            addFace(side);
+        }
+        return capFace;
+    }
+
+    void CHalfEdgeMesh::compact() {
+        std::vector<std::uint32_t> faceMap(m_faces.size(), INVALID_INDEX);
+        std::vector<std::uint32_t> edgeMap(m_halfEdges.size(), INVALID_INDEX);
+        std::vector<std::uint32_t> pointMap(m_points.size(), INVALID_INDEX);
+        std::vector<std::uint32_t> attributeMap(m_attributes.size(), INVALID_INDEX);
+
+        std::vector<SHalfEdge> halfEdges;
+        std::vector<glm::vec3> points;
+        std::vector<SVertex> attributes;
+        halfEdges.reserve(m_halfEdges.size());
+
+        std::uint32_t faces = 0;
+        for (std::uint32_t f = 0; f < m_faces.size(); ++f)
+            if (m_faces[f] != INVALID_INDEX) faceMap[f] = faces++;
+
+        for (std::uint32_t h = 0; h < m_halfEdges.size(); ++h) {
+            const SHalfEdge& e = m_halfEdges[h];
+            if (e.face == INVALID_INDEX) continue;
+            edgeMap[h] = static_cast<std::uint32_t>(halfEdges.size());
+            halfEdges.push_back(e);
+            if (pointMap[e.to] == INVALID_INDEX) {
+                pointMap[e.to] = static_cast<std::uint32_t>(points.size());
+                points.push_back(m_points[e.to]);
+            }
+            if (attributeMap[e.corner] == INVALID_INDEX) {
+                attributeMap[e.corner] = static_cast<std::uint32_t>(attributes.size());
+                attributes.push_back(m_attributes[e.corner]);
+            }
+        }
+
+        for (SHalfEdge& e : halfEdges) {
+            e.to = pointMap[e.to];
+            e.next = edgeMap[e.next];
+            e.prev = edgeMap[e.prev];
+            e.twin = e.twin == INVALID_INDEX ? INVALID_INDEX : edgeMap[e.twin];
+            e.face = faceMap[e.face];
+            e.corner = attributeMap[e.corner];
+        }
+
+        std::vector<std::uint32_t> faceHalfEdges(faces);
+        for (std::uint32_t f = 0; f < m_faces.size(); ++f)
+            if (faceMap[f] != INVALID_INDEX) faceHalfEdges[faceMap[f]] = edgeMap[m_faces[f]];
+
+        std::vector<std::uint32_t> vertexHalfEdges(points.size(), INVALID_INDEX);
+        for (std::uint32_t v = 0; v < m_points.size(); ++v) {
+            if (pointMap[v] == INVALID_INDEX) continue;
+            const std::uint32_t h = m_vertexHalfEdges[v];
+            vertexHalfEdges[pointMap[v]] = h == INVALID_INDEX ? INVALID_INDEX : edgeMap[h];
+        }
+
+        m_halfEdges = std::move(halfEdges);
+        m_points = std::move(points);
+        m_attributes = std::move(attributes);
+        m_faces = std::move(faceHalfEdges);
+        m_vertexHalfEdges = std::move(vertexHalfEdges);
+    }
+
+} // namespace Kinetica::Geometry
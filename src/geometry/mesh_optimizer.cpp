@@ -0,0 +1,473 @@
+#include <kinetica/geometry/mesh_optimizer.hpp>
+#include <kinetica/thread_pool.hpp>
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+namespace Kinetica::Geometry {
+
+    using Components::SIndex;
+    using Components::SMesh;
+    using Components::SVertex;
+
+    namespace {
+
+        constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+        std::uint64_t mix(std::uint64_t h, std::uint64_t value) {
+            h ^= value;
+            h *= 1099511628211ull;
+            return h;
+        }
+
+        std::uint64_t hashCell(std::int64_t x, std::int64_t y, std::int64_t z) {
+            std::uint64_t h = 1469598103934665603ull;
+            h = mix(h, static_cast<std::uint64_t>(x));
+            h = mix(h, static_cast<std::uint64_t>(y));
+            h = mix(h, static_cast<std::uint64_t>(z));
+            return h ^ (h >> 29);
+        }
+
+        std::uint32_t positionBits(float f) {
+            return std::bit_cast<std::uint32_t>(f + 0.0f); // folds -0 into +0
+        }
+
+        glm::vec3 position(const SVertex& v) { return {v.x, v.y, v.z}; }
+
+        // FIFO cache simulation with timestamps: a vertex is resident while
+        // fewer than `size` misses happened since it was loaded.
+        struct SFifoCache {
+            std::vector<std::uint32_t> stamps;
+            std::uint32_t time;
+            std::uint32_t size;
+
+            SFifoCache(std::uint32_t vertexCount, std::uint32_t cacheSize)
+                : stamps(vertexCount, 0), time(cacheSize + 1), size(cacheSize) {}
+
+            std::uint32_t access(std::uint32_t v) {
+                if (time - stamps[v] <= size) return 0;
+                stamps[v] = time++;
+                return 1;
+            }
+            std::uint32_t access(const SIndex& t) { return access(t.a) + access(t.b) + access(t.c); }
+            void reset() { time += size + 1; }
+        };
+
+        // ---- Forsyth scoring ----
+
+        constexpr std::uint32_t FORSYTH_CACHE = 32;
+        constexpr std::uint32_t FORSYTH_MAX_VALENCE = 64;
+
+        struct SForsythTables {
+            float cache[FORSYTH_CACHE + 1];
+            float valence[FORSYTH_MAX_VALENCE];
+
+            SForsythTables() {
+                for (std::uint32_t i = 0; i < FORSYTH_CACHE; ++i) {
+                    // The last triangle's vertices get a fixed score so the
+                    // next triangle does not just reuse its edge in a strip.
+                    cache[i] = i < 3 ? 0.75f
+                                     : std::pow(1.0f - float(i - 3) / float(FORSYTH_CACHE - 3), 1.5f);
+                }
+                cache[FORSYTH_CACHE] = 0.0f;
+                valence[0] = 0.0f;
+                for (std::uint32_t i = 1; i < FORSYTH_MAX_VALENCE; ++i) valence[i] = 2.0f / std::sqrt(float(i));
+            }
+
+            float score(std::uint32_t cachePosition, std::uint32_t remaining) const {
+                if (remaining == 0) return -1.0f;
+                return cache[std::min(cachePosition, FORSYTH_CACHE)] +
+                       valence[std::min(remaining, FORSYTH_MAX_VALENCE - 1)];
+            }
+        };
+
+    } // namespace
+
+    // ---- Welding ----
+
+    std::uint32_t weldVertices(SMesh& mesh, float positionTolerance, float normalTolerance, float uvTolerance) {
+        const auto count = static_cast<std::uint32_t>(mesh.vertices.size());
+        if (count == 0) return 0;
+
+        const bool exact = positionTolerance <= 0.0f;
+        const float inverseCell = exact ? 0.0f : 1.0f / positionTolerance;
+
+        auto attributesMatch = [&](const SVertex& a, const SVertex& b) {
+            return std::abs(a.nx - b.nx) <= normalTolerance && std::abs(a.ny - b.ny) <= normalTolerance &&
+                   std::abs(a.nz - b.nz) <= normalTolerance && std::abs(a.u - b.u) <= uvTolerance &&
+                   std::abs(a.v - b.v) <= uvTolerance;
+        };
+        auto positionsMatch = [&](const SVertex& a, const SVertex& b) {
+            if (exact) {
+                return positionBits(a.x) == positionBits(b.x) && positionBits(a.y) == positionBits(b.y) &&
+                       positionBits(a.z) == positionBits(b.z);
+            }
+            return std::abs(a.x - b.x) <= positionTolerance && std::abs(a.y - b.y) <= positionTolerance &&
+                   std::abs(a.z - b.z) <= positionTolerance;
+        };
+        auto cellOf = [&](const SVertex& v, std::int64_t (&cell)[3]) {
+            if (exact) {
+                cell[0] = positionBits(v.x);
+                cell[1] = positionBits(v.y);
+                cell[2] = positionBits(v.z);
+            } else {
+                cell[0] = static_cast<std::int64_t>(std::floor(v.x * inverseCell));
+                cell[1] = static_cast<std::int64_t>(std::floor(v.y * inverseCell));
+                cell[2] = static_cast<std::int64_t>(std::floor(v.z * inverseCell));
+            }
+        };
+
+        // Kept vertices are chained per grid cell; a tolerant weld also looks
+        // in the 26 neighbouring cells. Cells live in an open-addressed table.
+        std::vector<SVertex> welded;
+        std::vector<std::uint32_t> chain;
+        std::vector<std::uint32_t> remap(count);
+        welded.reserve(count);
+        chain.reserve(count);
+
+        const std::size_t tableSize = std::bit_ceil(std::size_t(count) * 2);
+        std::vector<std::uint64_t> cellKeys(tableSize);
+        std::vector<std::uint32_t> cellHeads(tableSize, NONE);
+        auto slotOf = [&](std::uint64_t key) {
+            std::size_t slot = key & (tableSize - 1);
+            while (cellHeads[slot] != NONE && cellKeys[slot] != key) slot = (slot + 1) & (tableSize - 1);
+            return slot;
+        };
+
+        const int reach = exact ? 0 : 1;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const SVertex& v = mesh.vertices[i];
+            std::int64_t cell[3];
+            cellOf(v, cell);
+
+            std::uint32_t found = NONE;
+            for (int dx = -reach; dx <= reach && found == NONE; ++dx) {
+                for (int dy = -reach; dy <= reach && found == NONE; ++dy) {
+                    for (int dz = -reach; dz <= reach && found == NONE; ++dz) {
+                        const std::size_t slot = slotOf(hashCell(cell[0] + dx, cell[1] + dy, cell[2] + dz));
+                        for (std::uint32_t k = cellHeads[slot]; k != NONE; k = chain[k]) {
+                            if (positionsMatch(welded[k], v) && attributesMatch(welded[k], v)) {
+                                found = k;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (found == NONE) {
+                found = static_cast<std::uint32_t>(welded.size());
+                welded.push_back(v);
+                const std::uint64_t key = hashCell(cell[0], cell[1], cell[2]);
+                const std::size_t slot = slotOf(key);
+                chain.push_back(cellHeads[slot]);
+                cellKeys[slot] = key;
+                cellHeads[slot] = found;
+            }
+            remap[i] = found;
+        }
+
+        std::vector<SIndex> triangles;
+        triangles.reserve(mesh.indices.size());
+        for (const SIndex& t : mesh.indices) {
+            const SIndex r{remap[t.a], remap[t.b], remap[t.c]};
+            if (r.a != r.b && r.b != r.c && r.c != r.a) triangles.push_back(r);
+        }
+
+        const auto removed = static_cast<std::uint32_t>(count - welded.size());
+        if (removed == 0 && triangles.size() == mesh.indices.size()) return 0;
+
+        mesh.vertices.swap(welded);
+        mesh.indices.swap(triangles);
+        mesh.markReplaced();
+        return removed;
+    }
+
+    // ---- Vertex cache ----
+
+    void optimizeVertexCache(std::span<SIndex> triangles, std::uint32_t vertexCount) {
+        const auto triangleCount = static_cast<std::uint32_t>(triangles.size());
+        if (triangleCount < 2) return;
+        static const SForsythTables tables;
+
+        // Per-vertex lists of triangles not yet emitted.
+        std::vector<std::uint32_t> remaining(vertexCount, 0);
+        for (const SIndex& t : triangles) {
+            ++remaining[t.a];
+            ++remaining[t.b];
+            ++remaining[t.c];
+        }
+        std::vector<std::uint32_t> offsets(vertexCount + 1, 0);
+        for (std::uint32_t v = 0; v < vertexCount; ++v) offsets[v + 1] = offsets[v] + remaining[v];
+        std::vector<std::uint32_t> adjacency(offsets[vertexCount]);
+        {
+            std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (std::uint32_t t = 0; t < triangleCount; ++t) {
+                adjacency[fill[triangles[t].a]++] = t;
+                adjacency[fill[triangles[t].b]++] = t;
+                adjacency[fill[triangles[t].c]++] = t;
+            }
+        }
+
+        std::vector<std::uint32_t> cachePosition(vertexCount, FORSYTH_CACHE);
+        std::vector<float> vertexScore(vertexCount);
+        for (std::uint32_t v = 0; v < vertexCount; ++v) vertexScore[v] = tables.score(FORSYTH_CACHE, remaining[v]);
+
+        std::vector<float> triangleScore(triangleCount);
+        std::vector<std::uint8_t> emitted(triangleCount, 0);
+        std::uint32_t best = 0;
+        for (std::uint32_t t = 0; t < triangleCount; ++t) {
+            const SIndex& tri = triangles[t];
+            triangleScore[t] = vertexScore[tri.a] + vertexScore[tri.b] + vertexScore[tri.c];
+            if (triangleScore[t] > triangleScore[best]) best = t;
+        }
+
+        std::vector<SIndex> output;
+        output.reserve(triangleCount);
+        std::uint32_t cache[FORSYTH_CACHE + 3];
+        std::uint32_t cacheSize = 0;
+        std::uint32_t cursor = 0;
+
+        while (output.size() < triangleCount) {
+            if (best == NONE) {
+                // Dead end: nothing in the cache has triangles left.
+                while (emitted[cursor]) ++cursor;
+                best = cursor;
+            }
+
+            const SIndex tri = triangles[best];
+            output.push_back(tri);
+            emitted[best] = 1;
+
+            for (std::uint32_t v : {tri.a, tri.b, tri.c}) {
+                std::uint32_t* list = adjacency.data() + offsets[v];
+                for (std::uint32_t k = 0; k < remaining[v]; ++k) {
+                    if (list[k] == best) {
+                        list[k] = list[--remaining[v]];
+                        break;
+                    }
+                }
+            }
+
+            // The emitted corners move to the front; older entries shift back.
+            std::uint32_t next[FORSYTH_CACHE + 3] = {tri.a, tri.b, tri.c};
+            std::uint32_t nextSize = 3;
+            for (std::uint32_t i = 0; i < cacheSize; ++i) {
+                const std::uint32_t v = cache[i];
+                if (v != tri.a && v != tri.b && v != tri.c) next[nextSize++] = v;
+            }
+            for (std::uint32_t i = 0; i < nextSize; ++i) {
+                const std::uint32_t v = next[i];
+                cachePosition[v] = i < FORSYTH_CACHE ? i : FORSYTH_CACHE;
+                vertexScore[v] = tables.score(cachePosition[v], remaining[v]);
+            }
+
+            // Only triangles touching the cache changed score.
+            best = NONE;
+            float bestScore = -1.0f;
+            for (std::uint32_t i = 0; i < nextSize; ++i) {
+                const std::uint32_t v = next[i];
+                const std::uint32_t* list = adjacency.data() + offsets[v];
+                for (std::uint32_t k = 0; k < remaining[v]; ++k) {
+                    const std::uint32_t t = list[k];
+                    const SIndex& other = triangles[t];
+                    triangleScore[t] = vertexScore[other.a] + vertexScore[other.b] + vertexScore[other.c];
+                    if (triangleScore[t] > bestScore) {
+                        bestScore = triangleScore[t];
+                        best = t;
+                    }
+                }
+            }
+
+            cacheSize = std::min(nextSize, FORSYTH_CACHE);
+            std::copy(next, next + cacheSize, cache);
+        }
+
+        std::copy(output.begin(), output.end(), triangles.begin());
+    }
+
+    // ---- Overdraw ----
+
+    void optimizeOverdraw(std::span<SIndex> triangles, std::span<const SVertex> vertices, float threshold,
+                          std::uint32_t cacheSize) {
+        const auto triangleCount = static_cast<std::uint32_t>(triangles.size());
+        if (triangleCount < 2) return;
+        const auto vertexCount = static_cast<std::uint32_t>(vertices.size());
+
+        // Hard boundaries: triangles that miss on all three corners start a
+        // new cluster for free.
+        std::vector<std::uint32_t> hard;
+        {
+            SFifoCache cache(vertexCount, cacheSize);
+            for (std::uint32_t t = 0; t < triangleCount; ++t)
+                if (cache.access(triangles[t]) == 3) hard.push_back(t);
+            if (hard.empty() || hard.front() != 0) hard.insert(hard.begin(), 0);
+            hard.push_back(triangleCount);
+        }
+
+        // Soft boundaries: split further wherever the cluster so far stays
+        // within `threshold` of the hard cluster's own ACMR.
+        std::vector<std::uint32_t> clusters;
+        {
+            SFifoCache cache(vertexCount, cacheSize);
+            for (std::size_t h = 0; h + 1 < hard.size(); ++h) {
+                const std::uint32_t start = hard[h];
+                const std::uint32_t end = hard[h + 1];
+
+                cache.reset();
+                std::uint32_t misses = 0;
+                for (std::uint32_t t = start; t < end; ++t) misses += cache.access(triangles[t]);
+                const float target = threshold * float(misses) / float(end - start);
+
+                cache.reset();
+                clusters.push_back(start);
+                std::uint32_t begin = start;
+                std::uint32_t running = 0;
+                for (std::uint32_t t = start; t < end; ++t) {
+                    running += cache.access(triangles[t]);
+                    if (t + 1 < end && float(running) <= target * float(t + 1 - begin)) {
+                        clusters.push_back(t + 1);
+                        begin = t + 1;
+                        running = 0;
+                        cache.reset();
+                    }
+                }
+            }
+            clusters.push_back(triangleCount);
+        }
+
+        const auto clusterCount = static_cast<std::uint32_t>(clusters.size() - 1);
+        if (clusterCount < 2) return;
+
+        // Sort clusters by how far out they face: dot(centroid - meshCentroid, normal).
+        std::vector<glm::vec3> centroids(clusterCount, glm::vec3(0.0f));
+        std::vector<glm::vec3> normals(clusterCount, glm::vec3(0.0f));
+        std::vector<float> areas(clusterCount, 0.0f);
+        glm::vec3 meshCentroid(0.0f);
+        float meshArea = 0.0f;
+        for (std::uint32_t c = 0; c < clusterCount; ++c) {
+            for (std::uint32_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+                const glm::vec3 a = position(vertices[triangles[t].a]);
+                const glm::vec3 b = position(vertices[triangles[t].b]);
+                const glm::vec3 p = position(vertices[triangles[t].c]);
+                const glm::vec3 n = glm::cross(b - a, p - a);
+                const float area = glm::length(n);
+                centroids[c] += (a + b + p) * (area / 3.0f);
+                normals[c] += n;
+                areas[c] += area;
+            }
+            meshCentroid += centroids[c];
+            meshArea += areas[c];
+            if (areas[c] > 0.0f) centroids[c] /= areas[c];
+        }
+        if (meshArea > 0.0f) meshCentroid /= meshArea;
+
+        std::vector<float> keys(clusterCount);
+        for (std::uint32_t c = 0; c < clusterCount; ++c) {
+            const float length = glm::length(normals[c]);
+            keys[c] = length > 0.0f ? glm::dot(centroids[c] - meshCentroid, normals[c] / length) : 0.0f;
+        }
+
+        std::vector<std::uint32_t> order(clusterCount);
+        std::iota(order.begin(), order.end(), 0u);
+        std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) { return keys[a] > keys[b]; });
+
+        std::vector<SIndex> output;
+        output.reserve(triangleCount);
+        for (std::uint32_t c : order)
+            output.insert(output.end(), triangles.begin() + clusters[c], triangles.begin() + clusters[c + 1]);
+        std::copy(output.begin(), output.end(), triangles.begin());
+    }
+
+    // ---- Vertex fetch ----
+
+    void optimizeVertexFetch(SMesh& mesh) {
+        std::vector<std::uint32_t> remap(mesh.vertices.size(), NONE);
+        std::vector<SVertex> vertices;
+        vertices.reserve(mesh.vertices.size());
+
+        bool identity = true;
+        for (SIndex& t : mesh.indices) {
+            for (std::uint32_t* index : {&t.a, &t.b, &t.c}) {
+                std::uint32_t& target = remap[*index];
+                if (target == NONE) {
+                    target = static_cast<std::uint32_t>(vertices.size());
+                    vertices.push_back(mesh.vertices[*index]);
+                }
+                identity = identity && target == *index;
+                *index = target;
+            }
+        }
+        if (identity && vertices.size() == mesh.vertices.size()) return;
+
+        mesh.vertices.swap(vertices);
+        mesh.markReplaced();
+    }
+
+    // ---- Analysis ----
+
+    float computeACMR(std::span<const SIndex> triangles, std::uint32_t vertexCount, std::uint32_t cacheSize) {
+        if (triangles.empty()) return 0.0f;
+        SFifoCache cache(vertexCount, cacheSize);
+        std::size_t misses = 0;
+        for (const SIndex& t : triangles) misses += cache.access(t);
+        return float(misses) / float(triangles.size());
+    }
+
+    // ---- Pipeline ----
+
+    SMeshOptimizeStats optimizeMesh(SMesh& mesh, const SMeshOptimizeSettings& settings) {
+        const auto start = std::chrono::steady_clock::now();
+        SMeshOptimizeStats stats;
+
+        auto measure = [&](std::uint32_t& vertices, std::uint32_t& triangles, float& acmr, float& atvr,
+                           std::size_t& bytes) {
+            vertices = static_cast<std::uint32_t>(mesh.vertices.size());
+            triangles = static_cast<std::uint32_t>(mesh.indices.size());
+            acmr = computeACMR(mesh.indices, vertices, settings.cacheSize);
+            atvr = vertices > 0 ? acmr * float(triangles) / float(vertices) : 0.0f;
+            bytes = mesh.vertices.size() * sizeof(SVertex) + mesh.indices.size() * sizeof(SIndex);
+        };
+
+        const auto vertexCount = static_cast<std::uint32_t>(mesh.vertices.size());
+        for (const SIndex& t : mesh.indices) {
+            if (t.a >= vertexCount || t.b >= vertexCount || t.c >= vertexCount) {
+                KLOG_WARN("Mesh has out-of-range indices, skipping optimization");
+                return stats;
+            }
+        }
+
+        measure(stats.verticesBefore, stats.trianglesBefore, stats.acmrBefore, stats.atvrBefore, stats.bytesBefore);
+
+        if (settings.weld)
+            weldVertices(mesh, settings.positionTolerance, settings.normalTolerance, settings.uvTolerance);
+        if (settings.vertexCache)
+            optimizeVertexCache(mesh.indices, static_cast<std::uint32_t>(mesh.vertices.size()));
+        if (settings.overdraw)
+            optimizeOverdraw(mesh.indices, mesh.vertices, settings.overdrawThreshold, settings.cacheSize);
+        if (settings.vertexFetch) optimizeVertexFetch(mesh);
+        if (settings.vertexCache || settings.overdraw) mesh.markReplaced();
+
+        measure(stats.verticesAfter, stats.trianglesAfter, stats.acmrAfter, stats.atvrAfter, stats.bytesAfter);
+        stats.milliseconds =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return stats;
+    }
+
+    void optimizeMeshes(CThreadPool& pool, std::span<SMesh* const> meshes, const SMeshOptimizeSettings& settings,
+                        std::vector<SMeshOptimizeStats>* stats) {
+        if (stats) stats->assign(meshes.size(), {});
+        // One mesh per task: sizes vary a lot, so let idle workers steal.
+        pool.parallelFor(meshes.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const SMeshOptimizeStats result = optimizeMesh(*meshes[i], settings);
+                if (stats) (*stats)[i] = result;
+            }
+        });
+    }
+
+} // namespace Kinetica::Geometry
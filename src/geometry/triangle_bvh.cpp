@@ -0,0 +1,315 @@
+#include <kinetica/geometry/triangle_bvh.hpp>
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace Kinetica::Geometry {
+
+    using Components::SMesh;
+    using Math::SAABB;
+
+    namespace {
+
+        constexpr std::uint32_t BIN_COUNT = 16;
+        constexpr std::uint32_t MAX_LEAF_SIZE = 8;  // forced split above this
+        constexpr float TRAVERSAL_COST = 1.0f;      // relative to one triangle test
+
+        glm::vec3 vertexPosition(const SMesh& mesh, std::uint32_t index) {
+            const Components::SVertex& v = mesh.vertices[index];
+            return {v.x, v.y, v.z};
+        }
+
+        SAABB triangleBox(const SMesh& mesh, std::uint32_t triangle) {
+            const Components::SIndex& tri = mesh.indices[triangle];
+            SAABB box;
+            box.expand(vertexPosition(mesh, tri.a));
+            box.expand(vertexPosition(mesh, tri.b));
+            box.expand(vertexPosition(mesh, tri.c));
+            return box;
+        }
+
+        // Möller-Trumbore, both faces.
+        bool intersectTriangle(const SMesh& mesh, std::uint32_t triangle, const Math::SRay& ray,
+                               float maxT, float& t, float& u, float& v) {
+            const Components::SIndex& tri = mesh.indices[triangle];
+            const glm::vec3 p0 = vertexPosition(mesh, tri.a);
+            const glm::vec3 e1 = vertexPosition(mesh, tri.b) - p0;
+            const glm::vec3 e2 = vertexPosition(mesh, tri.c) - p0;
+
+            const glm::vec3 p = glm::cross(ray.direction, e2);
+            const float det = glm::dot(e1, p);
+            if (std::fabs(det) < 1e-12f) return false;
+            const float invDet = 1.0f / det;
+
+            const glm::vec3 s = ray.origin - p0;
+            u = glm::dot(s, p) * invDet;
+            if (u < 0.0f || u > 1.0f) return false;
+            const glm::vec3 q = glm::cross(s, e1);
+            v = glm::dot(ray.direction, q) * invDet;
+            if (v < 0.0f || u + v > 1.0f) return false;
+            t = glm::dot(e2, q) * invDet;
+            return t > 0.0f && t <= maxT;
+        }
+
+    } // namespace
+
+    void CTriangleBVH::clear() {
+        m_nodes.clear();
+        m_triangles.clear();
+    }
+
+    Math::SAABB CTriangleBVH::bounds() const {
+        return m_nodes.empty() ? SAABB{} : m_nodes[0].box();
+    }
+
+    void CTriangleBVH::build(const SMesh& mesh) {
+        clear();
+
+        const auto vertexCount = static_cast<std::uint32_t>(mesh.vertices.size());
+        std::vector<glm::vec3> centroids(mesh.indices.size());
+        std::vector<SAABB> boxes(mesh.indices.size());
+        m_triangles.reserve(mesh.indices.size());
+        for (std::uint32_t i = 0; i < mesh.indices.size(); ++i) {
+            const Components::SIndex& tri = mesh.indices[i];
+            if (tri.a >= vertexCount || tri.b >= vertexCount || tri.c >= vertexCount) continue;
+            boxes[i] = triangleBox(mesh, i);
+            centroids[i] = boxes[i].center();
+            m_triangles.push_back(i);
+        }
+        if (m_triangles.size() != mesh.indices.size()) {
+            KLOG_WARN("Triangle BVH skipped " + std::to_string(mesh.indices.size() - m_triangles.size()) +
+                      " triangles with out-of-range indices");
+        }
+        if (m_triangles.empty()) return;
+
+        m_nodes.reserve(2 * m_triangles.size());
+
+        SAABB rootBox, rootCentroids;
+        for (std::uint32_t t : m_triangles) {
+            rootBox.expand(boxes[t]);
+            rootCentroids.expand(centroids[t]);
+        }
+        m_nodes.push_back({rootBox.min, 0, rootBox.max, static_cast<std::uint32_t>(m_triangles.size())});
+
+        struct SBin {
+            SAABB box;
+            std::uint32_t count = 0;
+        };
+        struct SPending {
+            std::uint32_t node;
+            SAABB centroids;
+        };
+
+        // Node bounds are known before a node is visited: children inherit them
+        // from the parent's bins and partition pass.
+        std::vector<SPending> stack{{0, rootCentroids}};
+        while (!stack.empty()) {
+            const SPending pending = stack.back();
+            stack.pop_back();
+
+            const std::uint32_t nodeIndex = pending.node;
+            const std::uint32_t first = m_nodes[nodeIndex].leftFirst;
+            const std::uint32_t count = m_nodes[nodeIndex].count;
+            const SAABB box = m_nodes[nodeIndex].box();
+            const SAABB& centroidBox = pending.centroids;
+            if (count <= 2) continue;
+
+            // Bin along the axis of largest centroid extent.
+            const glm::vec3 extent = centroidBox.max - centroidBox.min;
+            int axis = 0;
+            if (extent.y > extent[axis]) axis = 1;
+            if (extent.z > extent[axis]) axis = 2;
+            const float scale = extent[axis] > 0.0f ? BIN_COUNT / extent[axis] : 0.0f;
+            const float minC = centroidBox.min[axis];
+            auto binOf = [&](std::uint32_t t) {
+                return std::min(BIN_COUNT - 1, static_cast<std::uint32_t>((centroids[t][axis] - minC) * scale));
+            };
+
+            SBin bins[BIN_COUNT];
+            std::uint32_t bestBin = BIN_COUNT;
+            float bestCost = std::numeric_limits<float>::max();
+            if (scale > 0.0f) {
+                for (std::uint32_t i = first; i < first + count; ++i) {
+                    const std::uint32_t t = m_triangles[i];
+                    SBin& bin = bins[binOf(t)];
+                    bin.box.expand(boxes[t]);
+                    ++bin.count;
+                }
+
+                // Sweep from the right, then from the left.
+                float rightArea[BIN_COUNT];
+                std::uint32_t rightCount[BIN_COUNT];
+                SAABB accum;
+                std::uint32_t n = 0;
+                for (std::uint32_t b = BIN_COUNT - 1; b > 0; --b) {
+                    accum.expand(bins[b].box);
+                    n += bins[b].count;
+                    rightArea[b] = n ? accum.surfaceArea() : 0.0f;
+                    rightCount[b] = n;
+                }
+                accum = SAABB{};
+                n = 0;
+                for (std::uint32_t b = 0; b + 1 < BIN_COUNT; ++b) {
+                    accum.expand(bins[b].box);
+                    n += bins[b].count;
+                    if (n == 0 || rightCount[b + 1] == 0) continue;
+                    const float cost = accum.surfaceArea() * n + rightArea[b + 1] * rightCount[b + 1];
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        bestBin = b;
+                    }
+                }
+            }
+
+            const float leafCost = box.surfaceArea() * count;
+            const float splitCost = TRAVERSAL_COST * box.surfaceArea() + bestCost;
+            if (count <= MAX_LEAF_SIZE && (bestBin == BIN_COUNT || splitCost >= leafCost)) continue;
+
+            std::uint32_t mid;
+            if (bestBin != BIN_COUNT) {
+                auto* split = std::partition(m_triangles.data() + first, m_triangles.data() + first + count,
+                                             [&](std::uint32_t t) { return binOf(t) <= bestBin; });
+                mid = static_cast<std::uint32_t>(split - m_triangles.data());
+            } else {
+                // All centroids coincide: any split is as good as another.
+                mid = first + count / 2;
+            }
+
+            SAABB leftBox, rightBox, leftCentroids, rightCentroids;
+            if (bestBin != BIN_COUNT) {
+                for (std::uint32_t b = 0; b < BIN_COUNT; ++b) (b <= bestBin ? leftBox : rightBox).expand(bins[b].box);
+            }
+            for (std::uint32_t i = first; i < first + count; ++i) {
+                const std::uint32_t t = m_triangles[i];
+                (i < mid ? leftCentroids : rightCentroids).expand(centroids[t]);
+                if (bestBin == BIN_COUNT) (i < mid ? leftBox : rightBox).expand(boxes[t]);
+            }
+
+            const auto leftIndex = static_cast<std::uint32_t>(m_nodes.size());
+            m_nodes.push_back({leftBox.min, first, leftBox.max, mid - first});
+            m_nodes.push_back({rightBox.min, mid, rightBox.max, first + count - mid});
+            m_nodes[nodeIndex].leftFirst = leftIndex;
+            m_nodes[nodeIndex].count = 0;
+            stack.push_back({leftIndex, leftCentroids});
+            stack.push_back({leftIndex + 1, rightCentroids});
+        }
+    }
+
+    void CTriangleBVH::refit(const SMesh& mesh) {
+        // Children always follow their parent.
+        for (std::size_t i = m_nodes.size(); i-- > 0;) {
+            SNode& node = m_nodes[i];
+            SAABB box;
+            if (node.isLeaf()) {
+                for (std::uint32_t k = node.leftFirst; k < node.leftFirst + node.count; ++k) box.expand(triangleBox(mesh, m_triangles[k]));
+            } else {
+                box = SAABB::merged(m_nodes[node.leftFirst].box(), m_nodes[node.leftFirst + 1].box());
+            }
+            node.min = box.min;
+            node.max = box.max;
+        }
+    }
+
+    template<typename Func>
+    void CTriangleBVH::traverse(const Math::SRay& ray, float& maxT, Func&& leaf) const {
+        if (m_nodes.empty()) return;
+        std::uint32_t stack[128];
+        float entries[128];
+        int top = 0;
+        float t;
+        if (!m_nodes[0].box().intersects(ray, maxT, t)) return;
+        stack[top] = 0;
+        entries[top++] = t;
+        while (top > 0) {
+            --top;
+            if (entries[top] > maxT) continue;
+            const SNode& node = m_nodes[stack[top]];
+            if (node.isLeaf()) {
+                leaf(node);
+                continue;
+            }
+            float t1, t2;
+            const bool hit1 = m_nodes[node.leftFirst].box().intersects(ray, maxT, t1);
+            const bool hit2 = m_nodes[node.leftFirst + 1].box().intersects(ray, maxT, t2);
+            if (top + 2 > 128) {
+                KLOG_ERROR("Triangle BVH traversal stack overflow");
+                return;
+            }
+            if (hit1 && hit2 && t1 < t2) {
+                stack[top] = node.leftFirst + 1; entries[top++] = t2;
+                stack[top] = node.leftFirst;     entries[top++] = t1;
+            } else {
+                if (hit1) { stack[top] = node.leftFirst;     entries[top++] = t1; }
+                if (hit2) { stack[top] = node.leftFirst + 1; entries[top++] = t2; }
+            }
+        }
+    }
+
+    bool CTriangleBVH::intersect(const SMesh& mesh, const Math::SRay& ray, float maxT, SRayHit& hit) const {
+        bool found = false;
+        traverse(ray, maxT, [&](const SNode& node) {
+            for (std::uint32_t k = node.leftFirst; k < node.leftFirst + node.count; ++k) {
+                float t, u, v;
+                if (!intersectTriangle(mesh, m_triangles[k], ray, maxT, t, u, v)) continue;
+                maxT = t;
+                hit = {t, m_triangles[k], u, v};
+                found = true;
+            }
+        });
+        return found;
+    }
+
+    void CTriangleBVH::intersectAll(const SMesh& mesh, const Math::SRay& ray, float maxT, std::vector<SRayHit>& hits) const {
+        const float limit = maxT;
+        traverse(ray, maxT, [&](const SNode& node) {
+            for (std::uint32_t k = node.leftFirst; k < node.leftFirst + node.count; ++k) {
+                float t, u, v;
+                if (intersectTriangle(mesh, m_triangles[k], ray, limit, t, u, v)) hits.push_back({t, m_triangles[k], u, v});
+            }
+        });
+    }
+
+    void CTriangleBVH::overlapFrustum(const SMesh& mesh, const Math::SFrustum& frustum, std::vector<std::uint32_t>& triangles,
+                                      std::size_t limit) const {
+        if (m_nodes.empty() || limit == 0) return;
+        std::size_t found = 0;
+
+        auto outside = [&](std::uint32_t triangle) {
+            const Components::SIndex& tri = mesh.indices[triangle];
+            const glm::vec3 p[3] = {vertexPosition(mesh, tri.a), vertexPosition(mesh, tri.b), vertexPosition(mesh, tri.c)};
+            for (int plane = 0; plane < 6; ++plane) {
+                const glm::vec3 n(frustum.nx[plane], frustum.ny[plane], frustum.nz[plane]);
+                if (glm::dot(n, p[0]) + frustum.d[plane] < 0.0f && glm::dot(n, p[1]) + frustum.d[plane] < 0.0f &&
+                    glm::dot(n, p[2]) + frustum.d[plane] < 0.0f) return true;
+            }
+            return false;
+        };
+
+        std::vector<std::pair<std::uint32_t, bool>> stack{{0, false}}; // node, known inside
+        while (!stack.empty()) {
+            const auto [index, inside] = stack.back();
+            stack.pop_back();
+            const SNode& node = m_nodes[index];
+
+            Math::EContainment c = Math::EContainment::Inside;
+            if (!inside) c = frustum.classify(node.box());
+            if (c == Math::EContainment::Outside) continue;
+
+            const bool childInside = c == Math::EContainment::Inside;
+            if (node.isLeaf()) {
+                for (std::uint32_t k = node.leftFirst; k < node.leftFirst + node.count; ++k) {
+                    if (!childInside && outside(m_triangles[k])) continue;
+                    triangles.push_back(m_triangles[k]);
+                    if (++found == limit) return;
+                }
+            } else {
+                stack.push_back({node.leftFirst, childInside});
+                stack.push_back({node.leftFirst + 1, childInside});
+            }
+        }
+    }
+
+} // namespace Kinetica::Geometry
@@ -0,0 +1,372 @@
+#include <kinetica/io/asset_loader.hpp>
+#include <kinetica/io/importer.hpp>
+#include <kinetica/io/kin_file.hpp>
+#include <kinetica/ecs/transform_hierarchy.hpp>
+#include <kinetica/rendering/render_backend.hpp>
+#include <kinetica/log.hpp>
+#include <kinetica/profiler.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+
+namespace Kinetica::IO {
+
+    using Components::SIndex;
+    using Components::SMesh;
+    using Components::SVertex;
+
+    CAssetLoader::CAssetLoader(std::size_t threadCount, std::size_t maxQueuedBytes)
+        : m_maxQueuedBytes(maxQueuedBytes) {
+        threadCount = std::max<std::size_t>(threadCount, 1);
+        for (std::size_t i = 0; i < threadCount; ++i) {
+            m_workers.emplace_back([this, i] {
+                KPROFILE_THREAD("Asset loader " + std::to_string(i));
+                workerLoop();
+            });
+        }
+    }
+
+    CAssetLoader::~CAssetLoader() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_bStop = true;
+            for (const auto& request : m_requests) request->cancelled = true;
+        }
+        m_workAvailable.notify_all();
+        m_spaceAvailable.notify_all();
+        for (std::thread& worker : m_workers) worker.join();
+    }
+
+    CAssetLoader::SRequest* CAssetLoader::find(LoadHandle handle) const {
+        return handle != INVALID_LOAD && handle <= m_requests.size() ? m_requests[handle - 1].get() : nullptr;
+    }
+
+    CAssetLoader::LoadHandle CAssetLoader::load(const std::string& path, const SLoadOptions& options) {
+        LoadHandle handle;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto request = std::make_unique<SRequest>();
+            request->path = path;
+            request->options = options;
+            request->start = std::chrono::steady_clock::now();
+            m_requests.push_back(std::move(request));
+            handle = static_cast<LoadHandle>(m_requests.size());
+            m_queue.push_back(handle);
+        }
+        m_workAvailable.notify_one();
+        return handle;
+    }
+
+    void CAssetLoader::cancel(LoadHandle handle) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            SRequest* request = find(handle);
+            if (!request) return;
+            request->cancelled = true;
+        }
+        m_spaceAvailable.notify_all();
+    }
+
+    void CAssetLoader::cancelAll() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& request : m_requests) request->cancelled = true;
+        }
+        m_spaceAvailable.notify_all();
+    }
+
+    SLoadProgress CAssetLoader::progress(LoadHandle handle) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const SRequest* request = find(handle);
+        if (!request) return {};
+        SLoadProgress progress;
+        progress.state = request->state;
+        progress.fileBytes = request->fileBytes;
+        progress.bytesDecoded = request->bytesDecoded;
+        progress.bytesUploaded = request->bytesUploaded;
+        progress.entitiesTotal = request->entitiesTotal;
+        progress.entitiesCreated = request->entitiesCreated;
+        return progress;
+    }
+
+    bool CAssetLoader::isIdle() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_queue.empty() || !m_pending.empty() || m_busyWorkers > 0) return false;
+        return std::none_of(m_requests.begin(), m_requests.end(), [](const auto& request) {
+            const ELoadState state = request->state;
+            return state == ELoadState::Queued || state == ELoadState::Loading;
+        });
+    }
+
+    // ---- Loader threads ----
+
+    void CAssetLoader::workerLoop() {
+        while (true) {
+            LoadHandle handle;
+            SRequest* request;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_workAvailable.wait(lock, [this] { return m_bStop || !m_queue.empty(); });
+                if (m_bStop) return;
+                handle = m_queue.front();
+                m_queue.pop_front();
+                request = find(handle);
+                ++m_busyWorkers;
+            }
+
+            if (!request->cancelled) {
+                request->state = ELoadState::Loading;
+                try {
+                    decode(handle, *request);
+                } catch (const std::exception& e) {
+                    KLOG_ERROR("Failed to load " + request->path + ": " + e.what());
+                    request->state = ELoadState::Failed;
+                } catch (...) {
+                    KLOG_ERROR("Failed to load " + request->path + ": unknown exception");
+                    request->state = ELoadState::Failed;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            request->decodeFinished = true;
+            --m_busyWorkers;
+        }
+    }
+
+    bool CAssetLoader::push(SPendingEntity&& entity, SRequest& request) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // Back-pressure: wait for the render thread, but never on an empty queue.
+        m_spaceAvailable.wait(lock, [&] {
+            return m_bStop || request.cancelled || m_pending.empty() ||
+                   m_pendingBytes + entity.bytes <= m_maxQueuedBytes;
+        });
+        if (m_bStop || request.cancelled) return false;
+        m_pendingBytes += entity.bytes;
+        ++request.queued;
+        m_pending.push_back(std::move(entity));
+        return true;
+    }
+
+    void CAssetLoader::decode(LoadHandle handle, SRequest& request) {
+        KPROFILE_SCOPE("Asset decode");
+        if (isImportable(request.path)) {
+            decodeImport(handle, request);
+            return;
+        }
+
+        CKinReader reader;
+        if (!reader.open(request.path)) {
+            request.state = ELoadState::Failed;
+            return;
+        }
+        request.fileBytes = reader.fileSize();
+        request.entitiesTotal = static_cast<std::uint32_t>(reader.entities().size());
+
+        const auto entities = reader.entities();
+        for (std::uint32_t i = 0; i < entities.size(); ++i) {
+            if (request.cancelled) return;
+            const SKinEntity& record = entities[i];
+
+            SPendingEntity pending;
+            pending.request = handle;
+            pending.fileIndex = i;
+            pending.parent = record.parent;
+            std::memcpy(pending.uuid.data(), record.uuid, pending.uuid.size());
+
+            if (record.components & KIN_COMPONENT_TRANSFORM) {
+                const SKinTransform& t = reader.transforms()[i];
+                pending.hasTransform = true;
+                pending.transform.position = glm::vec3(t.position[0], t.position[1], t.position[2]);
+                pending.transform.rotation = glm::vec3(t.rotation[0], t.rotation[1], t.rotation[2]);
+                pending.transform.scale = glm::vec3(t.scale[0], t.scale[1], t.scale[2]);
+            }
+            if (record.components & KIN_COMPONENT_MATERIAL) {
+                pending.hasMaterial = true;
+                pending.material = reader.material(record.material);
+            }
+            if (record.components & KIN_COMPONENT_MESH) {
+                // Page faults on the mapping happen here, off the render thread.
+                const SKinMeshView view = reader.mesh(record.mesh);
+                SMesh& mesh = pending.mesh;
+                mesh.vertices.assign(view.vertices.begin(), view.vertices.end());
+                mesh.indices.assign(view.indices.begin(), view.indices.end());
+
+                const auto vertexCount = static_cast<std::uint32_t>(mesh.vertices.size());
+                const bool valid = std::all_of(mesh.indices.begin(), mesh.indices.end(), [&](const SIndex& t) {
+                    return t.a < vertexCount && t.b < vertexCount && t.c < vertexCount;
+                });
+                if (!valid) {
+                    KLOG_WARN("Mesh " + std::to_string(record.mesh) + " in " + request.path +
+                              " has out-of-range indices, dropped");
+                    mesh.vertices.clear();
+                    mesh.indices.clear();
+                }
+
+                if (valid && request.options.optimizeMeshes) {
+                    Geometry::optimizeMesh(mesh, request.options.optimize);
+                    mesh.updateBounds();
+                } else if (valid) {
+                    mesh.localBounds = view.bounds;
+                    mesh.boundsDirty = false;
+                }
+                pending.hasMesh = true;
+                pending.bytes = mesh.vertices.size() * sizeof(SVertex) + mesh.indices.size() * sizeof(SIndex);
+                request.bytesDecoded += pending.bytes;
+            }
+
+            if (!push(std::move(pending), request)) return;
+        }
+    }
+
+    void CAssetLoader::decodeImport(LoadHandle handle, SRequest& request) {
+        // No pool in the options: the importer spins up its own workers rather
+        // than queueing long parse tasks on the frame pool.
+        SImportResult result;
+        if (!importFile(request.path, result)) {
+            request.state = ELoadState::Failed;
+            return;
+        }
+        std::error_code ec;
+        request.fileBytes = std::filesystem::file_size(request.path, ec);
+        request.entitiesTotal = static_cast<std::uint32_t>(result.objects.size());
+
+        for (std::uint32_t i = 0; i < result.objects.size(); ++i) {
+            if (request.cancelled) return;
+            SImportedObject& object = result.objects[i];
+
+            SPendingEntity pending;
+            pending.request = handle;
+            pending.fileIndex = i;
+            pending.parent = object.parent;
+            pending.uuid = CUUID::generate().getBytes();
+            pending.hasTransform = true;
+            pending.transform = object.transform;
+            if (object.material < result.materials.size()) {
+                pending.hasMaterial = true;
+                pending.material = result.materials[object.material];
+            }
+            if (object.hasMesh) {
+                pending.mesh = std::move(object.mesh);
+                if (request.options.optimizeMeshes) {
+                    Geometry::optimizeMesh(pending.mesh, request.options.optimize);
+                    pending.mesh.updateBounds();
+                }
+                pending.hasMesh = true;
+                pending.bytes = pending.mesh.vertices.size() * sizeof(SVertex) +
+                                pending.mesh.indices.size() * sizeof(SIndex);
+                request.bytesDecoded += pending.bytes;
+            }
+
+            if (!push(std::move(pending), request)) return;
+        }
+    }
+
+    // ---- Render thread ----
+
+    void CAssetLoader::create(SPendingEntity& pending, SRequest& request, CRegistry& registry,
+                              CTransformHierarchy* hierarchy, IRenderBackend* renderer) {
+        if (request.entities.empty()) request.entities.assign(request.entitiesTotal, INVALID_ENTITY);
+
+        const CUUID uuid(pending.uuid);
+        EntityID entity;
+        if (registry.findEntity(uuid).isValid()) {
+            entity = registry.createEntity(); // the file was loaded before: new identity
+            ++request.duplicateUuids;
+        } else {
+            entity = registry.createEntity(uuid);
+        }
+        request.entities[pending.fileIndex] = entity;
+
+        if (pending.hasTransform) registry.addComponent<Components::STransform>(entity) = pending.transform;
+        if (pending.hasMaterial) registry.addComponent<Components::SMaterial>(entity) = std::move(pending.material);
+        if (pending.hasMesh) {
+            SMesh& mesh = registry.addComponent<SMesh>(entity);
+            const Math::SAABB bounds = pending.mesh.localBounds;
+            const bool boundsDirty = pending.mesh.boundsDirty;
+            mesh.vertices = std::move(pending.mesh.vertices);
+            mesh.indices = std::move(pending.mesh.indices);
+            mesh.markReplaced();
+            mesh.localBounds = bounds;
+            mesh.boundsDirty = boundsDirty;
+            if (renderer) renderer->uploadMesh(mesh);
+            request.bytesUploaded += pending.bytes;
+        }
+
+        if (hierarchy) {
+            // Parents may arrive after their children; link whichever side comes second.
+            if (pending.parent != KIN_NONE && pending.parent < request.entities.size()) {
+                const EntityID parent = request.entities[pending.parent];
+                if (parent.isValid()) hierarchy->setParent(entity, parent);
+                else request.orphans.emplace(pending.parent, pending.fileIndex);
+            }
+            auto [begin, end] = request.orphans.equal_range(pending.fileIndex);
+            for (auto it = begin; it != end; ++it) hierarchy->setParent(request.entities[it->second], entity);
+            request.orphans.erase(begin, end);
+        }
+        ++request.entitiesCreated;
+    }
+
+    void CAssetLoader::finishRequests() {
+        for (const auto& request : m_requests) {
+            const ELoadState state = request->state;
+            if (state == ELoadState::Done || state == ELoadState::Failed || state == ELoadState::Cancelled) continue;
+            if (!request->decodeFinished || request->queued > 0) continue;
+
+            if (request->cancelled) {
+                request->state = ELoadState::Cancelled;
+                KLOG_INFO("Cancelled loading " + request->path);
+                continue;
+            }
+            request->state = ELoadState::Done;
+            if (request->duplicateUuids > 0) {
+                KLOG_WARN(std::to_string(request->duplicateUuids) + " entities of " + request->path +
+                          " were already in the scene and got new UUIDs");
+            }
+            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                                 request->start);
+            KLOG_INFO("Loaded " + std::to_string(request->entitiesCreated.load()) + " entities from " +
+                      request->path + " in " + std::to_string(ms.count()) + " ms");
+            request->entities = {};
+            request->orphans = {};
+        }
+    }
+
+    std::size_t CAssetLoader::update(CRegistry& registry, CTransformHierarchy* hierarchy, IRenderBackend* renderer,
+                                     const SUploadBudget& budget) {
+        const auto start = std::chrono::steady_clock::now();
+        std::size_t created = 0;
+        std::size_t bytes = 0;
+
+        while (true) {
+            SPendingEntity pending;
+            SRequest* request;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_pending.empty()) break;
+                const double elapsed =
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                if (created > 0 && (bytes + m_pending.front().bytes > budget.bytes || elapsed >= budget.milliseconds))
+                    break;
+
+                pending = std::move(m_pending.front());
+                m_pending.pop_front();
+                m_pendingBytes -= pending.bytes;
+                request = find(pending.request);
+                --request->queued;
+            }
+            m_spaceAvailable.notify_all();
+
+            if (request->cancelled) continue;
+            create(pending, *request, registry, hierarchy, renderer);
+            bytes += pending.bytes;
+            ++created;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        finishRequests();
+        return created;
+    }
+
+} // namespace Kinetica::IO
@@ -0,0 +1,488 @@
+#include <kinetica/io/batch_processor.hpp>
+#include <kinetica/io/importer.hpp>
+#include <kinetica/io/kin_file.hpp>
+#include <kinetica/profiler.hpp>
+#include <kinetica/rendering/software_renderer.hpp>
+#include <kinetica/thread_pool.hpp>
+#include <kinetica/uuid.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Kinetica::IO {
+
+    using Components::SIndex;
+    using Components::SMesh;
+    using Components::SVertex;
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        double millisecondsSince(Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        std::string lowerExtension(const std::string& path) {
+            std::string extension = std::filesystem::path(path).extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return extension;
+        }
+
+        // Rough peak working set: text formats expand into attribute arrays
+        // plus the welded meshes; binary ones are mapped and copied once.
+        std::size_t estimateMemory(const std::string& path, std::uint64_t fileBytes) {
+            const std::uint64_t factor = lowerExtension(path) == ".obj" ? 3 : 2;
+            return static_cast<std::size_t>(fileBytes * factor + (std::uint64_t(1) << 20));
+        }
+
+        // Admission control on estimated bytes in flight.
+        class CMemoryGate {
+        public:
+            explicit CMemoryGate(std::size_t budget) : m_budget(budget) {}
+
+            void acquire(std::size_t bytes) {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_released.wait(lock, [&] { return m_inFlight == 0 || m_inFlight + bytes <= m_budget; });
+                m_inFlight += bytes;
+            }
+
+            void release(std::size_t bytes) {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_inFlight -= bytes;
+                }
+                m_released.notify_all();
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_released;
+            std::size_t m_budget;
+            std::size_t m_inFlight = 0;
+        };
+
+        // Holds bytes on a CMemoryGate until it goes out of scope.
+        class CGateReservation {
+        public:
+            CGateReservation(CMemoryGate& gate, std::size_t bytes) : m_gate(gate), m_bytes(bytes) { m_gate.acquire(m_bytes); }
+            ~CGateReservation() { m_gate.release(m_bytes); }
+            CGateReservation(const CGateReservation&) = delete;
+            CGateReservation& operator=(const CGateReservation&) = delete;
+
+        private:
+            CMemoryGate& m_gate;
+            std::size_t m_bytes;
+        };
+
+        bool readKin(const std::string& path, SImportResult& out) {
+            CKinReader reader;
+            if (!reader.open(path)) return false;
+            for (std::size_t i = 0; i < reader.materials().size(); ++i)
+                out.materials.push_back(reader.material(static_cast<std::uint32_t>(i)));
+
+            const auto entities = reader.entities();
+            out.objects.resize(entities.size());
+            for (std::size_t i = 0; i < entities.size(); ++i) {
+                const SKinEntity& record = entities[i];
+                SImportedObject& object = out.objects[i];
+                object.parent = record.parent;
+                if (record.components & KIN_COMPONENT_TRANSFORM) {
+                    const SKinTransform& t = reader.transforms()[i];
+                    object.transform.position = glm::vec3(t.position[0], t.position[1], t.position[2]);
+                    object.transform.rotation = glm::vec3(t.rotation[0], t.rotation[1], t.rotation[2]);
+                    object.transform.scale = glm::vec3(t.scale[0], t.scale[1], t.scale[2]);
+                }
+                if (record.components & KIN_COMPONENT_MATERIAL) object.material = record.material;
+                if (record.components & KIN_COMPONENT_MESH) {
+                    const SKinMeshView view = reader.mesh(record.mesh);
+                    object.hasMesh = true;
+                    object.mesh.vertices.assign(view.vertices.begin(), view.vertices.end());
+                    object.mesh.indices.assign(view.indices.begin(), view.indices.end());
+                    object.mesh.localBounds = view.bounds;
+                    object.mesh.boundsDirty = false;
+                }
+            }
+            return true;
+        }
+
+        // Returns false when the scene cannot be used as is; everything
+        // found is appended to `messages`.
+        bool validate(const SImportResult& scene, std::vector<std::string>& messages) {
+            bool ok = true;
+            auto error = [&](std::size_t object, const std::string& text) {
+                messages.push_back("error: object " + std::to_string(object) + ": " + text);
+                ok = false;
+            };
+            auto warning = [&](std::size_t object, const std::string& text) {
+                messages.push_back("warning: object " + std::to_string(object) + ": " + text);
+            };
+
+            for (std::size_t i = 0; i < scene.objects.size(); ++i) {
+                const SImportedObject& object = scene.objects[i];
+                if (object.parent != IMPORT_NONE && object.parent >= scene.objects.size())
+                    error(i, "parent index out of range");
+                if (object.material != IMPORT_NONE && object.material >= scene.materials.size())
+                    error(i, "material index out of range");
+                if (!object.hasMesh) continue;
+
+                const SMesh& mesh = object.mesh;
+                if (mesh.indices.empty()) warning(i, "empty mesh");
+
+                std::size_t nonFinite = 0;
+                for (const SVertex& v : mesh.vertices) {
+                    if (!std::isfinite(v.x) || !std::isfinite(v.y) || !std::isfinite(v.z) || !std::isfinite(v.nx) ||
+                        !std::isfinite(v.ny) || !std::isfinite(v.nz) || !std::isfinite(v.u) || !std::isfinite(v.v))
+                        ++nonFinite;
+                }
+                if (nonFinite > 0) error(i, std::to_string(nonFinite) + " vertices with non-finite attributes");
+
+                const auto vertexCount = static_cast<std::uint32_t>(mesh.vertices.size());
+                std::size_t outOfRange = 0, degenerate = 0;
+                for (const SIndex& t : mesh.indices) {
+                    if (t.a >= vertexCount || t.b >= vertexCount || t.c >= vertexCount) {
+                        ++outOfRange;
+                        continue;
+                    }
+                    if (t.a == t.b || t.b == t.c || t.a == t.c) {
+                        ++degenerate;
+                        continue;
+                    }
+                    const SVertex& a = mesh.vertices[t.a];
+                    const SVertex& b = mesh.vertices[t.b];
+                    const SVertex& c = mesh.vertices[t.c];
+                    const glm::vec3 n = glm::cross(glm::vec3(b.x - a.x, b.y - a.y, b.z - a.z),
+                                                   glm::vec3(c.x - a.x, c.y - a.y, c.z - a.z));
+                    if (glm::dot(n, n) == 0.0f) ++degenerate;
+                }
+                if (outOfRange > 0) error(i, std::to_string(outOfRange) + " triangles with out-of-range indices");
+                if (degenerate > 0) warning(i, std::to_string(degenerate) + " degenerate triangles");
+            }
+            return ok;
+        }
+
+        bool exportKin(const SImportResult& scene, const std::string& path) {
+            CKinWriter writer;
+            if (!writer.open(path)) return false;
+            std::vector<std::uint32_t> materials;
+            materials.reserve(scene.materials.size());
+            for (const auto& material : scene.materials) materials.push_back(writer.addMaterial(material));
+
+            for (const SImportedObject& object : scene.objects) {
+                std::uint32_t mesh = KIN_NONE;
+                if (object.hasMesh) {
+                    Math::SAABB bounds = object.mesh.localBounds;
+                    if (object.mesh.boundsDirty) {
+                        bounds = {};
+                        for (const SVertex& v : object.mesh.vertices) bounds.expand(glm::vec3(v.x, v.y, v.z));
+                    }
+                    mesh = writer.addMesh(object.mesh.vertices, object.mesh.indices, bounds);
+                }
+                const std::uint32_t material =
+                    object.material < materials.size() ? materials[object.material] : KIN_NONE;
+                writer.addEntity(CUUID::generate(), &object.transform, object.parent, mesh, material);
+            }
+            return writer.finish();
+        }
+
+        // Frames the world bounds from above and to the side and renders them
+        // like the viewport (same clear color and basic.frag shading).
+        bool renderThumbnail(const SImportResult& scene, const std::string& path, std::uint32_t size,
+                             CThreadPool& pool) {
+            const std::size_t count = scene.objects.size();
+            std::vector<glm::mat4> world(count);
+            std::vector<bool> resolved(count, false);
+            std::vector<std::uint32_t> chain;
+            for (std::size_t i = 0; i < count; ++i) {
+                chain.clear();
+                std::uint32_t at = static_cast<std::uint32_t>(i);
+                while (at < count && !resolved[at] && chain.size() <= count) { // bounded on parent cycles
+                    chain.push_back(at);
+                    at = scene.objects[at].parent;
+                }
+                glm::mat4 parent = at < count && resolved[at] ? world[at] : glm::mat4(1.0f);
+                for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+                    world[*it] = parent * scene.objects[*it].transform.getMatrix();
+                    resolved[*it] = true;
+                    parent = world[*it];
+                }
+            }
+
+            Math::SAABB bounds;
+            for (std::size_t i = 0; i < count; ++i) {
+                const SMesh& mesh = scene.objects[i].mesh;
+                if (!scene.objects[i].hasMesh || mesh.vertices.empty()) continue;
+                Math::SAABB local = mesh.localBounds;
+                if (mesh.boundsDirty) {
+                    local = {};
+                    for (const SVertex& v : mesh.vertices) local.expand(glm::vec3(v.x, v.y, v.z));
+                }
+                bounds.expand(local.transformed(world[i]));
+            }
+
+            CSoftwareRenderer renderer(size, size, &pool);
+            renderer.clear();
+            if (!bounds.isEmpty()) {
+                const float fov = glm::radians(40.0f);
+                const float radius = std::max(glm::length(bounds.extent()), 1e-4f);
+                const float distance = radius / std::sin(fov * 0.5f);
+                const glm::vec3 eye = bounds.center() + glm::normalize(glm::vec3(1.0f, 0.8f, 1.0f)) * distance;
+                renderer.setViewProjection(glm::lookAt(eye, bounds.center(), glm::vec3(0.0f, 1.0f, 0.0f)),
+                                           glm::perspective(fov, 1.0f, std::max(distance - radius, radius * 0.01f),
+                                                            distance + radius));
+
+                const Components::SMaterial fallback;
+                for (std::size_t i = 0; i < count; ++i) {
+                    const SImportedObject& object = scene.objects[i];
+                    if (!object.hasMesh) continue;
+                    renderer.submit(world[i], object.mesh,
+                                    object.material < scene.materials.size() ? scene.materials[object.material]
+                                                                             : fallback);
+                }
+                renderer.flushBatches();
+            }
+            return renderer.writeImage(path);
+        }
+
+        // <outputDir>/<stem>.kin, or <name>.<ext>.kin when several inputs
+        // share a stem (model.obj and model.glb). Thumbnails swap the .kin
+        // for .png.
+        std::vector<std::string> exportPaths(const std::vector<std::string>& files, const std::string& outputDir) {
+            auto target = [&](const std::string& input, bool keepExtension) {
+                std::filesystem::path path(input);
+                if (!outputDir.empty()) path = std::filesystem::path(outputDir) / path.filename();
+                if (keepExtension) path += ".kin";
+                else path.replace_extension(".kin");
+                return path.lexically_normal().string();
+            };
+            std::unordered_map<std::string, std::size_t> uses;
+            for (const std::string& file : files) ++uses[target(file, false)];
+            std::vector<std::string> paths;
+            paths.reserve(files.size());
+            for (const std::string& file : files) {
+                const std::string path = target(file, false);
+                paths.push_back(uses[path] > 1 && lowerExtension(file) != ".kin" ? target(file, true) : path);
+            }
+            return paths;
+        }
+
+        void processFile(SBatchFileResult& result, const std::string& outputPath, const SBatchOptions& options,
+                         CThreadPool& pool) {
+            SImportResult scene;
+            for (const EBatchStep step : options.pipeline) {
+                KPROFILE_SCOPE(batchStepName(step));
+                const Clock::time_point start = Clock::now();
+                bool ok = true;
+                switch (step) {
+                    case EBatchStep::Import: {
+                        SImportOptions importOptions;
+                        importOptions.pool = &pool;
+                        ok = lowerExtension(result.path) == ".kin" ? readKin(result.path, scene)
+                                                                   : importFile(result.path, scene, importOptions);
+                        if (!ok) result.messages.push_back("error: import failed");
+                        break;
+                    }
+                    case EBatchStep::Validate: ok = validate(scene, result.messages); break;
+                    case EBatchStep::Optimize: {
+                        std::vector<SMesh*> meshes;
+                        for (SImportedObject& object : scene.objects)
+                            if (object.hasMesh) meshes.push_back(&object.mesh);
+                        Geometry::optimizeMeshes(pool, meshes, options.optimize);
+                        for (SMesh* mesh : meshes) mesh->updateBounds();
+                        break;
+                    }
+                    case EBatchStep::Export: {
+                        std::error_code ec;
+                        if (std::filesystem::equivalent(outputPath, result.path, ec)) {
+                            result.messages.push_back("error: export would overwrite the input");
+                            ok = false;
+                        } else if (!exportKin(scene, outputPath)) {
+                            result.messages.push_back("error: failed to write " + outputPath);
+                            ok = false;
+                        }
+                        break;
+                    }
+                    case EBatchStep::Thumbnail: {
+                        const std::string imagePath = outputPath.substr(0, outputPath.size() - 4) + ".png";
+                        ok = renderThumbnail(scene, imagePath, options.thumbnailSize, pool);
+                        if (!ok) result.messages.push_back("error: failed to write " + imagePath);
+                        break;
+                    }
+                    case EBatchStep::Count: break;
+                }
+                result.stepMilliseconds[std::size_t(step)] += millisecondsSince(start);
+                if (!ok) return;
+            }
+
+            result.objects = scene.objects.size();
+            for (const SImportedObject& object : scene.objects) {
+                if (!object.hasMesh) continue;
+                ++result.meshes;
+                result.vertices += object.mesh.vertices.size();
+                result.triangles += object.mesh.indices.size();
+            }
+            result.ok = true;
+        }
+
+    } // namespace
+
+    const char* batchStepName(EBatchStep step) {
+        switch (step) {
+            case EBatchStep::Import: return "import";
+            case EBatchStep::Validate: return "validate";
+            case EBatchStep::Optimize: return "optimize";
+            case EBatchStep::Export: return "export";
+            case EBatchStep::Thumbnail: return "thumbnail";
+            default: return "?";
+        }
+    }
+
+    bool parseBatchPipeline(const std::string& text, std::vector<EBatchStep>& out) {
+        out.clear();
+        std::size_t begin = 0;
+        while (begin <= text.size()) {
+            const std::size_t end = std::min(text.find(',', begin), text.size());
+            const std::string name = text.substr(begin, end - begin);
+            begin = end + 1;
+            if (name.empty()) continue;
+
+            bool found = false;
+            for (std::size_t i = 0; i < std::size_t(EBatchStep::Count); ++i) {
+                if (name == batchStepName(EBatchStep(i))) {
+                    out.push_back(EBatchStep(i));
+                    found = true;
+                }
+            }
+            if (!found) return false;
+        }
+        if (out.empty() || out.front() != EBatchStep::Import) out.insert(out.begin(), EBatchStep::Import);
+        return true;
+    }
+
+    SBatchSummary runBatch(const std::vector<std::string>& files, const SBatchOptions& options,
+                           const BatchCallback& onFile) {
+        const Clock::time_point start = Clock::now();
+        SBatchSummary summary;
+        summary.jobs = options.jobs > 0 ? options.jobs : std::max(1u, std::thread::hardware_concurrency());
+        summary.jobs = std::min(summary.jobs, std::max<std::size_t>(files.size(), 1));
+
+        if (!options.outputDir.empty()) {
+            std::error_code ec;
+            std::filesystem::create_directories(options.outputDir, ec);
+        }
+
+        // Files run on their own threads (they block on the memory gate and do
+        // long serial work); only the short per-chunk and per-mesh tasks go
+        // to the shared pool.
+        const std::vector<std::string> outputs = exportPaths(files, options.outputDir);
+        CThreadPool pool;
+        CMemoryGate gate(options.memoryBudget);
+        std::mutex reportMutex;
+        std::atomic<std::size_t> next{0};
+
+        auto worker = [&] {
+            while (true) {
+                const std::size_t index = next.fetch_add(1);
+                if (index >= files.size()) return;
+
+                SBatchFileResult result;
+                result.path = files[index];
+                std::error_code ec;
+                result.fileBytes = std::filesystem::file_size(result.path, ec);
+                if (ec) {
+                    result.fileBytes = 0;
+                    result.messages.push_back("error: " + ec.message());
+                } else {
+                    const std::size_t estimate = estimateMemory(result.path, result.fileBytes);
+                    const Clock::time_point waitStart = Clock::now();
+                    const CGateReservation reservation(gate, estimate);
+                    result.waitMilliseconds = millisecondsSince(waitStart);
+                    // A throwing step fails this file only; the batch carries on.
+                    try {
+                        processFile(result, outputs[index], options, pool);
+                    } catch (const std::exception& e) {
+                        result.ok = false;
+                        result.messages.push_back(std::string("error: ") + e.what());
+                    } catch (...) {
+                        result.ok = false;
+                        result.messages.push_back("error: unknown exception");
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(reportMutex);
+                (result.ok ? summary.succeeded : summary.failed) += 1;
+                summary.bytes += result.fileBytes;
+                for (std::size_t i = 0; i < summary.stepMilliseconds.size(); ++i)
+                    summary.stepMilliseconds[i] += result.stepMilliseconds[i];
+                if (onFile) onFile(result);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < summary.jobs; ++i) {
+            threads.emplace_back([&worker, i] {
+                KPROFILE_THREAD("Batch job " + std::to_string(i));
+                worker();
+            });
+        }
+        worker();
+        for (std::thread& thread : threads) thread.join();
+
+        summary.wallMilliseconds = millisecondsSince(start);
+        return summary;
+    }
+
+    std::string formatBatchResult(const SBatchFileResult& result) {
+        char line[256];
+        std::snprintf(line, sizeof(line), "%-4s %s (%.1f MB)", result.ok ? "ok" : "FAIL", result.path.c_str(),
+                      static_cast<double>(result.fileBytes) / (1024.0 * 1024.0));
+        std::string text = line;
+        for (std::size_t i = 0; i < result.stepMilliseconds.size(); ++i) {
+            if (result.stepMilliseconds[i] <= 0.0) continue;
+            std::snprintf(line, sizeof(line), "  %s %.1f ms", batchStepName(EBatchStep(i)), result.stepMilliseconds[i]);
+            text += line;
+        }
+        if (result.waitMilliseconds >= 1.0) {
+            std::snprintf(line, sizeof(line), "  (waited %.1f ms for memory)", result.waitMilliseconds);
+            text += line;
+        }
+        if (result.ok) {
+            std::snprintf(line, sizeof(line), "  | %zu objects, %zu meshes, %zu vertices, %zu triangles", result.objects,
+                          result.meshes, result.vertices, result.triangles);
+            text += line;
+        }
+        for (const std::string& message : result.messages) text += "\n       " + message;
+        return text;
+    }
+
+    std::string formatBatchSummary(const SBatchSummary& summary) {
+        const double seconds = summary.wallMilliseconds / 1000.0;
+        const double megabytes = static_cast<double>(summary.bytes) / (1024.0 * 1024.0);
+        char line[256];
+        std::snprintf(line, sizeof(line), "%zu files (%zu ok, %zu failed), %.1f MB in %.2f s with %zu jobs: %.1f MB/s",
+                      summary.succeeded + summary.failed, summary.succeeded, summary.failed, megabytes, seconds,
+                      summary.jobs, seconds > 0.0 ? megabytes / seconds : 0.0);
+        std::string text = line;
+        text += "\n  time per step, summed over files:";
+        for (std::size_t i = 0; i < summary.stepMilliseconds.size(); ++i) {
+            if (summary.stepMilliseconds[i] <= 0.0) continue;
+            std::snprintf(line, sizeof(line), " %s %.1f ms", batchStepName(EBatchStep(i)), summary.stepMilliseconds[i]);
+            text += line;
+        }
+        return text;
+    }
+
+} // namespace Kinetica::IO
@@ -0,0 +1,525 @@
+#include "import_detail.hpp"
+#include "json.hpp"
+
+#include <kinetica/io/mapped_file.hpp>
+#include <kinetica/log.hpp>
+#include <kinetica/profiler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+
+namespace Kinetica::IO {
+
+    using Components::SIndex;
+    using Components::SMaterial;
+    using Components::SMesh;
+    using Components::STransform;
+    using Components::SVertex;
+    using Detail::SJsonValue;
+
+    namespace {
+
+        constexpr std::uint32_t GLB_MAGIC = 0x46546C67; // "glTF"
+        constexpr std::uint32_t GLB_CHUNK_JSON = 0x4E4F534A;
+        constexpr std::uint32_t GLB_CHUNK_BIN = 0x004E4942;
+
+        constexpr int COMPONENT_BYTE = 5120;
+        constexpr int COMPONENT_UNSIGNED_BYTE = 5121;
+        constexpr int COMPONENT_SHORT = 5122;
+        constexpr int COMPONENT_UNSIGNED_SHORT = 5123;
+        constexpr int COMPONENT_UNSIGNED_INT = 5125;
+        constexpr int COMPONENT_FLOAT = 5126;
+
+        constexpr int MODE_TRIANGLES = 4;
+
+        std::uint32_t readU32(const std::uint8_t* p) {
+            std::uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        // A buffer is either a mapped file, decoded bytes, or the GLB BIN chunk.
+        struct SBuffer {
+            CMappedFile file;
+            std::vector<std::uint8_t> owned;
+            std::span<const std::uint8_t> bytes;
+        };
+
+        bool decodeBase64(std::string_view text, std::vector<std::uint8_t>& out) {
+            static constexpr auto table = [] {
+                std::array<std::int8_t, 256> t{};
+                t.fill(-1);
+                const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+                for (int i = 0; i < 64; ++i) t[static_cast<std::uint8_t>(alphabet[i])] = static_cast<std::int8_t>(i);
+                return t;
+            }();
+            out.clear();
+            out.reserve(text.size() / 4 * 3);
+            std::uint32_t bits = 0;
+            int count = 0;
+            for (const char c : text) {
+                if (c == '=') break;
+                const std::int8_t value = table[static_cast<std::uint8_t>(c)];
+                if (value < 0) return false;
+                bits = bits << 6 | static_cast<std::uint32_t>(value);
+                if ((count += 6) >= 8) {
+                    count -= 8;
+                    out.push_back(static_cast<std::uint8_t>(bits >> count));
+                }
+            }
+            return true;
+        }
+
+        std::string decodeUri(std::string_view uri) {
+            std::string out;
+            out.reserve(uri.size());
+            for (std::size_t i = 0; i < uri.size(); ++i) {
+                unsigned value = 0;
+                if (uri[i] == '%' && i + 2 < uri.size() &&
+                    std::from_chars(uri.data() + i + 1, uri.data() + i + 3, value, 16).ptr == uri.data() + i + 3) {
+                    out += static_cast<char>(value);
+                    i += 2;
+                } else {
+                    out += uri[i];
+                }
+            }
+            return out;
+        }
+
+        bool loadBuffer(const SJsonValue& desc, const std::filesystem::path& directory,
+                        std::span<const std::uint8_t> glbChunk, SBuffer& buffer) {
+            const std::string uri = desc["uri"].stringOr({});
+            if (uri.empty()) {
+                buffer.bytes = glbChunk;
+            } else if (uri.starts_with("data:")) {
+                const std::size_t comma = uri.find(',');
+                if (comma == std::string::npos || uri.rfind(";base64", comma) == std::string::npos ||
+                    !decodeBase64(std::string_view(uri).substr(comma + 1), buffer.owned)) {
+                    KLOG_ERROR("Unsupported data URI in glTF buffer");
+                    return false;
+                }
+                buffer.bytes = buffer.owned;
+            } else {
+                const std::string path = (directory / decodeUri(uri)).string();
+                if (!buffer.file.open(path)) return false;
+                buffer.bytes = {buffer.file.data(), buffer.file.size()};
+            }
+            const auto length = static_cast<std::size_t>(desc["byteLength"].intOr(0));
+            if (buffer.bytes.size() < length) {
+                KLOG_ERROR("glTF buffer is shorter than its byteLength");
+                return false;
+            }
+            return true;
+        }
+
+        std::size_t componentSize(int type) {
+            switch (type) {
+                case COMPONENT_BYTE:
+                case COMPONENT_UNSIGNED_BYTE: return 1;
+                case COMPONENT_SHORT:
+                case COMPONENT_UNSIGNED_SHORT: return 2;
+                case COMPONENT_UNSIGNED_INT:
+                case COMPONENT_FLOAT: return 4;
+                default: return 0;
+            }
+        }
+
+        int componentCount(const std::string& type) {
+            if (type == "SCALAR") return 1;
+            if (type == "VEC2") return 2;
+            if (type == "VEC3") return 3;
+            if (type == "VEC4") return 4;
+            return 0;
+        }
+
+        // Strided view of an accessor; `data` is null for an accessor without
+        // a buffer view (all zeros).
+        struct SAccessor {
+            const std::uint8_t* data = nullptr;
+            std::size_t count = 0;
+            std::size_t stride = 0;
+            int componentType = 0;
+            int components = 0;
+            bool normalized = false;
+
+            float component(std::size_t i, int c) const {
+                if (!data) return 0.0f;
+                const std::uint8_t* p = data + i * stride + std::size_t(c) * componentSize(componentType);
+                switch (componentType) {
+                    case COMPONENT_FLOAT: {
+                        float value;
+                        std::memcpy(&value, p, sizeof(value));
+                        return value;
+                    }
+                    case COMPONENT_UNSIGNED_BYTE: return normalized ? *p / 255.0f : float(*p);
+                    case COMPONENT_BYTE: {
+                        const auto value = static_cast<std::int8_t>(*p);
+                        return normalized ? std::max(value / 127.0f, -1.0f) : float(value);
+                    }
+                    case COMPONENT_UNSIGNED_SHORT: {
+                        std::uint16_t value;
+                        std::memcpy(&value, p, sizeof(value));
+                        return normalized ? value / 65535.0f : float(value);
+                    }
+                    case COMPONENT_SHORT: {
+                        std::int16_t value;
+                        std::memcpy(&value, p, sizeof(value));
+                        return normalized ? std::max(value / 32767.0f, -1.0f) : float(value);
+                    }
+                    default: return 0.0f;
+                }
+            }
+
+            std::uint32_t index(std::size_t i) const {
+                if (!data) return 0;
+                const std::uint8_t* p = data + i * stride;
+                switch (componentType) {
+                    case COMPONENT_UNSIGNED_BYTE: return *p;
+                    case COMPONENT_UNSIGNED_SHORT: {
+                        std::uint16_t value;
+                        std::memcpy(&value, p, sizeof(value));
+                        return value;
+                    }
+                    case COMPONENT_UNSIGNED_INT: return readU32(p);
+                    default: return 0xFFFFFFFFu;
+                }
+            }
+        };
+
+        struct SDocument {
+            SJsonValue json;
+            std::vector<SBuffer> buffers;
+        };
+
+        bool accessor(const SDocument& doc, const SJsonValue& index, SAccessor& out) {
+            if (!index.isNumber()) return false;
+            const SJsonValue& desc = doc.json["accessors"][std::size_t(index.intOr(-1))];
+            if (!desc.isObject()) return false;
+            if (!desc["sparse"].isNull()) KLOG_WARN("Sparse glTF accessors are not supported, using base values");
+
+            out.componentType = static_cast<int>(desc["componentType"].intOr(0));
+            out.components = componentCount(desc["type"].stringOr({}));
+            out.normalized = desc["normalized"].type == SJsonValue::EType::Bool && desc["normalized"].boolean;
+            const std::size_t elementSize = componentSize(out.componentType) * std::size_t(out.components);
+            const std::int64_t count = desc["count"].intOr(-1);
+            if (elementSize == 0 || count < 0) return false;
+            out.count = static_cast<std::size_t>(count);
+
+            const SJsonValue& viewIndex = desc["bufferView"];
+            if (!viewIndex.isNumber()) {
+                // All zeros; never larger than the document's buffers could back.
+                std::size_t totalBytes = 0;
+                for (const SBuffer& buffer : doc.buffers) totalBytes += buffer.bytes.size();
+                return out.count <= totalBytes / elementSize;
+            }
+            const SJsonValue& view = doc.json["bufferViews"][std::size_t(viewIndex.intOr(-1))];
+            const auto buffer = static_cast<std::size_t>(view["buffer"].intOr(-1));
+            if (buffer >= doc.buffers.size()) return false;
+
+            const std::span<const std::uint8_t> bytes = doc.buffers[buffer].bytes;
+            const std::int64_t viewOffset = view["byteOffset"].intOr(0);
+            const std::int64_t viewLength = view["byteLength"].intOr(-1);
+            const std::int64_t offset = desc["byteOffset"].intOr(0);
+            const std::int64_t stride = view["byteStride"].intOr(0);
+            if (viewOffset < 0 || viewLength < 0 || offset < 0) return false;
+            // The spec's limits; also keeps the bounds arithmetic below from wrapping.
+            if (view["byteStride"].isNumber() &&
+                (stride < 4 || stride > 252 || stride % 4 != 0 || std::size_t(stride) < elementSize))
+                return false;
+            out.stride = view["byteStride"].isNumber() ? std::size_t(stride) : elementSize;
+
+            if (std::uint64_t(viewOffset) > bytes.size() || std::uint64_t(viewLength) > bytes.size() - std::size_t(viewOffset))
+                return false;
+            const auto available = static_cast<std::size_t>(viewLength);
+            if (std::uint64_t(offset) > available) return false;
+            const std::size_t remaining = available - std::size_t(offset);
+            if (out.count > 0 && (remaining < elementSize || out.count - 1 > (remaining - elementSize) / out.stride))
+                return false;
+            out.data = bytes.data() + std::size_t(viewOffset) + std::size_t(offset);
+            return true;
+        }
+
+        bool buildPrimitive(const SDocument& doc, const SJsonValue& primitive, SMesh& mesh) {
+            const SJsonValue& attributes = primitive["attributes"];
+            SAccessor positions, normals, uvs, indices;
+            if (!accessor(doc, attributes["POSITION"], positions) || positions.components != 3 ||
+                positions.count > UINT32_MAX)
+                return false;
+            const bool hasNormals = accessor(doc, attributes["NORMAL"], normals) && normals.components == 3 &&
+                                    normals.count == positions.count;
+            const bool hasUvs = accessor(doc, attributes["TEXCOORD_0"], uvs) && uvs.components == 2 &&
+                                uvs.count == positions.count;
+
+            mesh.vertices.resize(positions.count);
+            for (std::size_t i = 0; i < positions.count; ++i) {
+                SVertex& v = mesh.vertices[i];
+                v.x = positions.component(i, 0);
+                v.y = positions.component(i, 1);
+                v.z = positions.component(i, 2);
+                v.nx = hasNormals ? normals.component(i, 0) : 0.0f;
+                v.ny = hasNormals ? normals.component(i, 1) : 0.0f;
+                v.nz = hasNormals ? normals.component(i, 2) : 0.0f;
+                v.u = hasUvs ? uvs.component(i, 0) : 0.0f;
+                v.v = hasUvs ? uvs.component(i, 1) : 0.0f;
+            }
+
+            const auto vertexCount = static_cast<std::uint32_t>(positions.count);
+            if (primitive["indices"].isNumber()) {
+                if (!accessor(doc, primitive["indices"], indices) || indices.components != 1) return false;
+                mesh.indices.reserve(indices.count / 3);
+                std::size_t dropped = 0;
+                for (std::size_t i = 0; i + 2 < indices.count; i += 3) {
+                    const SIndex t{indices.index(i), indices.index(i + 1), indices.index(i + 2)};
+                    if (t.a < vertexCount && t.b < vertexCount && t.c < vertexCount) mesh.indices.push_back(t);
+                    else ++dropped;
+                }
+                if (dropped > 0) KLOG_WARN(std::to_string(dropped) + " glTF triangles with out-of-range indices dropped");
+            } else {
+                mesh.indices.reserve(vertexCount / 3);
+                for (std::uint32_t i = 0; i + 2 < vertexCount; i += 3) mesh.indices.push_back({i, i + 1, i + 2});
+            }
+
+            if (!hasNormals) Detail::generateNormals(mesh);
+            mesh.updateBounds();
+            mesh.markReplaced();
+            mesh.boundsDirty = false;
+            return true;
+        }
+
+        // Euler angles in the STransform convention (R = Rz * Ry * Rx).
+        glm::vec3 eulerFromMatrix(const glm::mat3& r) {
+            // glm is column-major: r[col][row].
+            const float sy = std::clamp(-r[0][2], -1.0f, 1.0f);
+            const float y = std::asin(sy);
+            if (std::abs(sy) > 0.9999f) return {0.0f, y, std::atan2(-r[1][0], r[1][1])};
+            return {std::atan2(r[1][2], r[2][2]), y, std::atan2(r[0][1], r[0][0])};
+        }
+
+        STransform nodeTransform(const SJsonValue& node) {
+            STransform transform;
+            const SJsonValue& matrix = node["matrix"];
+            if (matrix.isArray() && matrix.size() == 16) {
+                glm::mat4 m;
+                for (int i = 0; i < 16; ++i) m[i / 4][i % 4] = matrix[std::size_t(i)].floatOr(0.0f);
+                glm::vec3 columns[3] = {glm::vec3(m[0]), glm::vec3(m[1]), glm::vec3(m[2])};
+                transform.position = glm::vec3(m[3]);
+                transform.scale = {glm::length(columns[0]), glm::length(columns[1]), glm::length(columns[2])};
+                if (glm::dot(glm::cross(columns[0], columns[1]), columns[2]) < 0.0f) transform.scale.x = -transform.scale.x;
+                glm::mat3 rotation;
+                for (int c = 0; c < 3; ++c)
+                    rotation[c] = transform.scale[c] != 0.0f ? columns[c] / transform.scale[c] : glm::vec3(0.0f);
+                transform.rotation = eulerFromMatrix(rotation);
+                return transform;
+            }
+
+            const SJsonValue& t = node["translation"];
+            const SJsonValue& r = node["rotation"];
+            const SJsonValue& s = node["scale"];
+            for (std::size_t i = 0; i < 3; ++i) {
+                transform.position[int(i)] = t[i].floatOr(0.0f);
+                transform.scale[int(i)] = s[i].floatOr(1.0f);
+            }
+            if (r.isArray() && r.size() == 4) {
+                const glm::quat q(r[3].floatOr(1.0f), r[0].floatOr(0.0f), r[1].floatOr(0.0f), r[2].floatOr(0.0f));
+                transform.rotation = eulerFromMatrix(glm::mat3_cast(glm::normalize(q)));
+            }
+            return transform;
+        }
+
+        bool readDocument(const std::string& path, CMappedFile& file, SDocument& doc) {
+            if (!file.open(path)) return false;
+            std::string_view json(reinterpret_cast<const char*>(file.data()), file.size());
+            std::span<const std::uint8_t> binChunk;
+
+            if (file.size() >= 12 && readU32(file.data()) == GLB_MAGIC) {
+                const std::uint8_t* p = file.data();
+                if (readU32(p + 4) != 2) {
+                    KLOG_ERROR("Unsupported GLB version in " + path);
+                    return false;
+                }
+                const std::size_t length = std::min<std::size_t>(readU32(p + 8), file.size());
+                json = {};
+                for (std::size_t offset = 12; offset + 8 <= length;) {
+                    const std::size_t chunkLength = readU32(p + offset);
+                    const std::uint32_t chunkType = readU32(p + offset + 4);
+                    offset += 8;
+                    if (chunkLength > length - offset) break;
+                    if (chunkType == GLB_CHUNK_JSON && json.empty())
+                        json = {reinterpret_cast<const char*>(p + offset), chunkLength};
+                    else if (chunkType == GLB_CHUNK_BIN && binChunk.empty())
+                        binChunk = {p + offset, chunkLength};
+                    offset += (chunkLength + 3) & ~std::size_t(3);
+                }
+                if (json.empty()) {
+                    KLOG_ERROR("GLB file " + path + " has no JSON chunk");
+                    return false;
+                }
+            }
+
+            std::string error;
+            if (!Detail::parseJson(json, doc.json, error)) {
+                KLOG_ERROR("Failed to parse " + path + ": " + error);
+                return false;
+            }
+            const std::string version = doc.json["asset"]["version"].stringOr({});
+            if (!version.starts_with("2")) {
+                KLOG_ERROR("Unsupported glTF version '" + version + "' in " + path);
+                return false;
+            }
+
+            const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+            const SJsonValue& buffers = doc.json["buffers"];
+            doc.buffers.resize(buffers.size());
+            for (std::size_t i = 0; i < buffers.size(); ++i) {
+                if (!loadBuffer(buffers[i], directory, binChunk, doc.buffers[i])) {
+                    KLOG_ERROR("Failed to load buffer " + std::to_string(i) + " of " + path);
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    } // namespace
+
+    bool importGltf(const std::string& path, SImportResult& out, const SImportOptions& options) {
+        KPROFILE_SCOPE("glTF import");
+        CMappedFile file;
+        SDocument doc;
+        if (!readDocument(path, file, doc)) return false;
+        const SJsonValue& json = doc.json;
+
+        for (std::size_t i = 0; i < json["materials"].size(); ++i) {
+            const SJsonValue& desc = json["materials"][i];
+            const SJsonValue& pbr = desc["pbrMetallicRoughness"];
+            SMaterial& material = out.materials.emplace_back();
+            material.name = desc["name"].stringOr("Material " + std::to_string(i));
+            const SJsonValue& color = pbr["baseColorFactor"];
+            for (std::size_t c = 0; c < 3; ++c) material.baseColor[int(c)] = color[c].floatOr(1.0f);
+            material.metallic = pbr["metallicFactor"].floatOr(1.0f);
+            material.roughness = pbr["roughnessFactor"].floatOr(1.0f);
+        }
+        std::uint32_t defaultMaterial = IMPORT_NONE;
+        auto primitiveMaterial = [&](const SJsonValue& primitive) {
+            const auto index = static_cast<std::size_t>(primitive["material"].intOr(-1));
+            if (index < json["materials"].size()) return static_cast<std::uint32_t>(index);
+            if (defaultMaterial == IMPORT_NONE) {
+                defaultMaterial = static_cast<std::uint32_t>(out.materials.size());
+                out.materials.emplace_back();
+            }
+            return defaultMaterial;
+        };
+
+        // Every triangle primitive, built once in parallel even if several
+        // nodes reference its mesh.
+        struct SPrimitive {
+            const SJsonValue* desc;
+            SMesh mesh;
+            bool valid = false;
+            std::size_t uses = 0;
+        };
+        const SJsonValue& meshes = json["meshes"];
+        std::vector<std::size_t> firstPrimitive(meshes.size() + 1, 0);
+        std::vector<SPrimitive> primitives;
+        std::size_t skipped = 0;
+        for (std::size_t m = 0; m < meshes.size(); ++m) {
+            firstPrimitive[m] = primitives.size();
+            const SJsonValue& list = meshes[m]["primitives"];
+            for (std::size_t p = 0; p < list.size(); ++p) {
+                if (list[p]["mode"].intOr(MODE_TRIANGLES) != MODE_TRIANGLES) {
+                    ++skipped;
+                    continue;
+                }
+                primitives.push_back({&list[p], {}, false, 0});
+            }
+        }
+        firstPrimitive[meshes.size()] = primitives.size();
+        if (skipped > 0) KLOG_WARN(std::to_string(skipped) + " non-triangle primitives skipped in " + path);
+
+        Detail::withPool(options, [&](CThreadPool& pool) {
+            pool.parallelFor(primitives.size(), 1, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) primitives[i].valid = buildPrimitive(doc, *primitives[i].desc, primitives[i].mesh);
+            });
+        });
+        const auto invalid = std::count_if(primitives.begin(), primitives.end(), [](const SPrimitive& p) { return !p.valid; });
+        if (invalid > 0) KLOG_WARN(std::to_string(invalid) + " glTF primitives with bad accessors skipped in " + path);
+
+        // Node traversal from the scene roots (or every parentless node).
+        const SJsonValue& nodes = json["nodes"];
+        std::vector<std::size_t> roots;
+        const SJsonValue& scene = json["scenes"][std::size_t(json["scene"].intOr(0))];
+        if (scene.isObject()) {
+            for (std::size_t i = 0; i < scene["nodes"].size(); ++i)
+                roots.push_back(static_cast<std::size_t>(scene["nodes"][i].intOr(-1)));
+        } else {
+            std::vector<bool> isChild(nodes.size(), false);
+            for (std::size_t i = 0; i < nodes.size(); ++i)
+                for (std::size_t c = 0; c < nodes[i]["children"].size(); ++c) {
+                    const auto child = static_cast<std::size_t>(nodes[i]["children"][c].intOr(-1));
+                    if (child < nodes.size()) isChild[child] = true;
+                }
+            for (std::size_t i = 0; i < nodes.size(); ++i)
+                if (!isChild[i]) roots.push_back(i);
+        }
+
+        struct SVisit {
+            std::size_t node;
+            std::uint32_t parent;
+        };
+        std::vector<SVisit> stack;
+        for (auto it = roots.rbegin(); it != roots.rend(); ++it) stack.push_back({*it, IMPORT_NONE});
+        std::vector<bool> visited(nodes.size(), false);
+        std::vector<std::pair<std::uint32_t, std::size_t>> meshSlots; // object -> primitive
+
+        while (!stack.empty()) {
+            const SVisit visit = stack.back();
+            stack.pop_back();
+            if (visit.node >= nodes.size() || visited[visit.node]) continue;
+            visited[visit.node] = true;
+
+            const SJsonValue& node = nodes[visit.node];
+            const auto self = static_cast<std::uint32_t>(out.objects.size());
+            SImportedObject& object = out.objects.emplace_back();
+            object.name = node["name"].stringOr("Node " + std::to_string(visit.node));
+            object.transform = nodeTransform(node);
+            object.parent = visit.parent;
+
+            const auto mesh = static_cast<std::size_t>(node["mesh"].intOr(-1));
+            if (mesh < meshes.size()) {
+                std::vector<std::size_t> valid;
+                for (std::size_t p = firstPrimitive[mesh]; p < firstPrimitive[mesh + 1]; ++p)
+                    if (primitives[p].valid) valid.push_back(p);
+                if (valid.size() == 1) {
+                    meshSlots.emplace_back(self, valid[0]);
+                } else {
+                    // One mesh and material per entity: primitives become children.
+                    for (std::size_t i = 0; i < valid.size(); ++i) {
+                        SImportedObject& child = out.objects.emplace_back();
+                        child.name = out.objects[self].name + " #" + std::to_string(i);
+                        child.parent = self;
+                        meshSlots.emplace_back(static_cast<std::uint32_t>(out.objects.size() - 1), valid[i]);
+                    }
+                }
+                for (std::size_t p : valid) ++primitives[p].uses;
+            }
+
+            const SJsonValue& children = node["children"];
+            for (std::size_t c = children.size(); c-- > 0;)
+                stack.push_back({static_cast<std::size_t>(children[c].intOr(-1)), self});
+        }
+
+        for (const auto& [objectIndex, p] : meshSlots) {
+            SImportedObject& object = out.objects[objectIndex];
+            SPrimitive& primitive = primitives[p];
+            object.hasMesh = true;
+            object.material = primitiveMaterial(*primitive.desc);
+            if (--primitive.uses == 0) object.mesh = std::move(primitive.mesh);
+            else object.mesh = primitive.mesh;
+        }
+        return true;
+    }
+
+} // namespace Kinetica::IO
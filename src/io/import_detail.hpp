@@ -0,0 +1,32 @@
+#ifndef KINETICA_IO_IMPORT_DETAIL_HPP
+#define KINETICA_IO_IMPORT_DETAIL_HPP
+
+// Helpers shared by the OBJ and glTF importers.
+
+#include <kinetica/io/importer.hpp>
+#include <kinetica/thread_pool.hpp>
+
+#include <functional>
+#include <memory>
+#include <span>
+
+namespace Kinetica::IO::Detail {
+
+    // Area-weighted smooth normals for the vertices flagged in `missing`
+    // (all vertices when empty). Vertices with equal positions share a normal
+    // so uv seams do not show.
+    void generateNormals(Components::SMesh& mesh, std::span<const std::uint8_t> missing = {});
+
+    // Runs fn(pool) on options.pool, or on a temporary pool when none is given.
+    inline void withPool(const SImportOptions& options, const std::function<void(CThreadPool&)>& fn) {
+        if (options.pool) {
+            fn(*options.pool);
+            return;
+        }
+        CThreadPool pool;
+        fn(pool);
+    }
+
+} // namespace Kinetica::IO::Detail
+
+#endif
@@ -0,0 +1,124 @@
+#include "import_detail.hpp"
+
+#include <kinetica/ecs/transform_hierarchy.hpp>
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <filesystem>
+#include <numeric>
+
+namespace Kinetica::IO {
+
+    using Components::SMaterial;
+    using Components::SMesh;
+    using Components::STransform;
+
+    namespace Detail {
+
+        void generateNormals(SMesh& mesh, std::span<const std::uint8_t> missing) {
+            auto& vertices = mesh.vertices;
+            const std::size_t count = vertices.size();
+            if (count == 0) return;
+
+            // Group vertices by exact position so seams get one shared normal.
+            // Bit patterns order NaNs too (std::sort needs a strict weak order);
+            // adding 0.0f folds -0 into +0.
+            std::vector<std::uint32_t> order(count);
+            std::iota(order.begin(), order.end(), 0u);
+            auto bits = [](float value) { return std::bit_cast<std::uint32_t>(value + 0.0f); };
+            auto position = [&](std::uint32_t i) {
+                return std::array<std::uint32_t, 3>{bits(vertices[i].x), bits(vertices[i].y), bits(vertices[i].z)};
+            };
+            std::sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) { return position(a) < position(b); });
+            std::vector<std::uint32_t> group(count);
+            std::uint32_t groups = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                if (i > 0 && position(order[i]) != position(order[i - 1])) ++groups;
+                group[order[i]] = groups;
+            }
+
+            std::vector<glm::vec3> sums(std::size_t(groups) + 1, glm::vec3(0.0f));
+            for (const auto& t : mesh.indices) {
+                const glm::vec3 a(vertices[t.a].x, vertices[t.a].y, vertices[t.a].z);
+                const glm::vec3 b(vertices[t.b].x, vertices[t.b].y, vertices[t.b].z);
+                const glm::vec3 c(vertices[t.c].x, vertices[t.c].y, vertices[t.c].z);
+                const glm::vec3 n = glm::cross(b - a, c - a); // length is twice the area
+                sums[group[t.a]] += n;
+                sums[group[t.b]] += n;
+                sums[group[t.c]] += n;
+            }
+
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!missing.empty() && !missing[i]) continue;
+                const glm::vec3 sum = sums[group[i]];
+                const float length = glm::length(sum);
+                const glm::vec3 n = length > 0.0f ? sum / length : glm::vec3(0.0f, 1.0f, 0.0f);
+                vertices[i].nx = n.x;
+                vertices[i].ny = n.y;
+                vertices[i].nz = n.z;
+            }
+        }
+
+    } // namespace Detail
+
+    namespace {
+
+        std::string lowerExtension(const std::string& path) {
+            std::string extension = std::filesystem::path(path).extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return extension;
+        }
+
+    } // namespace
+
+    bool isImportable(const std::string& path) {
+        const std::string extension = lowerExtension(path);
+        return extension == ".obj" || extension == ".gltf" || extension == ".glb";
+    }
+
+    bool importFile(const std::string& path, SImportResult& out, const SImportOptions& options) {
+        const std::string extension = lowerExtension(path);
+        if (extension == ".obj") return importObj(path, out, options);
+        if (extension == ".gltf" || extension == ".glb") return importGltf(path, out, options);
+        KLOG_ERROR("Unsupported model format: " + path);
+        return false;
+    }
+
+    std::vector<EntityID> instantiate(SImportResult& result, CRegistry& registry, CTransformHierarchy* hierarchy) {
+        std::vector<EntityID> created;
+        created.reserve(result.objects.size());
+        registry.reserveEntities(result.objects.size());
+
+        for (SImportedObject& object : result.objects) {
+            const EntityID entity = registry.createEntity();
+            created.push_back(entity);
+
+            registry.addComponent<STransform>(entity) = object.transform;
+            if (object.hasMesh) {
+                SMesh& mesh = registry.addComponent<SMesh>(entity);
+                const Math::SAABB bounds = object.mesh.localBounds;
+                const bool boundsDirty = object.mesh.boundsDirty;
+                mesh.vertices = std::move(object.mesh.vertices);
+                mesh.indices = std::move(object.mesh.indices);
+                mesh.markReplaced();
+                mesh.localBounds = bounds;
+                mesh.boundsDirty = boundsDirty;
+            }
+            if (object.material < result.materials.size())
+                registry.addComponent<SMaterial>(entity) = result.materials[object.material];
+        }
+
+        if (hierarchy) {
+            for (std::size_t i = 0; i < result.objects.size(); ++i) {
+                const std::uint32_t parent = result.objects[i].parent;
+                if (parent < created.size()) hierarchy->setParent(created[i], created[parent]);
+            }
+        }
+        return created;
+    }
+
+} // namespace Kinetica::IO
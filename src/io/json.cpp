@@ -0,0 +1,229 @@
+#include "json.hpp"
+
+#include <charconv>
+#include <cmath>
+
+namespace Kinetica::IO::Detail {
+
+    namespace {
+
+        constexpr int MAX_DEPTH = 256;
+
+        class CJsonParser {
+        public:
+            explicit CJsonParser(std::string_view text) : m_p(text.data()), m_end(text.data() + text.size()) {}
+
+            bool parse(SJsonValue& out, std::string& error) {
+                skipWhitespace();
+                if (!value(out, 0)) {
+                    error = m_error.empty() ? "malformed JSON" : m_error;
+                    return false;
+                }
+                skipWhitespace();
+                if (m_p != m_end) {
+                    error = "trailing characters after JSON value";
+                    return false;
+                }
+                return true;
+            }
+
+        private:
+            bool fail(const char* message) {
+                m_error = message;
+                return false;
+            }
+
+            void skipWhitespace() {
+                while (m_p < m_end && (*m_p == ' ' || *m_p == '\t' || *m_p == '\n' || *m_p == '\r')) ++m_p;
+            }
+
+            bool literal(std::string_view word) {
+                if (std::size_t(m_end - m_p) < word.size() || std::string_view(m_p, word.size()) != word) return false;
+                m_p += word.size();
+                return true;
+            }
+
+            bool value(SJsonValue& out, int depth) {
+                if (depth > MAX_DEPTH) return fail("JSON nested too deeply");
+                if (m_p == m_end) return fail("unexpected end of JSON");
+                switch (*m_p) {
+                    case '{': return object(out, depth);
+                    case '[': return array(out, depth);
+                    case '"':
+                        out.type = SJsonValue::EType::String;
+                        return string(out.string);
+                    case 't':
+                        out.type = SJsonValue::EType::Bool;
+                        out.boolean = true;
+                        return literal("true") || fail("invalid literal");
+                    case 'f':
+                        out.type = SJsonValue::EType::Bool;
+                        out.boolean = false;
+                        return literal("false") || fail("invalid literal");
+                    case 'n':
+                        out.type = SJsonValue::EType::Null;
+                        return literal("null") || fail("invalid literal");
+                    default: return number(out);
+                }
+            }
+
+            bool number(SJsonValue& out) {
+                // from_chars rejects a leading '+', which JSON does too, but
+                // accepts "inf" and "nan", which it does not.
+                if (*m_p != '-' && (*m_p < '0' || *m_p > '9')) return fail("invalid number");
+                const auto [next, ec] = std::from_chars(m_p, m_end, out.number);
+                if (ec != std::errc() || next == m_p || !std::isfinite(out.number)) return fail("invalid number");
+                out.type = SJsonValue::EType::Number;
+                m_p = next;
+                return true;
+            }
+
+            static void appendUtf8(std::string& s, std::uint32_t c) {
+                if (c < 0x80) {
+                    s += static_cast<char>(c);
+                } else if (c < 0x800) {
+                    s += static_cast<char>(0xC0 | (c >> 6));
+                    s += static_cast<char>(0x80 | (c & 0x3F));
+                } else if (c < 0x10000) {
+                    s += static_cast<char>(0xE0 | (c >> 12));
+                    s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                    s += static_cast<char>(0x80 | (c & 0x3F));
+                } else {
+                    s += static_cast<char>(0xF0 | (c >> 18));
+                    s += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+                    s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                    s += static_cast<char>(0x80 | (c & 0x3F));
+                }
+            }
+
+            bool hex4(std::uint32_t& out) {
+                if (m_end - m_p < 4) return false;
+                const auto [next, ec] = std::from_chars(m_p, m_p + 4, out, 16);
+                if (ec != std::errc() || next != m_p + 4) return false;
+                m_p = next;
+                return true;
+            }
+
+            bool string(std::string& out) {
+                ++m_p; // opening quote
+                out.clear();
+                while (m_p < m_end && *m_p != '"') {
+                    const char c = *m_p++;
+                    if (c != '\\') {
+                        out += c;
+                        continue;
+                    }
+                    if (m_p == m_end) break;
+                    switch (*m_p++) {
+                        case '"': out += '"'; break;
+                        case '\\': out += '\\'; break;
+                        case '/': out += '/'; break;
+                        case 'b': out += '\b'; break;
+                        case 'f': out += '\f'; break;
+                        case 'n': out += '\n'; break;
+                        case 'r': out += '\r'; break;
+                        case 't': out += '\t'; break;
+                        case 'u': {
+                            std::uint32_t code;
+                            if (!hex4(code)) return fail("invalid \\u escape");
+                            if (code >= 0xD800 && code < 0xDC00 && m_end - m_p >= 6 && m_p[0] == '\\' && m_p[1] == 'u') {
+                                m_p += 2;
+                                std::uint32_t low;
+                                if (!hex4(low)) return fail("invalid \\u escape");
+                                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                            }
+                            appendUtf8(out, code);
+                            break;
+                        }
+                        default: return fail("invalid escape");
+                    }
+                }
+                if (m_p == m_end) return fail("unterminated string");
+                ++m_p; // closing quote
+                return true;
+            }
+
+            bool array(SJsonValue& out, int depth) {
+                ++m_p;
+                out.type = SJsonValue::EType::Array;
+                skipWhitespace();
+                if (m_p < m_end && *m_p == ']') {
+                    ++m_p;
+                    return true;
+                }
+                while (true) {
+                    skipWhitespace();
+                    out.array.emplace_back();
+                    if (!value(out.array.back(), depth + 1)) return false;
+                    skipWhitespace();
+                    if (m_p == m_end) return fail("unterminated array");
+                    if (*m_p == ',') {
+                        ++m_p;
+                        continue;
+                    }
+                    if (*m_p == ']') {
+                        ++m_p;
+                        return true;
+                    }
+                    return fail("expected ',' or ']'");
+                }
+            }
+
+            bool object(SJsonValue& out, int depth) {
+                ++m_p;
+                out.type = SJsonValue::EType::Object;
+                skipWhitespace();
+                if (m_p < m_end && *m_p == '}') {
+                    ++m_p;
+                    return true;
+                }
+                while (true) {
+                    skipWhitespace();
+                    if (m_p == m_end || *m_p != '"') return fail("expected member name");
+                    out.object.emplace_back();
+                    if (!string(out.object.back().first)) return false;
+                    skipWhitespace();
+                    if (m_p == m_end || *m_p != ':') return fail("expected ':'");
+                    ++m_p;
+                    skipWhitespace();
+                    if (!value(out.object.back().second, depth + 1)) return false;
+                    skipWhitespace();
+                    if (m_p == m_end) return fail("unterminated object");
+                    if (*m_p == ',') {
+                        ++m_p;
+                        continue;
+                    }
+                    if (*m_p == '}') {
+                        ++m_p;
+                        return true;
+                    }
+                    return fail("expected ',' or '}'");
+                }
+            }
+
+            const char* m_p;
+            const char* m_end;
+            std::string m_error;
+        };
+
+        const SJsonValue s_null;
+
+    } // namespace
+
+    const SJsonValue& SJsonValue::operator[](std::string_view key) const {
+        if (!isObject()) return s_null;
+        for (const auto& [name, value] : object)
+            if (name == key) return value;
+        return s_null;
+    }
+
+    const SJsonValue& SJsonValue::operator[](std::size_t index) const {
+        return isArray() && index < array.size() ? array[index] : s_null;
+    }
+
+    bool parseJson(std::string_view text, SJsonValue& out, std::string& error) {
+        out = SJsonValue{};
+        return CJsonParser(text).parse(out, error);
+    }
+
+} // namespace Kinetica::IO::Detail
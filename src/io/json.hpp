@@ -0,0 +1,57 @@
+#ifndef KINETICA_IO_JSON_HPP
+#define KINETICA_IO_JSON_HPP
+
+// Minimal read-only JSON DOM for the glTF importer. Strings are decoded
+// (escapes, \u sequences to UTF-8); numbers are doubles.
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Kinetica::IO::Detail {
+
+    struct SJsonValue {
+        enum class EType : std::uint8_t { Null, Bool, Number, String, Array, Object };
+
+        EType type = EType::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<SJsonValue> array;
+        std::vector<std::pair<std::string, SJsonValue>> object;
+
+        bool isNull() const { return type == EType::Null; }
+        bool isNumber() const { return type == EType::Number; }
+        bool isString() const { return type == EType::String; }
+        bool isArray() const { return type == EType::Array; }
+        bool isObject() const { return type == EType::Object; }
+
+        // Member lookup; returns a shared null value when absent.
+        const SJsonValue& operator[](std::string_view key) const;
+        const SJsonValue& operator[](std::size_t index) const;
+        std::size_t size() const { return isArray() ? array.size() : object.size(); }
+
+        // Numbers are always finite (the parser rejects the rest); values
+        // outside the target type's range fall back instead of being cast.
+        double numberOr(double fallback) const { return isNumber() ? number : fallback; }
+        float floatOr(float fallback) const {
+            constexpr double limit = std::numeric_limits<float>::max();
+            return isNumber() && number >= -limit && number <= limit ? static_cast<float>(number) : fallback;
+        }
+        std::int64_t intOr(std::int64_t fallback) const {
+            // 2^63 is exactly representable; every double below it fits.
+            constexpr double limit = 9223372036854775808.0;
+            return isNumber() && number >= -limit && number < limit ? static_cast<std::int64_t>(number) : fallback;
+        }
+        std::string stringOr(std::string fallback) const { return isString() ? string : std::move(fallback); }
+    };
+
+    // Returns false (and a message in `error`) on malformed input.
+    bool parseJson(std::string_view text, SJsonValue& out, std::string& error);
+
+} // namespace Kinetica::IO::Detail
+
+#endif
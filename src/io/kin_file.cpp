@@ -0,0 +1,393 @@
+#include <kinetica/io/kin_file.hpp>
+#include <kinetica/ecs/transform_hierarchy.hpp>
+#include <kinetica/ecs/components/hierarchy.hpp>
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Kinetica::IO {
+
+    using Components::SIndex;
+    using Components::SMaterial;
+    using Components::SMesh;
+    using Components::STransform;
+    using Components::SVertex;
+
+    namespace {
+
+        bool inRange(std::uint64_t offset, std::uint64_t size, std::uint64_t limit) {
+            return offset <= limit && size <= limit - offset;
+        }
+
+        std::uint64_t alignUp(std::uint64_t value) {
+            return (value + KIN_PAYLOAD_ALIGNMENT - 1) & ~std::uint64_t(KIN_PAYLOAD_ALIGNMENT - 1);
+        }
+
+    } // namespace
+
+    // ---- CKinReader ----
+
+    bool CKinReader::open(const std::string& path) {
+        close();
+        if (!m_file.open(path)) return false;
+        if (!validate()) {
+            KLOG_ERROR("Not a valid .kin file: " + path);
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void CKinReader::close() {
+        m_file.close();
+        m_geometry = {};
+        m_entities = {};
+        m_transforms = {};
+        m_materials = {};
+        m_meshes = {};
+        m_strings = {};
+    }
+
+    template<typename T>
+    bool CKinReader::bindSection(const SKinSection& section, std::span<const T>& out) {
+        if (section.elementSize != sizeof(T) || section.size % sizeof(T) != 0) return false;
+        out = {reinterpret_cast<const T*>(m_file.data() + section.offset), section.size / sizeof(T)};
+        return true;
+    }
+
+    bool CKinReader::validate() {
+        const std::uint64_t size = m_file.size();
+        if (size < sizeof(SKinHeader)) return false;
+
+        SKinHeader header;
+        std::memcpy(&header, m_file.data(), sizeof(header));
+        if (header.magic != KIN_MAGIC || header.byteOrder != KIN_BYTE_ORDER) return false;
+        if (header.version > KIN_VERSION) {
+            KLOG_ERROR("Unsupported .kin version " + std::to_string(header.version));
+            return false;
+        }
+        if (header.fileSize != size) return false; // truncated or appended to
+        if (header.sectionTableOffset % alignof(SKinSection) != 0 ||
+            !inRange(header.sectionTableOffset, std::uint64_t(header.sectionCount) * sizeof(SKinSection), size))
+            return false;
+
+        const auto* sections = reinterpret_cast<const SKinSection*>(m_file.data() + header.sectionTableOffset);
+        for (std::uint32_t i = 0; i < header.sectionCount; ++i) {
+            const SKinSection& section = sections[i];
+            if (section.offset % KIN_PAYLOAD_ALIGNMENT != 0 || !inRange(section.offset, section.size, size))
+                return false;
+            bool ok = true;
+            switch (section.type) {
+                case EKinSection::Geometry:
+                    m_geometry = {m_file.data() + section.offset, section.size};
+                    break;
+                case EKinSection::Entities: ok = bindSection(section, m_entities); break;
+                case EKinSection::Transforms: ok = bindSection(section, m_transforms); break;
+                case EKinSection::Materials: ok = bindSection(section, m_materials); break;
+                case EKinSection::Meshes: ok = bindSection(section, m_meshes); break;
+                case EKinSection::Strings: ok = bindSection(section, m_strings); break;
+                default: break; // unknown sections from newer writers are skipped
+            }
+            if (!ok) return false;
+        }
+
+        // Cross-references are checked once here so accessors need not.
+        if (!m_transforms.empty() && m_transforms.size() != m_entities.size()) return false;
+        for (const SKinMesh& mesh : m_meshes) {
+            if (mesh.vertexOffset % KIN_PAYLOAD_ALIGNMENT != 0 || mesh.indexOffset % KIN_PAYLOAD_ALIGNMENT != 0 ||
+                !inRange(mesh.vertexOffset, std::uint64_t(mesh.vertexCount) * sizeof(SVertex), m_geometry.size()) ||
+                !inRange(mesh.indexOffset, std::uint64_t(mesh.triangleCount) * sizeof(SIndex), m_geometry.size()))
+                return false;
+        }
+        for (const SKinMaterial& material : m_materials) {
+            if (!inRange(material.nameOffset, material.nameLength, m_strings.size())) return false;
+        }
+        const std::size_t entityCount = m_entities.size();
+        for (const SKinEntity& entity : m_entities) {
+            if ((entity.components & KIN_COMPONENT_TRANSFORM) && m_transforms.empty()) return false;
+            if (entity.parent != KIN_NONE && entity.parent >= entityCount) return false;
+            if ((entity.components & KIN_COMPONENT_MESH) && entity.mesh >= m_meshes.size()) return false;
+            if ((entity.components & KIN_COMPONENT_MATERIAL) && entity.material >= m_materials.size()) return false;
+        }
+        return true;
+    }
+
+    SKinMeshView CKinReader::mesh(std::uint32_t index) const {
+        const SKinMesh& record = m_meshes[index];
+        SKinMeshView view;
+        view.vertices = {reinterpret_cast<const SVertex*>(m_geometry.data() + record.vertexOffset), record.vertexCount};
+        view.indices = {reinterpret_cast<const SIndex*>(m_geometry.data() + record.indexOffset), record.triangleCount};
+        view.bounds = {glm::vec3(record.boundsMin[0], record.boundsMin[1], record.boundsMin[2]),
+                       glm::vec3(record.boundsMax[0], record.boundsMax[1], record.boundsMax[2])};
+        return view;
+    }
+
+    SMaterial CKinReader::material(std::uint32_t index) const {
+        const SKinMaterial& record = m_materials[index];
+        SMaterial material;
+        material.baseColor = glm::vec3(record.baseColor[0], record.baseColor[1], record.baseColor[2]);
+        material.metallic = record.metallic;
+        material.roughness = record.roughness;
+        material.useVertexColor = record.useVertexColor != 0;
+        material.name.assign(m_strings.data() + record.nameOffset, record.nameLength);
+        return material;
+    }
+
+    std::vector<EntityID> CKinReader::instantiate(CRegistry& registry, CTransformHierarchy* hierarchy) const {
+        std::vector<EntityID> created;
+        created.reserve(m_entities.size());
+        registry.reserveEntities(m_entities.size());
+        std::size_t duplicates = 0;
+
+        for (std::size_t i = 0; i < m_entities.size(); ++i) {
+            const SKinEntity& record = m_entities[i];
+            std::array<std::uint8_t, 16> bytes;
+            std::memcpy(bytes.data(), record.uuid, bytes.size());
+            const CUUID uuid(bytes);
+            EntityID entity;
+            if (registry.findEntity(uuid).isValid()) {
+                entity = registry.createEntity(); // the file was loaded before: new identity
+                ++duplicates;
+            } else {
+                entity = registry.createEntity(uuid);
+            }
+            created.push_back(entity);
+
+            if (record.components & KIN_COMPONENT_TRANSFORM) {
+                STransform& transform = registry.addComponent<STransform>(entity);
+                std::memcpy(&transform.position, m_transforms[i].position, sizeof(m_transforms[i].position));
+                std::memcpy(&transform.rotation, m_transforms[i].rotation, sizeof(m_transforms[i].rotation));
+                std::memcpy(&transform.scale, m_transforms[i].scale, sizeof(m_transforms[i].scale));
+                transform.isDirty = true;
+            }
+            if (record.components & KIN_COMPONENT_MESH) {
+                const SKinMeshView view = mesh(record.mesh);
+                SMesh& target = registry.addComponent<SMesh>(entity);
+                target.vertices.assign(view.vertices.begin(), view.vertices.end());
+                target.indices.assign(view.indices.begin(), view.indices.end());
+                target.markReplaced();
+                // The copy touches every index anyway; reject ones that would
+                // read outside the vertex array.
+                const auto vertexCount = static_cast<std::uint32_t>(view.vertices.size());
+                const bool valid = std::all_of(view.indices.begin(), view.indices.end(), [&](const SIndex& t) {
+                    return t.a < vertexCount && t.b < vertexCount && t.c < vertexCount;
+                });
+                if (valid) {
+                    target.localBounds = view.bounds;
+                    target.boundsDirty = false;
+                } else {
+                    KLOG_WARN("Mesh " + std::to_string(record.mesh) + " has out-of-range indices, dropped");
+                    target.vertices.clear();
+                    target.indices.clear();
+                }
+            }
+            if (record.components & KIN_COMPONENT_MATERIAL) {
+                registry.addComponent<SMaterial>(entity) = material(record.material);
+            }
+        }
+
+        if (duplicates > 0)
+            KLOG_WARN(std::to_string(duplicates) + " entities were already in the scene and got new UUIDs");
+
+        if (hierarchy) {
+            for (std::size_t i = 0; i < m_entities.size(); ++i) {
+                const std::uint32_t parent = m_entities[i].parent;
+                if (parent != KIN_NONE && !hierarchy->setParent(created[i], created[parent]))
+                    KLOG_WARN("Invalid parent link in .kin file for entity " + std::to_string(i));
+            }
+        }
+        return created;
+    }
+
+    // ---- CKinWriter ----
+
+    CKinWriter::~CKinWriter() {
+        if (m_stream.is_open()) {
+            KLOG_WARN("CKinWriter destroyed without finish(), " + m_path + " is incomplete");
+            m_stream.close();
+        }
+    }
+
+    bool CKinWriter::open(const std::string& path) {
+        m_stream.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_stream.is_open()) {
+            KLOG_ERROR("Failed to open " + path + " for writing");
+            return false;
+        }
+        m_path = path;
+        m_bFailed = false;
+        m_entities.clear();
+        m_transforms.clear();
+        m_materials.clear();
+        m_meshes.clear();
+        m_strings.clear();
+        m_sections.clear();
+
+        // Placeholder with a zero magic; finish() writes the real header.
+        SKinHeader header;
+        header.magic = 0;
+        m_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_position = sizeof(header);
+        m_geometryBegin = alignUp(m_position);
+        return m_stream.good();
+    }
+
+    bool CKinWriter::writeAligned(const void* data, std::size_t size) {
+        static const char zeros[KIN_PAYLOAD_ALIGNMENT] = {};
+        const std::uint64_t aligned = alignUp(m_position);
+        m_stream.write(zeros, static_cast<std::streamsize>(aligned - m_position));
+        m_stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        m_position = aligned + size;
+        if (!m_stream.good()) m_bFailed = true;
+        return !m_bFailed;
+    }
+
+    std::uint32_t CKinWriter::addMesh(std::span<const SVertex> vertices, std::span<const SIndex> indices,
+                                      const Math::SAABB& bounds) {
+        if (!isOpen() || m_bFailed) return KIN_NONE;
+
+        SKinMesh record{};
+        record.vertexCount = static_cast<std::uint32_t>(vertices.size());
+        record.triangleCount = static_cast<std::uint32_t>(indices.size());
+        record.vertexOffset = alignUp(m_position) - m_geometryBegin;
+        writeAligned(vertices.data(), vertices.size_bytes());
+        record.indexOffset = alignUp(m_position) - m_geometryBegin;
+        writeAligned(indices.data(), indices.size_bytes());
+        if (m_bFailed) return KIN_NONE;
+
+        for (int axis = 0; axis < 3; ++axis) {
+            record.boundsMin[axis] = bounds.isEmpty() ? 0.0f : bounds.min[axis];
+            record.boundsMax[axis] = bounds.isEmpty() ? 0.0f : bounds.max[axis];
+        }
+        m_meshes.push_back(record);
+        return static_cast<std::uint32_t>(m_meshes.size() - 1);
+    }
+
+    std::uint32_t CKinWriter::addMaterial(const SMaterial& material) {
+        if (!isOpen()) return KIN_NONE;
+        SKinMaterial record{};
+        record.baseColor[0] = material.baseColor.x;
+        record.baseColor[1] = material.baseColor.y;
+        record.baseColor[2] = material.baseColor.z;
+        record.metallic = material.metallic;
+        record.roughness = material.roughness;
+        record.useVertexColor = material.useVertexColor ? 1u : 0u;
+        record.nameOffset = static_cast<std::uint32_t>(m_strings.size());
+        record.nameLength = static_cast<std::uint32_t>(material.name.size());
+        m_strings.insert(m_strings.end(), material.name.begin(), material.name.end());
+        m_materials.push_back(record);
+        return static_cast<std::uint32_t>(m_materials.size() - 1);
+    }
+
+    std::uint32_t CKinWriter::addEntity(const CUUID& uuid, const STransform* transform, std::uint32_t parent,
+                                        std::uint32_t mesh, std::uint32_t material) {
+        if (!isOpen()) return KIN_NONE;
+        SKinEntity record{};
+        std::memcpy(record.uuid, uuid.getBytes().data(), sizeof(record.uuid));
+        record.parent = parent;
+        record.mesh = mesh;
+        record.material = material;
+        if (transform) record.components |= KIN_COMPONENT_TRANSFORM;
+        if (mesh != KIN_NONE) record.components |= KIN_COMPONENT_MESH;
+        if (material != KIN_NONE) record.components |= KIN_COMPONENT_MATERIAL;
+
+        SKinTransform t{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+        if (transform) {
+            std::memcpy(t.position, &transform->position, sizeof(t.position));
+            std::memcpy(t.rotation, &transform->rotation, sizeof(t.rotation));
+            std::memcpy(t.scale, &transform->scale, sizeof(t.scale));
+        }
+        m_entities.push_back(record);
+        m_transforms.push_back(t);
+        return static_cast<std::uint32_t>(m_entities.size() - 1);
+    }
+
+    template<typename T>
+    void CKinWriter::writeSection(EKinSection type, const std::vector<T>& records) {
+        const std::uint64_t offset = alignUp(m_position);
+        writeAligned(records.data(), records.size() * sizeof(T));
+        m_sections.push_back({type, static_cast<std::uint32_t>(sizeof(T)), offset, records.size() * sizeof(T)});
+    }
+
+    bool CKinWriter::finish() {
+        if (!isOpen()) return false;
+
+        for (const SKinEntity& entity : m_entities) {
+            if (entity.parent != KIN_NONE && entity.parent >= m_entities.size()) {
+                KLOG_ERROR("Entity parent index out of range while writing " + m_path);
+                m_bFailed = true;
+            }
+        }
+
+        m_sections.push_back({EKinSection::Geometry, 1, m_geometryBegin, m_position - std::min(m_position, m_geometryBegin)});
+        writeSection(EKinSection::Entities, m_entities);
+        writeSection(EKinSection::Transforms, m_transforms);
+        writeSection(EKinSection::Materials, m_materials);
+        writeSection(EKinSection::Meshes, m_meshes);
+        writeSection(EKinSection::Strings, m_strings);
+
+        SKinHeader header;
+        header.sectionCount = static_cast<std::uint32_t>(m_sections.size());
+        header.sectionTableOffset = alignUp(m_position);
+        writeAligned(m_sections.data(), m_sections.size() * sizeof(SKinSection));
+        header.fileSize = m_position;
+
+        m_stream.seekp(0);
+        m_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_stream.close();
+        if (!m_stream || m_bFailed) {
+            KLOG_ERROR("Failed to write " + m_path);
+            return false;
+        }
+        return true;
+    }
+
+    // ---- Scenes ----
+
+    bool saveScene(CRegistry& registry, const std::string& path) {
+        CKinWriter writer;
+        if (!writer.open(path)) return false;
+
+        const std::vector<EntityID> entities = registry.getAllEntities();
+        std::vector<std::uint32_t> fileIndex;
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            if (entities[i].index >= fileIndex.size()) fileIndex.resize(entities[i].index + 1, KIN_NONE);
+            fileIndex[entities[i].index] = static_cast<std::uint32_t>(i);
+        }
+
+        for (EntityID entity : entities) {
+            std::uint32_t mesh = KIN_NONE;
+            if (const SMesh* m = registry.getComponent<SMesh>(entity)) {
+                Math::SAABB bounds = m->localBounds;
+                if (m->boundsDirty) {
+                    bounds = Math::SAABB{};
+                    for (const SVertex& v : m->vertices) bounds.expand(glm::vec3(v.x, v.y, v.z));
+                }
+                mesh = writer.addMesh(m->vertices, m->indices, bounds);
+                if (mesh == KIN_NONE) break;
+            }
+
+            std::uint32_t material = KIN_NONE;
+            if (const SMaterial* m = registry.getComponent<SMaterial>(entity)) material = writer.addMaterial(*m);
+
+            std::uint32_t parent = KIN_NONE;
+            const auto* node = registry.getComponent<Components::SHierarchy>(entity);
+            if (node && registry.isAlive(node->parent) && node->parent.index < fileIndex.size())
+                parent = fileIndex[node->parent.index];
+
+            writer.addEntity(registry.getUUID(entity), registry.getComponent<STransform>(entity), parent, mesh,
+                             material);
+        }
+        return writer.finish();
+    }
+
+    bool loadScene(const std::string& path, CRegistry& registry, CTransformHierarchy* hierarchy) {
+        CKinReader reader;
+        if (!reader.open(path)) return false;
+        const std::vector<EntityID> entities = reader.instantiate(registry, hierarchy);
+        KLOG_INFO("Loaded " + std::to_string(entities.size()) + " entities from " + path);
+        return true;
+    }
+
+} // namespace Kinetica::IO
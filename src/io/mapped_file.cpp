@@ -0,0 +1,126 @@
+#include <kinetica/io/mapped_file.hpp>
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Kinetica::IO {
+
+    CMappedFile::~CMappedFile() { close(); }
+
+    CMappedFile::CMappedFile(CMappedFile&& other) noexcept { *this = std::move(other); }
+
+    CMappedFile& CMappedFile::operator=(CMappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+#ifdef _WIN32
+            m_file = std::exchange(other.m_file, nullptr);
+            m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+#ifdef _WIN32
+
+    bool CMappedFile::open(const std::string& path) {
+        close();
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            KLOG_ERROR("Failed to open " + path);
+            return false;
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+            KLOG_ERROR("Cannot map empty or unreadable file " + path);
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            KLOG_ERROR("Failed to map " + path);
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+        m_file = file;
+        m_mapping = mapping;
+        m_data = static_cast<const std::uint8_t*>(view);
+        m_size = static_cast<std::size_t>(size.QuadPart);
+        return true;
+    }
+
+    void CMappedFile::close() {
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_mapping) CloseHandle(m_mapping);
+        if (m_file) CloseHandle(m_file);
+        m_data = nullptr;
+        m_size = 0;
+        m_file = m_mapping = nullptr;
+    }
+
+    void CMappedFile::prefetch(std::size_t offset, std::size_t size) const {
+        if (!m_data || offset >= m_size) return;
+        WIN32_MEMORY_RANGE_ENTRY range{const_cast<std::uint8_t*>(m_data) + offset, std::min(size, m_size - offset)};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+
+#else
+
+    bool CMappedFile::open(const std::string& path) {
+        close();
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            KLOG_ERROR("Failed to open " + path);
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size == 0) {
+            KLOG_ERROR("Cannot map empty or unreadable file " + path);
+            ::close(fd);
+            return false;
+        }
+        void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping keeps the file alive
+        if (view == MAP_FAILED) {
+            KLOG_ERROR("Failed to map " + path);
+            return false;
+        }
+        m_data = static_cast<const std::uint8_t*>(view);
+        m_size = static_cast<std::size_t>(info.st_size);
+        return true;
+    }
+
+    void CMappedFile::close() {
+        if (m_data) munmap(const_cast<std::uint8_t*>(m_data), m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    void CMappedFile::prefetch(std::size_t offset, std::size_t size) const {
+        if (!m_data || offset >= m_size) return;
+        // madvise wants a page-aligned start.
+        const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        const std::size_t begin = offset & ~(page - 1);
+        const std::size_t end = std::min(m_size, offset + size);
+        madvise(const_cast<std::uint8_t*>(m_data) + begin, end - begin, MADV_WILLNEED);
+    }
+
+#endif
+
+} // namespace Kinetica::IO
@@ -0,0 +1,527 @@
+#include "import_detail.hpp"
+
+#include <kinetica/io/mapped_file.hpp>
+#include <kinetica/log.hpp>
+#include <kinetica/profiler.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <string_view>
+#include <unordered_map>
+
+namespace Kinetica::IO {
+
+    using Components::SIndex;
+    using Components::SMaterial;
+    using Components::SMesh;
+    using Components::SVertex;
+
+    namespace {
+
+        constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+        constexpr std::int32_t ABSENT = -1;
+
+        std::uint64_t hashInts(std::int32_t a, std::int32_t b, std::int32_t c, std::uint32_t d) {
+            std::uint64_t h = static_cast<std::uint32_t>(a) * 0x9E3779B97F4A7C15ull;
+            h ^= (static_cast<std::uint64_t>(static_cast<std::uint32_t>(b)) << 32 | static_cast<std::uint32_t>(c)) *
+                 0xC2B2AE3D27D4EB4Full;
+            h ^= d;
+            h ^= h >> 31;
+            h *= 0x94D049BB133111EBull;
+            return h ^ (h >> 29);
+        }
+
+        // A face corner as written, before chunk bases are known. Negative OBJ
+        // indices count back from the current end and are stored relative to
+        // the chunk; `relative` has bit 0/1/2 set for v/t/n.
+        struct SRawCorner {
+            std::int32_t v, t, n;
+            std::uint32_t relative;
+
+            bool operator==(const SRawCorner&) const = default;
+            std::uint64_t hash() const { return hashInts(v, t, n, relative); }
+        };
+
+        // Resolved (position, uv, normal) indices; ABSENT for missing ones.
+        struct SCornerKey {
+            std::int32_t v, t, n;
+
+            bool operator==(const SCornerKey&) const = default;
+            std::uint64_t hash() const { return hashInts(v, t, n, 0); }
+        };
+
+        // Open-addressed set of keys stored densely in `keys`; a key's id is
+        // its position there.
+        template<typename Key>
+        class CDedupTable {
+        public:
+            std::uint32_t insert(const Key& key, std::vector<Key>& keys) {
+                if ((keys.size() + 1) * 2 > m_slots.size()) grow(keys);
+                std::size_t slot = key.hash() & m_mask;
+                while (true) {
+                    const std::uint32_t id = m_slots[slot];
+                    if (id == NONE) {
+                        m_slots[slot] = static_cast<std::uint32_t>(keys.size());
+                        keys.push_back(key);
+                        return m_slots[slot];
+                    }
+                    if (keys[id] == key) return id;
+                    slot = (slot + 1) & m_mask;
+                }
+            }
+
+        private:
+            void grow(const std::vector<Key>& keys) {
+                const std::size_t size = std::max<std::size_t>(1024, m_slots.size() * 2);
+                m_slots.assign(size, NONE);
+                m_mask = size - 1;
+                for (std::uint32_t id = 0; id < keys.size(); ++id) {
+                    std::size_t slot = keys[id].hash() & m_mask;
+                    while (m_slots[slot] != NONE) slot = (slot + 1) & m_mask;
+                    m_slots[slot] = id;
+                }
+            }
+
+            std::vector<std::uint32_t> m_slots;
+            std::size_t m_mask = 0;
+        };
+
+        // Name or material switch at a triangle position within a chunk.
+        struct SGroupSwitch {
+            std::uint32_t firstTriangle;
+            bool isMaterial;
+            std::string value;
+        };
+
+        struct SChunk {
+            const char* begin = nullptr;
+            const char* end = nullptr;
+
+            std::vector<float> positions; // xyz
+            std::vector<float> uvs;       // uv
+            std::vector<float> normals;   // xyz
+            std::vector<SRawCorner> corners; // unique within the chunk
+            std::vector<std::uint32_t> triangles; // 3 corner ids each
+            std::vector<SGroupSwitch> switches;
+            std::vector<std::string> libraries;
+            std::size_t badFaces = 0;
+        };
+
+        // ---- Line-level parsing ----
+
+        const char* skipBlank(const char* p, const char* end) {
+            while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+            return p;
+        }
+
+        bool parseFloat(const char*& p, const char* end, float& out) {
+            p = skipBlank(p, end);
+            if (p < end && *p == '+') ++p; // from_chars rejects an explicit plus
+            const auto [next, ec] = std::from_chars(p, end, out);
+            if (ec != std::errc() || next == p) return false;
+            p = next;
+            return true;
+        }
+
+        std::string_view restOfLine(const char* p, const char* end) {
+            p = skipBlank(p, end);
+            while (end > p && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) --end;
+            return {p, std::size_t(end - p)};
+        }
+
+        bool startsWithKeyword(const char* p, const char* end, std::string_view keyword) {
+            return std::size_t(end - p) > keyword.size() && std::string_view(p, keyword.size()) == keyword &&
+                   (p[keyword.size()] == ' ' || p[keyword.size()] == '\t');
+        }
+
+        // One index of a face corner; `count` is the chunk-local element count
+        // for resolving negative indices.
+        bool parseIndex(const char*& p, const char* end, std::size_t count, std::int32_t& out, bool& relative) {
+            std::int64_t value;
+            const auto [next, ec] = std::from_chars(p, end, value);
+            if (ec != std::errc() || next == p || value == 0) return false;
+            p = next;
+            if (value > 0) {
+                if (value > INT32_MAX) return false;
+                out = static_cast<std::int32_t>(value - 1);
+                relative = false;
+            } else {
+                out = static_cast<std::int32_t>(std::int64_t(count) + value); // may be negative: an earlier chunk
+                relative = true;
+            }
+            return true;
+        }
+
+        void parseFace(SChunk& chunk, CDedupTable<SRawCorner>& table, std::vector<std::uint32_t>& polygon,
+                       const char* p, const char* end) {
+            polygon.clear();
+            while (true) {
+                p = skipBlank(p, end);
+                if (p >= end) break;
+
+                SRawCorner corner{ABSENT, ABSENT, ABSENT, 0};
+                bool relative;
+                if (!parseIndex(p, end, chunk.positions.size() / 3, corner.v, relative)) {
+                    ++chunk.badFaces;
+                    return;
+                }
+                corner.relative |= relative ? 1u : 0u;
+                if (p < end && *p == '/') {
+                    ++p;
+                    if (p < end && *p != '/') {
+                        if (!parseIndex(p, end, chunk.uvs.size() / 2, corner.t, relative)) {
+                            ++chunk.badFaces;
+                            return;
+                        }
+                        corner.relative |= relative ? 2u : 0u;
+                    }
+                    if (p < end && *p == '/') {
+                        ++p;
+                        if (!parseIndex(p, end, chunk.normals.size() / 3, corner.n, relative)) {
+                            ++chunk.badFaces;
+                            return;
+                        }
+                        corner.relative |= relative ? 4u : 0u;
+                    }
+                }
+                polygon.push_back(table.insert(corner, chunk.corners));
+            }
+            if (polygon.size() < 3) {
+                ++chunk.badFaces;
+                return;
+            }
+            for (std::size_t i = 2; i < polygon.size(); ++i) {
+                chunk.triangles.push_back(polygon[0]);
+                chunk.triangles.push_back(polygon[i - 1]);
+                chunk.triangles.push_back(polygon[i]);
+            }
+        }
+
+        void parseChunk(SChunk& chunk) {
+            CDedupTable<SRawCorner> table;
+            std::vector<std::uint32_t> polygon;
+
+            const char* p = chunk.begin;
+            while (p < chunk.end) {
+                const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', std::size_t(chunk.end - p)));
+                if (!lineEnd) lineEnd = chunk.end;
+                const char* line = skipBlank(p, lineEnd);
+                p = lineEnd + 1;
+                if (line >= lineEnd) continue;
+
+                const auto triangle = static_cast<std::uint32_t>(chunk.triangles.size() / 3);
+                switch (line[0]) {
+                    case 'v': {
+                        if (lineEnd - line < 2) break;
+                        const char kind = line[1];
+                        const char* q = line + 2;
+                        float values[3] = {0.0f, 0.0f, 0.0f};
+                        if (kind == ' ' || kind == '\t') {
+                            q = line + 1;
+                            for (float& value : values) parseFloat(q, lineEnd, value);
+                            chunk.positions.insert(chunk.positions.end(), values, values + 3);
+                        } else if (kind == 't') {
+                            parseFloat(q, lineEnd, values[0]);
+                            parseFloat(q, lineEnd, values[1]);
+                            chunk.uvs.insert(chunk.uvs.end(), values, values + 2);
+                        } else if (kind == 'n') {
+                            for (float& value : values) parseFloat(q, lineEnd, value);
+                            chunk.normals.insert(chunk.normals.end(), values, values + 3);
+                        }
+                        break;
+                    }
+                    case 'f':
+                        if (lineEnd - line > 1 && (line[1] == ' ' || line[1] == '\t'))
+                            parseFace(chunk, table, polygon, line + 2, lineEnd);
+                        break;
+                    case 'o':
+                    case 'g':
+                        if (lineEnd - line > 1 && (line[1] == ' ' || line[1] == '\t'))
+                            chunk.switches.push_back({triangle, false, std::string(restOfLine(line + 2, lineEnd))});
+                        break;
+                    case 'u':
+                        if (startsWithKeyword(line, lineEnd, "usemtl"))
+                            chunk.switches.push_back({triangle, true, std::string(restOfLine(line + 7, lineEnd))});
+                        break;
+                    case 'm':
+                        if (startsWithKeyword(line, lineEnd, "mtllib"))
+                            chunk.libraries.emplace_back(restOfLine(line + 7, lineEnd));
+                        break;
+                    default: break; // comments, s, l, p, ...
+                }
+            }
+        }
+
+        // ---- MTL ----
+
+        void parseMaterialLibrary(const std::filesystem::path& path, std::vector<SMaterial>& materials,
+                                  std::unordered_map<std::string, std::uint32_t>& byName) {
+            CMappedFile file;
+            if (!file.open(path.string())) {
+                KLOG_WARN("Missing material library " + path.string());
+                return;
+            }
+            const char* p = reinterpret_cast<const char*>(file.data());
+            const char* end = p + file.size();
+            SMaterial* current = nullptr;
+            while (p < end) {
+                const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', std::size_t(end - p)));
+                if (!lineEnd) lineEnd = end;
+                const char* line = skipBlank(p, lineEnd);
+                p = lineEnd + 1;
+
+                if (startsWithKeyword(line, lineEnd, "newmtl")) {
+                    const std::string name(restOfLine(line + 6, lineEnd));
+                    auto [it, inserted] = byName.try_emplace(name, static_cast<std::uint32_t>(materials.size()));
+                    if (inserted) {
+                        materials.emplace_back();
+                        materials.back().name = name;
+                    }
+                    current = &materials[it->second];
+                } else if (!current) {
+                    continue;
+                } else if (startsWithKeyword(line, lineEnd, "Kd")) {
+                    const char* q = line + 2;
+                    for (int i = 0; i < 3; ++i) parseFloat(q, lineEnd, current->baseColor[i]);
+                } else if (startsWithKeyword(line, lineEnd, "Ns")) {
+                    // Blinn-Phong exponent to roughness.
+                    const char* q = line + 2;
+                    float shininess;
+                    if (parseFloat(q, lineEnd, shininess))
+                        current->roughness = std::sqrt(2.0f / (std::max(shininess, 0.0f) + 2.0f));
+                } else if (startsWithKeyword(line, lineEnd, "Pr")) {
+                    const char* q = line + 2;
+                    parseFloat(q, lineEnd, current->roughness);
+                } else if (startsWithKeyword(line, lineEnd, "Pm")) {
+                    const char* q = line + 2;
+                    parseFloat(q, lineEnd, current->metallic);
+                }
+            }
+        }
+
+        // ---- Assembly ----
+
+        // A triangle range of one chunk going to one output mesh.
+        struct SRun {
+            std::uint32_t chunk;
+            std::uint32_t begin, end; // triangles
+        };
+
+        struct SOutputMesh {
+            std::string name;
+            std::uint32_t material;
+            std::vector<SRun> runs;
+        };
+
+    } // namespace
+
+    bool importObj(const std::string& path, SImportResult& out, const SImportOptions& options) {
+        KPROFILE_SCOPE("OBJ import");
+        CMappedFile file;
+        if (!file.open(path)) return false;
+
+        const char* data = reinterpret_cast<const char*>(file.data());
+        const char* dataEnd = data + file.size();
+
+        // Line-aligned chunks.
+        std::vector<SChunk> chunks;
+        const std::size_t chunkBytes = std::max<std::size_t>(options.chunkBytes, 4096);
+        for (const char* p = data; p < dataEnd;) {
+            const char* end = p + std::min<std::size_t>(chunkBytes, std::size_t(dataEnd - p));
+            if (end < dataEnd) {
+                const char* newline = static_cast<const char*>(std::memchr(end, '\n', std::size_t(dataEnd - end)));
+                end = newline ? newline + 1 : dataEnd;
+            }
+            chunks.emplace_back();
+            chunks.back().begin = p;
+            chunks.back().end = end;
+            p = end;
+        }
+
+        std::vector<SOutputMesh> meshes;
+        bool ok = true;
+        Detail::withPool(options, [&](CThreadPool& pool) {
+            pool.parallelFor(chunks.size(), 1, [&](std::size_t begin, std::size_t end) {
+                KPROFILE_SCOPE("OBJ parse");
+                for (std::size_t c = begin; c < end; ++c) parseChunk(chunks[c]);
+            });
+
+            // Chunk bases, then one flat array per attribute.
+            std::vector<std::int64_t> positionBase(chunks.size()), uvBase(chunks.size()), normalBase(chunks.size());
+            std::int64_t positionCount = 0, uvCount = 0, normalCount = 0;
+            std::size_t badFaces = 0;
+            for (std::size_t c = 0; c < chunks.size(); ++c) {
+                positionBase[c] = positionCount;
+                uvBase[c] = uvCount;
+                normalBase[c] = normalCount;
+                positionCount += std::int64_t(chunks[c].positions.size() / 3);
+                uvCount += std::int64_t(chunks[c].uvs.size() / 2);
+                normalCount += std::int64_t(chunks[c].normals.size() / 3);
+                badFaces += chunks[c].badFaces;
+            }
+            if (positionCount > INT32_MAX || uvCount > INT32_MAX || normalCount > INT32_MAX) {
+                KLOG_ERROR("OBJ file " + path + " has too many vertices");
+                ok = false;
+                return;
+            }
+            if (badFaces > 0) KLOG_WARN(std::to_string(badFaces) + " malformed faces skipped in " + path);
+
+            std::vector<float> positions(std::size_t(positionCount) * 3);
+            std::vector<float> uvs(std::size_t(uvCount) * 2);
+            std::vector<float> normals(std::size_t(normalCount) * 3);
+            pool.parallelFor(chunks.size(), 1, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t c = begin; c < end; ++c) {
+                    SChunk& chunk = chunks[c];
+                    std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + positionBase[c] * 3);
+                    std::copy(chunk.uvs.begin(), chunk.uvs.end(), uvs.begin() + uvBase[c] * 2);
+                    std::copy(chunk.normals.begin(), chunk.normals.end(), normals.begin() + normalBase[c] * 3);
+                    chunk.positions = {};
+                    chunk.uvs = {};
+                    chunk.normals = {};
+                }
+            });
+
+            // Materials.
+            std::unordered_map<std::string, std::uint32_t> materialByName;
+            const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+            for (const SChunk& chunk : chunks)
+                for (const std::string& library : chunk.libraries)
+                    parseMaterialLibrary(directory / library, out.materials, materialByName);
+            auto materialIndex = [&](const std::string& name) {
+                auto [it, inserted] = materialByName.try_emplace(name, static_cast<std::uint32_t>(out.materials.size()));
+                if (inserted) {
+                    out.materials.emplace_back();
+                    if (!name.empty()) out.materials.back().name = name;
+                }
+                return it->second;
+            };
+
+            // One output mesh per (name, material) pair, in first-use order.
+            std::unordered_map<std::string, std::uint32_t> meshByKey;
+            std::string name = std::filesystem::path(path).stem().string();
+            std::string material;
+            std::uint32_t current = NONE;
+            auto select = [&] {
+                auto [it, inserted] = meshByKey.try_emplace(name + '\0' + material, static_cast<std::uint32_t>(meshes.size()));
+                if (inserted) meshes.push_back({name, materialIndex(material), {}});
+                current = it->second;
+            };
+            for (std::uint32_t c = 0; c < chunks.size(); ++c) {
+                const SChunk& chunk = chunks[c];
+                const auto triangles = static_cast<std::uint32_t>(chunk.triangles.size() / 3);
+                std::uint32_t begin = 0;
+                auto flush = [&](std::uint32_t end) {
+                    if (end <= begin) return;
+                    if (current == NONE) select();
+                    std::vector<SRun>& runs = meshes[current].runs;
+                    if (!runs.empty() && runs.back().chunk == c && runs.back().end == begin) runs.back().end = end;
+                    else runs.push_back({c, begin, end});
+                    begin = end;
+                };
+                for (const SGroupSwitch& s : chunk.switches) {
+                    flush(s.firstTriangle);
+                    (s.isMaterial ? material : name) = s.value;
+                    current = NONE;
+                }
+                flush(triangles);
+            }
+
+            // Resolve corners and weld across chunks, one task per mesh.
+            out.objects.resize(meshes.size());
+            pool.parallelFor(meshes.size(), 1, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t m = begin; m < end; ++m) {
+                    const SOutputMesh& source = meshes[m];
+                    SImportedObject& object = out.objects[m];
+                    object.name = source.name;
+                    object.material = source.material;
+                    object.hasMesh = true;
+                    SMesh& mesh = object.mesh;
+
+                    CDedupTable<SCornerKey> table;
+                    std::vector<SCornerKey> keys;
+                    std::vector<std::uint32_t> localToMesh;
+                    std::uint32_t localChunk = NONE;
+                    std::size_t dropped = 0;
+
+                    for (const SRun& run : source.runs) {
+                        const SChunk& chunk = chunks[run.chunk];
+                        if (run.chunk != localChunk) {
+                            localToMesh.assign(chunk.corners.size(), NONE);
+                            localChunk = run.chunk;
+                        }
+                        auto resolve = [&](std::uint32_t local, SCornerKey& key) {
+                            const SRawCorner& raw = chunk.corners[local];
+                            key = {raw.v, raw.t, raw.n};
+                            if (raw.relative & 1u) key.v = static_cast<std::int32_t>(positionBase[run.chunk] + raw.v);
+                            if (raw.relative & 2u) key.t = static_cast<std::int32_t>(uvBase[run.chunk] + raw.t);
+                            if (raw.relative & 4u) key.n = static_cast<std::int32_t>(normalBase[run.chunk] + raw.n);
+                            if (key.t < 0 || key.t >= uvCount) key.t = ABSENT;
+                            if (key.n < 0 || key.n >= normalCount) key.n = ABSENT;
+                            return key.v >= 0 && key.v < positionCount;
+                        };
+                        for (std::uint32_t t = run.begin; t < run.end; ++t) {
+                            // Validate all three corners before adding any, so
+                            // dropped faces leave no unreferenced vertices.
+                            const std::uint32_t* corners = &chunk.triangles[std::size_t(t) * 3];
+                            SCornerKey keysOfFace[3];
+                            bool valid = true;
+                            for (int i = 0; i < 3; ++i)
+                                valid = valid && (localToMesh[corners[i]] != NONE || resolve(corners[i], keysOfFace[i]));
+                            if (!valid) {
+                                ++dropped;
+                                continue;
+                            }
+                            std::uint32_t ids[3];
+                            for (int i = 0; i < 3; ++i) {
+                                std::uint32_t& cached = localToMesh[corners[i]];
+                                if (cached == NONE) cached = table.insert(keysOfFace[i], keys);
+                                ids[i] = cached;
+                            }
+                            mesh.indices.push_back({ids[0], ids[1], ids[2]});
+                        }
+                    }
+                    if (dropped > 0)
+                        KLOG_WARN(std::to_string(dropped) + " faces with out-of-range indices dropped from " + source.name);
+
+                    mesh.vertices.resize(keys.size());
+                    std::vector<std::uint8_t> missingNormals;
+                    for (std::size_t i = 0; i < keys.size(); ++i) {
+                        const SCornerKey& key = keys[i];
+                        SVertex& v = mesh.vertices[i];
+                        const float* position = &positions[std::size_t(key.v) * 3];
+                        v = {position[0], position[1], position[2], 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+                        if (key.t != ABSENT) {
+                            v.u = uvs[std::size_t(key.t) * 2];
+                            v.v = uvs[std::size_t(key.t) * 2 + 1];
+                        }
+                        if (key.n != ABSENT) {
+                            const float* normal = &normals[std::size_t(key.n) * 3];
+                            v.nx = normal[0];
+                            v.ny = normal[1];
+                            v.nz = normal[2];
+                        } else {
+                            if (missingNormals.empty()) missingNormals.assign(keys.size(), 0);
+                            missingNormals[i] = 1;
+                        }
+                    }
+                    if (!missingNormals.empty()) Detail::generateNormals(mesh, missingNormals);
+                    mesh.updateBounds();
+                    mesh.markReplaced();
+                    mesh.boundsDirty = false;
+                }
+            });
+        });
+        if (!ok) {
+            out.objects.clear();
+            return false;
+        }
+
+        // Drop groups that ended up without triangles (e.g. only bad faces).
+        std::erase_if(out.objects, [](const SImportedObject& object) { return object.mesh.indices.empty(); });
+        return true;
+    }
+
+} // namespace Kinetica::IO
@@ -0,0 +1,406 @@
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Kinetica::Log {
+
+    namespace {
+
+        constexpr std::size_t RING_BYTES = std::size_t(64) << 10; // per thread, power of two
+        constexpr std::uint16_t MAX_MESSAGE = 4000;               // longer messages are truncated
+        constexpr std::uint16_t WRAP = 0xFFFF;                    // length marking a skip to the start
+
+        std::uint64_t now() {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // Fixed part of a ring entry; the message bytes follow, padded to 8.
+        struct SRecordHeader {
+            const char* file;
+            std::uint64_t time; // steady clock, ns
+            std::uint32_t line;
+            std::uint16_t length;
+            ELogLevel level;
+        };
+        static_assert(sizeof(SRecordHeader) % 8 == 0);
+
+        std::size_t recordSize(std::size_t length) { return (sizeof(SRecordHeader) + length + 7) & ~std::size_t(7); }
+
+        // Single producer (the owning thread), single consumer (the logger
+        // thread). Positions count bytes and never wrap.
+        struct SRing {
+            alignas(64) std::atomic<std::uint64_t> head{0};
+            alignas(64) std::atomic<std::uint64_t> tail{0};
+            alignas(64) std::atomic<bool> closed{false}; // owning thread exited
+            std::atomic<bool> wakePending{false};        // producer asked for an early drain
+            std::unique_ptr<unsigned char[]> bytes{new unsigned char[RING_BYTES]};
+        };
+
+        struct SEntry {
+            SRecordHeader header;
+            std::string text;
+        };
+
+        const char* levelColor(ELogLevel level) {
+            switch (level) {
+                case ELogLevel::Debug: return Color::debug;
+                case ELogLevel::Info: return Color::info;
+                case ELogLevel::Warn: return Color::warn;
+                default: return Color::error;
+            }
+        }
+
+        bool isTerminal(std::FILE* file) {
+#ifdef _WIN32
+            return _isatty(_fileno(file)) != 0;
+#else
+            return isatty(fileno(file)) != 0;
+#endif
+        }
+
+        class CLogger {
+        public:
+            CLogger() : m_wallStart(std::chrono::system_clock::now()), m_steadyStart(now()) {
+                setOutput(stdout);
+                m_thread = std::thread([this] { run(); });
+                std::atexit([] { shutdown(); });
+            }
+
+            std::atomic<bool> async{true};
+            std::atomic<std::uint64_t> dropped{0};
+            std::atomic<std::uint64_t> blocked{0};
+            std::atomic<std::uint64_t> written{0};
+
+            SRing* registerThread() {
+                std::lock_guard<std::mutex> lock(m_ringsMutex);
+                m_rings.push_back(std::make_unique<SRing>());
+                return m_rings.back().get();
+            }
+
+            void wake() {
+                {
+                    std::lock_guard<std::mutex> lock(m_wakeMutex);
+                    m_wakeRequested = true;
+                }
+                m_wakeCondition.notify_one();
+            }
+
+            void flush() {
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+                const std::uint64_t ticket = ++m_flushRequested;
+                m_wakeRequested = true;
+                m_wakeCondition.notify_one();
+                m_flushedCondition.wait(lock, [&] { return m_flushDone >= ticket || !m_running; });
+            }
+
+            void stop() {
+                {
+                    std::lock_guard<std::mutex> lock(m_wakeMutex);
+                    if (!m_running) return;
+                    m_stopRequested = true;
+                    m_wakeRequested = true;
+                }
+                m_wakeCondition.notify_one();
+                m_thread.join();
+            }
+
+            void setOutput(std::FILE* file) {
+                std::lock_guard<std::mutex> lock(m_outputMutex);
+                m_output = file;
+                m_color = isTerminal(file);
+            }
+
+            // Formats and writes one record on the calling thread.
+            void writeNow(const SRecordHeader& header, std::string_view text) {
+                std::lock_guard<std::mutex> lock(m_outputMutex);
+                m_buffer.clear();
+                format(header, text);
+                output();
+            }
+
+        private:
+            void run() {
+                auto idle = std::chrono::milliseconds(1);
+                while (true) {
+                    std::uint64_t flushTicket;
+                    bool stopping;
+                    {
+                        std::lock_guard<std::mutex> lock(m_wakeMutex);
+                        flushTicket = m_flushRequested;
+                        stopping = m_stopRequested;
+                        m_wakeRequested = false;
+                    }
+                    const std::size_t count = drain();
+                    {
+                        std::lock_guard<std::mutex> lock(m_wakeMutex);
+                        m_flushDone = flushTicket;
+                        if (stopping) m_running = false;
+                    }
+                    m_flushedCondition.notify_all();
+                    if (stopping) return;
+
+                    // Producers never signal on the fast path, so poll, backing
+                    // off while there is nothing to do.
+                    idle = count > 0 ? std::chrono::milliseconds(1) : std::min(idle * 2, std::chrono::milliseconds(50));
+                    std::unique_lock<std::mutex> lock(m_wakeMutex);
+                    m_wakeCondition.wait_for(lock, idle, [&] { return m_wakeRequested; });
+                }
+            }
+
+            std::size_t drain() {
+                std::vector<SRing*> rings;
+                {
+                    std::lock_guard<std::mutex> lock(m_ringsMutex);
+                    for (const auto& ring : m_rings) rings.push_back(ring.get());
+                }
+
+                m_entries.clear();
+                bool anyClosed = false;
+                for (SRing* ring : rings) {
+                    const bool closed = ring->closed.load(std::memory_order_acquire);
+                    anyClosed = anyClosed || closed;
+                    const std::uint64_t head = ring->head.load(std::memory_order_acquire);
+                    std::uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+                    while (tail < head) {
+                        const std::size_t offset = tail & (RING_BYTES - 1);
+                        if (RING_BYTES - offset < sizeof(SRecordHeader)) {
+                            tail += RING_BYTES - offset;
+                            continue;
+                        }
+                        SEntry entry;
+                        std::memcpy(&entry.header, ring->bytes.get() + offset, sizeof(SRecordHeader));
+                        if (entry.header.length == WRAP) {
+                            tail += RING_BYTES - offset;
+                            continue;
+                        }
+                        entry.text.assign(reinterpret_cast<const char*>(ring->bytes.get() + offset + sizeof(SRecordHeader)),
+                                          entry.header.length);
+                        tail += recordSize(entry.header.length);
+                        m_entries.push_back(std::move(entry));
+                    }
+                    ring->tail.store(tail, std::memory_order_release);
+                    ring->wakePending.store(false, std::memory_order_relaxed);
+                }
+                if (anyClosed) {
+                    // Everything a closed ring will ever hold was drained above.
+                    std::lock_guard<std::mutex> lock(m_ringsMutex);
+                    std::erase_if(m_rings, [](const std::unique_ptr<SRing>& ring) {
+                        return ring->closed.load(std::memory_order_acquire) &&
+                               ring->tail.load(std::memory_order_relaxed) == ring->head.load(std::memory_order_acquire);
+                    });
+                }
+
+                const std::uint64_t lost = dropped.load(std::memory_order_relaxed);
+                if (m_entries.empty() && lost == m_droppedReported) return 0;
+
+                // Threads interleave by timestamp.
+                std::stable_sort(m_entries.begin(), m_entries.end(), [](const SEntry& a, const SEntry& b) {
+                    return a.header.time < b.header.time;
+                });
+                std::lock_guard<std::mutex> lock(m_outputMutex);
+                m_buffer.clear();
+                for (const SEntry& entry : m_entries) format(entry.header, entry.text);
+                if (lost != m_droppedReported) {
+                    const std::string text = std::to_string(lost - m_droppedReported) + " messages dropped (log buffer full)";
+                    format({__FILE__, now(), __LINE__, 0, ELogLevel::Warn}, text);
+                    m_droppedReported = lost;
+                }
+                output();
+                written.fetch_add(m_entries.size(), std::memory_order_relaxed);
+                return m_entries.size();
+            }
+
+            // "[ KINETICA ] LEVEL file:line - [HH:MM:SS.mmm] message"
+            void format(const SRecordHeader& header, std::string_view text) {
+                const auto wall = m_wallStart + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                                                    std::chrono::nanoseconds(header.time - m_steadyStart));
+                const std::time_t seconds = std::chrono::system_clock::to_time_t(wall);
+                if (seconds != m_clockSecond) {
+                    std::tm tm{};
+#ifdef _WIN32
+                    localtime_s(&tm, &seconds);
+#else
+                    localtime_r(&seconds, &tm);
+#endif
+                    std::strftime(m_clockText, sizeof(m_clockText), "%H:%M:%S", &tm);
+                    m_clockSecond = seconds;
+                }
+                const auto milliseconds =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(wall.time_since_epoch()).count() % 1000;
+
+                if (m_color) {
+                    m_buffer += Color::kinetica;
+                    m_buffer += "[ KINETICA ] ";
+                    m_buffer += Color::reset;
+                    m_buffer += levelColor(header.level);
+                    m_buffer += levelName(header.level);
+                    m_buffer += Color::reset;
+                } else {
+                    m_buffer += "[ KINETICA ] ";
+                    m_buffer += levelName(header.level);
+                }
+                char prefix[64];
+                std::snprintf(prefix, sizeof(prefix), ":%u - [%s.%03d] ", header.line, m_clockText,
+                              static_cast<int>(milliseconds));
+                m_buffer += ' ';
+                m_buffer += header.file;
+                m_buffer += prefix;
+                m_buffer += text;
+                m_buffer += '\n';
+            }
+
+            void output() {
+                std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_output);
+                std::fflush(m_output);
+            }
+
+            const std::chrono::system_clock::time_point m_wallStart;
+            const std::uint64_t m_steadyStart;
+            std::thread m_thread;
+
+            std::mutex m_ringsMutex;
+            std::vector<std::unique_ptr<SRing>> m_rings;
+
+            std::mutex m_wakeMutex;
+            std::condition_variable m_wakeCondition;
+            std::condition_variable m_flushedCondition;
+            bool m_wakeRequested = false;
+            bool m_stopRequested = false;
+            bool m_running = true;
+            std::uint64_t m_flushRequested = 0;
+            std::uint64_t m_flushDone = 0;
+
+            // Logger thread (or writeNow under m_outputMutex) only.
+            std::mutex m_outputMutex;
+            std::FILE* m_output = nullptr;
+            bool m_color = false;
+            std::string m_buffer;
+            std::vector<SEntry> m_entries;
+            std::uint64_t m_droppedReported = 0;
+            std::time_t m_clockSecond = -1;
+            char m_clockText[16] = {};
+        };
+
+        // Never destroyed: threads may log during static destruction.
+        CLogger& logger() {
+            static CLogger* instance = new CLogger();
+            return *instance;
+        }
+
+        // Marks the ring closed when its thread exits; the logger frees it
+        // once drained.
+        struct SThreadRing {
+            SRing* ring = nullptr;
+            ~SThreadRing() {
+                if (ring) ring->closed.store(true, std::memory_order_release);
+            }
+        };
+        thread_local SThreadRing t_ring;
+
+        bool push(SRing& ring, const SRecordHeader& header, const char* text) {
+            const std::size_t size = recordSize(header.length);
+            const std::uint64_t head = ring.head.load(std::memory_order_relaxed);
+            const std::size_t offset = head & (RING_BYTES - 1);
+            const std::size_t skip = RING_BYTES - offset < size ? RING_BYTES - offset : 0;
+            const std::uint64_t used = head + skip + size - ring.tail.load(std::memory_order_acquire);
+
+            // Past half full, wake the logger instead of waiting for its poll.
+            if (used > RING_BYTES / 2 && !ring.wakePending.exchange(true, std::memory_order_relaxed)) logger().wake();
+            if (used > RING_BYTES) {
+                if (header.level < ELogLevel::Warn) {
+                    logger().dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                logger().blocked.fetch_add(1, std::memory_order_relaxed);
+                while (head + skip + size - ring.tail.load(std::memory_order_acquire) > RING_BYTES) {
+                    logger().wake();
+                    std::this_thread::yield();
+                }
+            }
+
+            if (skip >= sizeof(SRecordHeader)) {
+                const SRecordHeader wrap{nullptr, 0, 0, WRAP, header.level};
+                std::memcpy(ring.bytes.get() + offset, &wrap, sizeof(wrap));
+            }
+            unsigned char* target = ring.bytes.get() + ((head + skip) & (RING_BYTES - 1));
+            std::memcpy(target, &header, sizeof(header));
+            std::memcpy(target + sizeof(header), text, header.length);
+            ring.head.store(head + skip + size, std::memory_order_release);
+            return true;
+        }
+
+    } // namespace
+
+    void setLevel(ELogLevel level) { Detail::s_level.store(level, std::memory_order_relaxed); }
+
+    ELogLevel level() { return Detail::s_level.load(std::memory_order_relaxed); }
+
+    const char* levelName(ELogLevel level) {
+        switch (level) {
+            case ELogLevel::Debug: return "DEBUG";
+            case ELogLevel::Info: return "INFO";
+            case ELogLevel::Warn: return "WARN";
+            case ELogLevel::Error: return "ERROR";
+            default: return "OFF";
+        }
+    }
+
+    bool parseLevel(std::string_view text, ELogLevel& out) {
+        constexpr std::string_view names[] = {"debug", "info", "warn", "error", "off"};
+        for (std::size_t i = 0; i < std::size(names); ++i) {
+            if (text == names[i]) {
+                out = ELogLevel(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void write(ELogLevel level, const char* file, std::uint32_t line, std::string_view message) {
+        const auto length = static_cast<std::uint16_t>(std::min<std::size_t>(message.size(), MAX_MESSAGE));
+        const SRecordHeader header{file, now(), line, length, level};
+        CLogger& instance = logger();
+        if (!instance.async.load(std::memory_order_acquire)) {
+            instance.writeNow(header, message.substr(0, length));
+            return;
+        }
+        if (!t_ring.ring) t_ring.ring = instance.registerThread();
+        push(*t_ring.ring, header, message.data());
+    }
+
+    void flush() {
+        CLogger& instance = logger();
+        if (instance.async.load(std::memory_order_acquire)) instance.flush();
+    }
+
+    void shutdown() {
+        CLogger& instance = logger();
+        instance.async.store(false, std::memory_order_release);
+        instance.stop(); // drains every ring on the way out
+    }
+
+    void setOutput(std::FILE* file) { logger().setOutput(file); }
+
+    SLogStats stats() {
+        CLogger& instance = logger();
+        return {instance.written.load(std::memory_order_relaxed), instance.dropped.load(std::memory_order_relaxed),
+                instance.blocked.load(std::memory_order_relaxed)};
+    }
+
+} // namespace Kinetica::Log
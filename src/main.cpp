@@ -1,16 +1,32 @@
 #include <kinetica/rendering.hpp>
 #include <kinetica/log.hpp>
+#include <kinetica/profiler.hpp>
 #include <kinetica/types.hpp>
 #include <kinetica/window.hpp>
 
+#include <kinetica/thread_pool.hpp>
+
 #include <kinetica/ecs/registry.hpp>
+#include <kinetica/ecs/scheduler.hpp>
+#include <kinetica/ecs/transform_hierarchy.hpp>
+#include <kinetica/ecs/scene_culling.hpp>
+
+#include <kinetica/io/asset_loader.hpp>
+#include <kinetica/io/batch_processor.hpp>
 
 #include <kinetica/ecs/components/transform.hpp>
 #include <kinetica/ecs/components/material.hpp>
 #include <kinetica/ecs/components/mesh.hpp>
 
+#include <algorithm>
+#include <charconv>
 #include <iostream>
 
+bool parse_size(const std::string& text, std::size_t& out) {
+    const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+    return ec == std::errc() && end == text.data() + text.size();
+}
+
 Kinetica::SAppArgs parse_args(int argc, char* argv[]) {
     Kinetica::SAppArgs args;
 
@@ -24,9 +40,24 @@ Kinetica::SAppArgs parse_args(int argc, char* argv[]) {
         } else if (arg == "--headless") {
             args.headless = true;
         } else if (arg.starts_with("--log-level=")) {
-            args.logLevel = arg.substr(13);
+            args.logLevel = arg.substr(12);
         } else if (arg.starts_with("--plugin-dir=")) {
-            args.pluginDir = arg.substr(14);
+            args.pluginDir = arg.substr(13);
+        } else if (arg == "--profile") {
+            args.profile = true;
+        } else if (arg.starts_with("--profile=")) {
+            args.profile = true;
+            args.profileTrace = arg.substr(10);
+        } else if (arg.starts_with("--pipeline=")) {
+            args.pipeline = arg.substr(11);
+        } else if (arg.starts_with("--output=")) {
+            args.outputDir = arg.substr(9);
+        } else if (arg.starts_with("--jobs=")) {
+            if (!parse_size(arg.substr(7), args.jobs)) KLOG_ERROR("Invalid job count: " + arg);
+        } else if (arg.starts_with("--memory-budget=")) {
+            if (!parse_size(arg.substr(16), args.memoryBudgetMB)) KLOG_ERROR("Invalid memory budget: " + arg);
+        } else if (arg.starts_with("--thumbnail-size=")) {
+            if (!parse_size(arg.substr(17), args.thumbnailSize)) KLOG_ERROR("Invalid thumbnail size: " + arg);
         } else if (arg.starts_with("--")) {
             KLOG_ERROR("Unknown option: " + arg);
         } else {
@@ -40,14 +71,24 @@ Kinetica::SAppArgs parse_args(int argc, char* argv[]) {
 
 void print_help() {
     std::cout << R"(Kinetica - Low-poly 3D modeling, reimagined
-Usage: kinetica [options] [file.kin ...]
+Usage: kinetica [options] [file.kin|.obj|.gltf|.glb ...]
 
 Options:
   -h, --help          Show this help message
   -v, --version       Show version info
       --headless      Run without UI (for batch processing)
-      --log-level=L   Set log level (debug, info, warn, error)
+      --log-level=L   Set log level (debug, info, warn, error, off; default: warn)
       --plugin-dir=P  Load plugins from directory P
+      --profile[=F]   Record profiler zones; print a summary at exit and write
+                      a Chrome trace (chrome://tracing, Perfetto) to F
+
+Headless batch processing:
+      --pipeline=S    Comma-separated steps: import, validate, optimize, export,
+                      thumbnail (default: validate)
+      --output=DIR    Directory for exported .kin and .png files (default: next to input)
+      --jobs=N        Files processed at once (default: hardware threads)
+      --memory-budget=MB  Estimated working set allowed in flight (default: 4096)
+      --thumbnail-size=N  Thumbnail edge in pixels (default: 512)
 )";
 }
 
@@ -58,8 +99,63 @@ publisher : Initialized
 )";
 }
 
+// Summary table and trace file for --profile.
+void finish_profile(const Kinetica::SAppArgs& args) {
+    if (!args.profile) return;
+    KPROFILE_FRAME();
+    std::cout << Kinetica::Profile::formatSummary(Kinetica::Profile::summarize());
+    if (const std::uint64_t dropped = Kinetica::Profile::stats().dropped; dropped > 0) {
+        std::cout << dropped << " zones dropped (thread buffers full between frames)" << std::endl;
+    }
+    if (!args.profileTrace.empty() && !Kinetica::Profile::writeChromeTrace(args.profileTrace)) {
+        KLOG_ERROR("Failed to write profile trace: " + args.profileTrace);
+    }
+}
+
+// Batch processing without a window or GL context.
+int run_headless(const Kinetica::SAppArgs& args) {
+    Kinetica::IO::SBatchOptions options;
+    if (!args.pipeline.empty() && !Kinetica::IO::parseBatchPipeline(args.pipeline, options.pipeline)) {
+        KLOG_ERROR("Invalid pipeline: " + args.pipeline);
+        return static_cast<int>(Kinetica::EExitCode::InvalidArguments);
+    }
+    if (args.filesToOpen.empty()) {
+        KLOG_ERROR("No input files for headless mode");
+        return static_cast<int>(Kinetica::EExitCode::InvalidArguments);
+    }
+    options.outputDir = args.outputDir;
+    options.jobs = args.jobs;
+    if (args.memoryBudgetMB > 0) options.memoryBudget = args.memoryBudgetMB << 20;
+    if (args.thumbnailSize > 0)
+        options.thumbnailSize = static_cast<std::uint32_t>(std::min<std::size_t>(args.thumbnailSize, 8192));
+
+    const Kinetica::IO::SBatchSummary summary = Kinetica::IO::runBatch(args.filesToOpen, options,
+        [](const Kinetica::IO::SBatchFileResult& result) {
+            Kinetica::Log::flush(); // the file's warnings go above its result
+            std::cout << Kinetica::IO::formatBatchResult(result) << std::endl;
+            // One profiler frame per file keeps the per-thread buffers drained.
+            KPROFILE_FRAME();
+        });
+    std::cout << Kinetica::IO::formatBatchSummary(summary) << std::endl;
+    finish_profile(args);
+
+    return static_cast<int>(summary.failed > 0 ? Kinetica::EExitCode::BatchFailed : Kinetica::EExitCode::Success);
+}
+
 int main(int argc, char* argv[]) {
     Kinetica::SAppArgs args = parse_args(argc, argv);
+    if (!args.logLevel.empty()) {
+        Kinetica::Log::ELogLevel level;
+        if (Kinetica::Log::parseLevel(args.logLevel, level)) Kinetica::Log::setLevel(level);
+        else KLOG_ERROR("Invalid log level: " + args.logLevel);
+    }
+    if (args.profile) {
+#if !KINETICA_PROFILE
+        KLOG_WARN("Built without KINETICA_ENABLE_PROFILER: --profile records nothing");
+#endif
+        Kinetica::Profile::setEnabled(true);
+        KPROFILE_THREAD("Main");
+    }
     if (args.showHelp) {
         print_help();
         return static_cast<int>(Kinetica::EExitCode::Success);
@@ -71,8 +167,7 @@ int main(int argc, char* argv[]) {
     }
 
     if (args.headless) {
-        KLOG_INFO("Running in headless mode (not implemented yet)");
-        return static_cast<int>(Kinetica::EExitCode::Success);
+        return run_headless(args);
     }
 
     Kinetica::CWindow window;
@@ -89,11 +184,14 @@ int main(int argc, char* argv[]) {
         glm::vec3(0.0f, 1.0f, 0.0f)
     );
 
+    glm::mat4 viewProjection(1.0f);
+
     auto updateProjection = [&](int width, int height) {
         if (width <= 0 || height <= 0) return;
         float aspect = static_cast<float>(width) / static_cast<float>(height);
         glm::mat4 projection = glm::perspective(glm::radians(60.0f), aspect, 0.1f, 100.0f);
         renderer.setViewProjection(view, projection);
+        viewProjection = projection * view;
     };
 
     updateProjection(window.getWidth(), window.getHeight());
@@ -103,27 +201,83 @@ int main(int argc, char* argv[]) {
     });
 
     Kinetica::CRegistry registry;
+    // Destroyed meshes hand their arena range back.
+    registry.onRemove<Kinetica::Components::SMesh>(
+        [&renderer](Kinetica::EntityID, Kinetica::Components::SMesh& mesh) { renderer.releaseMesh(mesh); });
+    Kinetica::CThreadPool threadPool;
+    Kinetica::CScheduler scheduler(registry, threadPool);
+
+    Kinetica::CTransformHierarchy hierarchy(registry);
+    Kinetica::CSceneCulling culling(registry);
+    std::vector<Kinetica::EntityID> visible;
+
+    // Files stream in over the first frames instead of blocking startup.
+    Kinetica::IO::CAssetLoader loader;
+    for (const std::string& file : args.filesToOpen) loader.load(file);
+
+    // Propagate changed transforms to world matrices and world bounds before the draw.
+    scheduler.addSystem("transforms",
+        Kinetica::SSystemAccess()
+            .write<Kinetica::Components::STransform>()
+            .write<Kinetica::Components::SMesh>()
+            .read<Kinetica::Components::SHierarchy>(),
+        [&hierarchy, &culling](Kinetica::CRegistry&, Kinetica::CThreadPool& pool) {
+            hierarchy.update(&pool);
+            culling.update(hierarchy);
+        });
 
     while (!window.shouldClose()) {
-        window.pollEvents();
+        KPROFILE_FRAME();
+        {
+            KPROFILE_SCOPE("Poll events");
+            window.pollEvents();
+        }
 
         if (window.isMinimized()) { window.swap(); continue; }
 
+        {
+            KPROFILE_SCOPE("Asset loader");
+            loader.update(registry, &hierarchy, &renderer);
+        }
+
+        {
+            KPROFILE_SCOPE("Systems");
+            scheduler.run();
+        }
+
         renderer.clear();
 
-        const auto allEntities = registry.getAllEntities();
-        for (const auto& entity : allEntities) {
-            auto* transform = registry.getComponent<Kinetica::Components::STransform>(entity);
-            auto* mesh      = registry.getComponent<Kinetica::Components::SMesh>(entity);
-            auto* material  = registry.getComponent<Kinetica::Components::SMaterial>(entity);
+        {
+            KPROFILE_SCOPE("Uploads");
+            registry.view<Kinetica::Components::SMesh>().each([&](Kinetica::Components::SMesh& mesh) {
+                if (mesh.needsUpload()) renderer.uploadMesh(mesh);
+            });
+        }
 
-            if (transform && mesh && material) {
-                renderer.renderEntity(*transform, *mesh, *material);
-            }
+        // Build the render queue from the visible set in parallel; flushBatches() sorts and draws it.
+        {
+            KPROFILE_SCOPE("Cull and draw");
+            culling.cull(viewProjection, visible);
+            threadPool.parallelFor(visible.size(), 1024, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    const Kinetica::EntityID entity = visible[i];
+                    const auto* mesh = registry.getComponent<Kinetica::Components::SMesh>(entity);
+                    const auto* material = registry.getComponent<Kinetica::Components::SMaterial>(entity);
+                    const glm::mat4* world = hierarchy.worldMatrix(entity);
+                    if (!mesh || !material || !world) continue;
+                    renderer.submit(*world, *mesh, *material);
+                }
+            });
+            renderer.flushBatches();
         }
+        renderer.present();
 
-        window.swap();
+        {
+            KPROFILE_SCOPE("Swap");
+            window.swap();
+        }
     }
 
+    finish_profile(args);
     return static_cast<int>(Kinetica::EExitCode::Success);
 }
@@ -0,0 +1,106 @@
+#include <kinetica/math/bounds.hpp>
+
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define KINETICA_X86 1
+#include <emmintrin.h>
+#else
+#define KINETICA_X86 0
+#endif
+
+namespace Kinetica::Math {
+
+    SRay SRay::transformed(const glm::mat4& m) const {
+        const glm::vec4 o = m * glm::vec4(origin, 1.0f);
+        const glm::vec4 d = m * glm::vec4(direction, 0.0f);
+        return SRay(glm::vec3(o.x, o.y, o.z), glm::vec3(d.x, d.y, d.z));
+    }
+
+    SRay SRay::fromNdc(const glm::mat4& viewProjection, float ndcX, float ndcY) {
+        const glm::mat4 inv = glm::inverse(viewProjection);
+        glm::vec4 nearPoint = inv * glm::vec4(ndcX, ndcY, -1.0f, 1.0f);
+        glm::vec4 farPoint = inv * glm::vec4(ndcX, ndcY, 1.0f, 1.0f);
+        nearPoint = nearPoint / nearPoint.w;
+        farPoint = farPoint / farPoint.w;
+        const glm::vec3 o(nearPoint.x, nearPoint.y, nearPoint.z);
+        return SRay(o, glm::vec3(farPoint.x, farPoint.y, farPoint.z) - o);
+    }
+
+    SAABB SAABB::transformed(const glm::mat4& m) const {
+        if (isEmpty()) return *this;
+        const glm::vec3 c = center();
+        const glm::vec3 e = extent();
+        glm::vec3 nc(m[3][0], m[3][1], m[3][2]);
+        glm::vec3 ne(0.0f);
+        for (int col = 0; col < 3; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                nc[row] += m[col][row] * c[col];
+                ne[row] += std::fabs(m[col][row]) * e[col];
+            }
+        }
+        SAABB r;
+        r.min = nc - ne;
+        r.max = nc + ne;
+        return r;
+    }
+
+    SFrustum SFrustum::fromMatrix(const glm::mat4& m) {
+        // Row i of the matrix is (m[0][i], m[1][i], m[2][i], m[3][i]).
+        auto row = [&](int i) { return glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]); };
+        const glm::vec4 r0 = row(0), r1 = row(1), r2 = row(2), r3 = row(3);
+        const glm::vec4 planes[6] = { r3 + r0, r3 - r0, r3 + r1, r3 - r1, r3 + r2, r3 - r2 };
+
+        SFrustum f;
+        for (int i = 0; i < 6; ++i) {
+            const float len = std::sqrt(planes[i].x * planes[i].x + planes[i].y * planes[i].y + planes[i].z * planes[i].z);
+            const float inv = len > 0.0f ? 1.0f / len : 0.0f;
+            f.nx[i] = planes[i].x * inv;
+            f.ny[i] = planes[i].y * inv;
+            f.nz[i] = planes[i].z * inv;
+            f.d[i] = planes[i].w * inv;
+        }
+        for (int i = 6; i < 8; ++i) {
+            f.nx[i] = f.ny[i] = f.nz[i] = 0.0f;
+            f.d[i] = std::numeric_limits<float>::max();
+        }
+        return f;
+    }
+
+    // Per plane: s = n.c + d, r = |n|.e. Outside if s + r < 0 for any plane,
+    // inside if s - r >= 0 for all of them.
+    EContainment SFrustum::classify(const SAABB& box) const {
+        const glm::vec3 c = box.center();
+        const glm::vec3 e = box.extent();
+
+    #if KINETICA_X86
+        const __m128 cx = _mm_set1_ps(c.x), cy = _mm_set1_ps(c.y), cz = _mm_set1_ps(c.z);
+        const __m128 ex = _mm_set1_ps(e.x), ey = _mm_set1_ps(e.y), ez = _mm_set1_ps(e.z);
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        const __m128 zero = _mm_setzero_ps();
+
+        int intersecting = 0;
+        for (int i = 0; i < 8; i += 4) {
+            const __m128 px = _mm_load_ps(nx + i), py = _mm_load_ps(ny + i), pz = _mm_load_ps(nz + i);
+            const __m128 s = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, cx), _mm_mul_ps(py, cy)),
+                                        _mm_add_ps(_mm_mul_ps(pz, cz), _mm_load_ps(d + i)));
+            const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(px, absMask), ex),
+                                                   _mm_mul_ps(_mm_and_ps(py, absMask), ey)),
+                                        _mm_mul_ps(_mm_and_ps(pz, absMask), ez));
+            if (_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(s, r), zero))) return EContainment::Outside;
+            intersecting |= _mm_movemask_ps(_mm_cmplt_ps(_mm_sub_ps(s, r), zero));
+        }
+        return intersecting ? EContainment::Intersects : EContainment::Inside;
+    #else
+        bool intersecting = false;
+        for (int i = 0; i < 6; ++i) {
+            const float s = nx[i] * c.x + ny[i] * c.y + nz[i] * c.z + d[i];
+            const float r = std::fabs(nx[i]) * e.x + std::fabs(ny[i]) * e.y + std::fabs(nz[i]) * e.z;
+            if (s + r < 0.0f) return EContainment::Outside;
+            if (s - r < 0.0f) intersecting = true;
+        }
+        return intersecting ? EContainment::Intersects : EContainment::Inside;
+    #endif
+    }
+
+} // namespace Kinetica::Math
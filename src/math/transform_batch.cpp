@@ -0,0 +1,129 @@
+#include <kinetica/math/transform_batch.hpp>
+
+#include "transform_batch_kernel.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define KINETICA_X86 1
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define KINETICA_X86 0
+#endif
+
+namespace Kinetica::Math {
+
+    void STransformSoABuffer::resize(std::size_t count) {
+        for (auto* v : { &px, &py, &pz, &rx, &ry, &rz, &sx, &sy, &sz }) v->resize(count);
+    }
+
+    void STransformSoABuffer::set(std::size_t i, const Components::STransform& transform) {
+        px[i] = transform.position.x; py[i] = transform.position.y; pz[i] = transform.position.z;
+        rx[i] = transform.rotation.x; ry[i] = transform.rotation.y; rz[i] = transform.rotation.z;
+        sx[i] = transform.scale.x;    sy[i] = transform.scale.y;    sz[i] = transform.scale.z;
+    }
+
+    STransformSoA STransformSoABuffer::view() const {
+        return { px.data(), py.data(), pz.data(),
+                 rx.data(), ry.data(), rz.data(),
+                 sx.data(), sy.data(), sz.data() };
+    }
+
+#if KINETICA_X86
+    namespace {
+        // SSE2 is part of the x86-64 baseline, so this kernel needs no special flags.
+        struct SSse2Ops {
+            using V = __m128;
+            using I = __m128i;
+            static constexpr std::size_t WIDTH = 4;
+
+            static V load(const float* p) { return _mm_loadu_ps(p); }
+            static V set1(float v) { return _mm_set1_ps(v); }
+            static V add(V a, V b) { return _mm_add_ps(a, b); }
+            static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+            static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+            static V bitAnd(V a, V b) { return _mm_and_ps(a, b); }
+            static V bitAndNot(V a, V b) { return _mm_andnot_ps(a, b); }
+            static V bitXor(V a, V b) { return _mm_xor_ps(a, b); }
+
+            static I toIntTrunc(V v) { return _mm_cvttps_epi32(v); }
+            static V toFloat(I v) { return _mm_cvtepi32_ps(v); }
+            static V asFloat(I v) { return _mm_castsi128_ps(v); }
+            static I addI(I a, int b) { return _mm_add_epi32(a, _mm_set1_epi32(b)); }
+            static I subI(I a, int b) { return _mm_sub_epi32(a, _mm_set1_epi32(b)); }
+            static I andI(I a, int b) { return _mm_and_si128(a, _mm_set1_epi32(b)); }
+            static I andNotI(I a, int b) { return _mm_andnot_si128(a, _mm_set1_epi32(b)); }
+            static I shl29(I a) { return _mm_slli_epi32(a, 29); }
+            static I cmpEqZero(I a) { return _mm_cmpeq_epi32(a, _mm_setzero_si128()); }
+
+            // m[c * 4 + r] holds element (c, r) of 4 matrices; write them out AoS.
+            static void storeMatrices(V* m, float* out) {
+                for (int c = 0; c < 4; ++c) {
+                    V r0 = m[c * 4 + 0], r1 = m[c * 4 + 1], r2 = m[c * 4 + 2], r3 = m[c * 4 + 3];
+                    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+                    _mm_storeu_ps(out + 0 * 16 + c * 4, r0);
+                    _mm_storeu_ps(out + 1 * 16 + c * 4, r1);
+                    _mm_storeu_ps(out + 2 * 16 + c * 4, r2);
+                    _mm_storeu_ps(out + 3 * 16 + c * 4, r3);
+                }
+            }
+        };
+
+        bool cpuSupportsAvx2() {
+        #if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool fma = (info[2] & (1 << 12)) != 0;
+            if (!osxsave || !fma) return false;
+            if ((_xgetbv(0) & 0x6) != 0x6) return false;  // OS saves YMM state
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+        #else
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        #endif
+        }
+    }
+#endif
+
+    ESimdLevel activeSimdLevel() {
+    #if KINETICA_X86
+        static const ESimdLevel level = (Detail::avx2KernelCompiled() && cpuSupportsAvx2())
+            ? ESimdLevel::AVX2 : ESimdLevel::SSE2;
+        return level;
+    #else
+        return ESimdLevel::Scalar;
+    #endif
+    }
+
+    const char* simdLevelName(ESimdLevel level) {
+        switch (level) {
+            case ESimdLevel::AVX2:   return "AVX2";
+            case ESimdLevel::SSE2:   return "SSE2";
+            case ESimdLevel::Scalar: return "scalar";
+        }
+        return "unknown";
+    }
+
+    void composeTRS(const STransformSoA& in, glm::mat4* out, std::size_t count) {
+        composeTRS(in, out, count, activeSimdLevel());
+    }
+
+    void composeTRS(const STransformSoA& in, glm::mat4* out, std::size_t count, ESimdLevel level) {
+    #if KINETICA_X86
+        if (level == ESimdLevel::AVX2 && activeSimdLevel() == ESimdLevel::AVX2) {
+            Detail::composeTRSAvx2(in, out, count);
+            return;
+        }
+        if (level != ESimdLevel::Scalar) {
+            Detail::composeTRSKernel<SSse2Ops>(in, out, count);
+            return;
+        }
+    #else
+        (void)level;
+    #endif
+        Detail::composeTRSScalar(in, out, count);
+    }
+
+} // namespace Kinetica::Math
@@ -0,0 +1,79 @@
+// AVX2/FMA TRS kernel. The build compiles this file with AVX2 enabled
+// (see KINETICA_AVX2_SOURCES in CMakeLists.txt); it is only called after
+// activeSimdLevel() confirmed CPU support.
+
+#include "transform_batch_kernel.hpp"
+
+#if (defined(__AVX2__) && defined(__FMA__)) || (defined(_MSC_VER) && defined(__AVX2__))
+#include <immintrin.h>
+
+namespace Kinetica::Math::Detail {
+
+    namespace {
+        struct SAvx2Ops {
+            using V = __m256;
+            using I = __m256i;
+            static constexpr std::size_t WIDTH = 8;
+
+            static V load(const float* p) { return _mm256_loadu_ps(p); }
+            static V set1(float v) { return _mm256_set1_ps(v); }
+            static V add(V a, V b) { return _mm256_add_ps(a, b); }
+            static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+            static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+            static V bitAnd(V a, V b) { return _mm256_and_ps(a, b); }
+            static V bitAndNot(V a, V b) { return _mm256_andnot_ps(a, b); }
+            static V bitXor(V a, V b) { return _mm256_xor_ps(a, b); }
+
+            static I toIntTrunc(V v) { return _mm256_cvttps_epi32(v); }
+            static V toFloat(I v) { return _mm256_cvtepi32_ps(v); }
+            static V asFloat(I v) { return _mm256_castsi256_ps(v); }
+            static I addI(I a, int b) { return _mm256_add_epi32(a, _mm256_set1_epi32(b)); }
+            static I subI(I a, int b) { return _mm256_sub_epi32(a, _mm256_set1_epi32(b)); }
+            static I andI(I a, int b) { return _mm256_and_si256(a, _mm256_set1_epi32(b)); }
+            static I andNotI(I a, int b) { return _mm256_andnot_si256(a, _mm256_set1_epi32(b)); }
+            static I shl29(I a) { return _mm256_slli_epi32(a, 29); }
+            static I cmpEqZero(I a) { return _mm256_cmpeq_epi32(a, _mm256_setzero_si256()); }
+
+            // m[c * 4 + r] holds element (c, r) of 8 matrices; 4x8 transpose per column.
+            static void storeMatrices(V* m, float* out) {
+                for (int c = 0; c < 4; ++c) {
+                    const V t0 = _mm256_unpacklo_ps(m[c * 4 + 0], m[c * 4 + 1]);
+                    const V t1 = _mm256_unpackhi_ps(m[c * 4 + 0], m[c * 4 + 1]);
+                    const V t2 = _mm256_unpacklo_ps(m[c * 4 + 2], m[c * 4 + 3]);
+                    const V t3 = _mm256_unpackhi_ps(m[c * 4 + 2], m[c * 4 + 3]);
+                    const V u[4] = {
+                        _mm256_shuffle_ps(t0, t2, 0x44),  // matrices 0 | 4
+                        _mm256_shuffle_ps(t0, t2, 0xEE),  // matrices 1 | 5
+                        _mm256_shuffle_ps(t1, t3, 0x44),  // matrices 2 | 6
+                        _mm256_shuffle_ps(t1, t3, 0xEE),  // matrices 3 | 7
+                    };
+                    for (int k = 0; k < 4; ++k) {
+                        _mm_storeu_ps(out + k * 16 + c * 4, _mm256_castps256_ps128(u[k]));
+                        _mm_storeu_ps(out + (k + 4) * 16 + c * 4, _mm256_extractf128_ps(u[k], 1));
+                    }
+                }
+            }
+        };
+    }
+
+    bool avx2KernelCompiled() { return true; }
+
+    void composeTRSAvx2(const STransformSoA& in, glm::mat4* out, std::size_t count) {
+        composeTRSKernel<SAvx2Ops>(in, out, count);
+    }
+
+} // namespace Kinetica::Math::Detail
+
+#else
+
+namespace Kinetica::Math::Detail {
+
+    bool avx2KernelCompiled() { return false; }
+
+    void composeTRSAvx2(const STransformSoA& in, glm::mat4* out, std::size_t count) {
+        composeTRSScalar(in, out, count);
+    }
+
+} // namespace Kinetica::Math::Detail
+
+#endif
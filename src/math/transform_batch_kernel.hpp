@@ -0,0 +1,133 @@
+#ifndef KINETICA_MATH_TRANSFORM_BATCH_KERNEL_HPP
+#define KINETICA_MATH_TRANSFORM_BATCH_KERNEL_HPP
+
+// ISA-independent part of the TRS kernels. Each kernel TU provides an Ops
+// struct (vector type V, integer vector type I and the primitive operations)
+// and instantiates composeTRSKernel<Ops> with its own compiler target flags.
+// Everything here has internal linkage so code built with wider target flags
+// can never be merged into (and then executed by) the baseline TUs.
+
+#include <kinetica/math/transform_batch.hpp>
+
+#include <cmath>
+#include <cstddef>
+
+namespace Kinetica::Math::Detail {
+
+    static inline STransformSoA offset(const STransformSoA& in, std::size_t i) {
+        return { in.px + i, in.py + i, in.pz + i,
+                 in.rx + i, in.ry + i, in.rz + i,
+                 in.sx + i, in.sy + i, in.sz + i };
+    }
+
+    // Scalar reference; also the non-x86 path and the tail of the vector kernels.
+    static inline void composeTRSScalar(const STransformSoA& in, glm::mat4* out, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const float sX = std::sin(in.rx[i]), cX = std::cos(in.rx[i]);
+            const float sY = std::sin(in.ry[i]), cY = std::cos(in.ry[i]);
+            const float sZ = std::sin(in.rz[i]), cZ = std::cos(in.rz[i]);
+            glm::mat4& r = out[i];
+            r[0] = glm::vec4(cZ * cY * in.sx[i], sZ * cY * in.sx[i], -sY * in.sx[i], 0.0f);
+            r[1] = glm::vec4((cZ * sY * sX - sZ * cX) * in.sy[i], (sZ * sY * sX + cZ * cX) * in.sy[i], cY * sX * in.sy[i], 0.0f);
+            r[2] = glm::vec4((cZ * sY * cX + sZ * sX) * in.sz[i], (sZ * sY * cX - cZ * sX) * in.sz[i], cY * cX * in.sz[i], 0.0f);
+            r[3] = glm::vec4(in.px[i], in.py[i], in.pz[i], 1.0f);
+        }
+    }
+
+    // sin/cos of W lanes at once (Cephes single precision polynomials,
+    // accurate to a few ULP for |x| < 8192).
+    template<typename Ops>
+    inline void sinCos(typename Ops::V x, typename Ops::V& outSin, typename Ops::V& outCos) {
+        using V = typename Ops::V;
+        using I = typename Ops::I;
+
+        const V signMask = Ops::set1(-0.0f);
+        V signSin = Ops::bitAnd(x, signMask);
+        x = Ops::bitAndNot(signMask, x);  // |x|
+
+        // Octant j (made even) and the reduced argument x - j * pi/4.
+        I j = Ops::toIntTrunc(Ops::mul(x, Ops::set1(1.27323954473516f)));
+        j = Ops::andI(Ops::addI(j, 1), ~1);
+        const V y = Ops::toFloat(j);
+
+        const V swapSignSin = Ops::asFloat(Ops::shl29(Ops::andI(j, 4)));
+        const V polyMask = Ops::asFloat(Ops::cmpEqZero(Ops::andI(j, 2)));
+        const V signCos = Ops::asFloat(Ops::shl29(Ops::andNotI(Ops::subI(j, 2), 4)));
+        signSin = Ops::bitXor(signSin, swapSignSin);
+
+        x = Ops::sub(x, Ops::mul(y, Ops::set1(0.78515625f)));
+        x = Ops::sub(x, Ops::mul(y, Ops::set1(2.4187564849853515625e-4f)));
+        x = Ops::sub(x, Ops::mul(y, Ops::set1(3.77489497744594108e-8f)));
+        const V z = Ops::mul(x, x);
+
+        V c = Ops::set1(2.443315711809948e-5f);
+        c = Ops::add(Ops::mul(c, z), Ops::set1(-1.388731625493765e-3f));
+        c = Ops::add(Ops::mul(c, z), Ops::set1(4.166664568298827e-2f));
+        c = Ops::mul(Ops::mul(c, z), z);
+        c = Ops::sub(c, Ops::mul(z, Ops::set1(0.5f)));
+        c = Ops::add(c, Ops::set1(1.0f));
+
+        V s = Ops::set1(-1.9515295891e-4f);
+        s = Ops::add(Ops::mul(s, z), Ops::set1(8.3321608736e-3f));
+        s = Ops::add(Ops::mul(s, z), Ops::set1(-1.6666654611e-1f));
+        s = Ops::add(Ops::mul(Ops::mul(s, z), x), x);
+
+        // Octants 1,2 (mod 4) swap the roles of the two polynomials.
+        const V sinPart = Ops::add(Ops::bitAnd(polyMask, s), Ops::bitAndNot(polyMask, c));
+        const V cosPart = Ops::add(Ops::bitAnd(polyMask, c), Ops::bitAndNot(polyMask, s));
+        outSin = Ops::bitXor(sinPart, signSin);
+        outCos = Ops::bitXor(cosPart, signCos);
+    }
+
+    template<typename Ops>
+    void composeTRSKernel(const STransformSoA& in, glm::mat4* out, std::size_t count) {
+        using V = typename Ops::V;
+        constexpr std::size_t W = Ops::WIDTH;
+
+        std::size_t i = 0;
+        for (; i + W <= count; i += W) {
+            V sinX, cosX, sinY, cosY, sinZ, cosZ;
+            sinCos<Ops>(Ops::load(in.rx + i), sinX, cosX);
+            sinCos<Ops>(Ops::load(in.ry + i), sinY, cosY);
+            sinCos<Ops>(Ops::load(in.rz + i), sinZ, cosZ);
+
+            const V sx = Ops::load(in.sx + i);
+            const V sy = Ops::load(in.sy + i);
+            const V sz = Ops::load(in.sz + i);
+
+            // R = Rz * Ry * Rx, column j scaled by s[j].
+            const V szsy = Ops::mul(sinZ, sinY);
+            const V czsy = Ops::mul(cosZ, sinY);
+            const V zero = Ops::set1(0.0f);
+
+            V m[16];
+            m[0]  = Ops::mul(Ops::mul(cosZ, cosY), sx);
+            m[1]  = Ops::mul(Ops::mul(sinZ, cosY), sx);
+            m[2]  = Ops::mul(Ops::sub(zero, sinY), sx);
+            m[3]  = zero;
+            m[4]  = Ops::mul(Ops::sub(Ops::mul(czsy, sinX), Ops::mul(sinZ, cosX)), sy);
+            m[5]  = Ops::mul(Ops::add(Ops::mul(szsy, sinX), Ops::mul(cosZ, cosX)), sy);
+            m[6]  = Ops::mul(Ops::mul(cosY, sinX), sy);
+            m[7]  = zero;
+            m[8]  = Ops::mul(Ops::add(Ops::mul(czsy, cosX), Ops::mul(sinZ, sinX)), sz);
+            m[9]  = Ops::mul(Ops::sub(Ops::mul(szsy, cosX), Ops::mul(cosZ, sinX)), sz);
+            m[10] = Ops::mul(Ops::mul(cosY, cosX), sz);
+            m[11] = zero;
+            m[12] = Ops::load(in.px + i);
+            m[13] = Ops::load(in.py + i);
+            m[14] = Ops::load(in.pz + i);
+            m[15] = Ops::set1(1.0f);
+
+            Ops::storeMatrices(m, &out[i][0][0]);
+        }
+
+        composeTRSScalar(offset(in, i), out + i, count - i);
+    }
+
+    // Provided by transform_batch_avx2.cpp; false when that TU was built without AVX2.
+    bool avx2KernelCompiled();
+    void composeTRSAvx2(const STransformSoA& in, glm::mat4* out, std::size_t count);
+
+} // namespace Kinetica::Math::Detail
+
+#endif
@@ -0,0 +1,308 @@
+#include <kinetica/profiler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Kinetica::Profile {
+
+    namespace {
+
+        constexpr std::size_t RING_EVENTS = 16384;             // per thread and frame, power of two
+        constexpr std::size_t WINDOW_FRAMES = 600;             // rolling window
+        constexpr std::size_t WINDOW_EVENTS = std::size_t(4) << 20; // memory cap across the window
+        constexpr std::uint32_t GPU_THREAD = 0;                // trace track of GPU zones
+
+        struct SZoneEvent {
+            const char* name;
+            std::uint64_t begin;
+            std::uint64_t end;
+        };
+
+        // Single producer (the owning thread), single consumer (endFrame).
+        struct SThreadBuffer {
+            alignas(64) std::atomic<std::uint64_t> head{0};
+            alignas(64) std::atomic<std::uint64_t> tail{0};
+            alignas(64) std::atomic<bool> closed{false};
+            std::uint32_t id = 0;
+            std::unique_ptr<SZoneEvent[]> events{new SZoneEvent[RING_EVENTS]};
+        };
+
+        struct SEvent {
+            const char* name;
+            std::uint64_t begin;
+            std::uint64_t end;
+            std::uint32_t thread; // GPU_THREAD for GPU zones
+        };
+
+        struct SFrame {
+            std::vector<SEvent> events;
+        };
+
+        class CProfiler {
+        public:
+            std::atomic<bool> enabled{false};
+            std::atomic<std::uint64_t> dropped{0};
+            std::atomic<std::uint64_t> collected{0};
+
+            SThreadBuffer* registerThread(std::string name) {
+                std::lock_guard<std::mutex> lock(m_threadsMutex);
+                m_threads.push_back(std::make_unique<SThreadBuffer>());
+                m_threads.back()->id = static_cast<std::uint32_t>(m_threadNames.size());
+                if (name.empty()) name = "Thread " + std::to_string(m_threadNames.size());
+                m_threadNames.push_back(std::move(name));
+                return m_threads.back().get();
+            }
+
+            void nameThread(const SThreadBuffer& buffer, std::string_view name) {
+                std::lock_guard<std::mutex> lock(m_threadsMutex);
+                m_threadNames[buffer.id] = name;
+            }
+
+            const char* intern(std::string_view name) {
+                std::lock_guard<std::mutex> lock(m_namesMutex);
+                return m_names.emplace(name).first->c_str();
+            }
+
+            void recordGpu(const char* name, std::uint64_t begin, std::uint64_t duration) {
+                std::lock_guard<std::mutex> lock(m_gpuMutex);
+                m_gpuEvents.push_back({name, begin, begin + duration, GPU_THREAD});
+            }
+
+            void endFrame() {
+                const std::uint64_t time = now();
+                if (!enabled.load(std::memory_order_relaxed)) {
+                    m_lastFrame = 0;
+                    return;
+                }
+                if (m_lastFrame != 0) record("Frame", m_lastFrame, time);
+                m_lastFrame = time;
+
+                SFrame frame;
+                {
+                    std::lock_guard<std::mutex> lock(m_threadsMutex);
+                    for (const auto& buffer : m_threads) {
+                        const std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+                        std::uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+                        for (; tail < head; ++tail) {
+                            const SZoneEvent& e = buffer->events[tail & (RING_EVENTS - 1)];
+                            frame.events.push_back({e.name, e.begin, e.end, buffer->id});
+                        }
+                        buffer->tail.store(tail, std::memory_order_release);
+                    }
+                    // A closed buffer gets no more events once drained.
+                    std::erase_if(m_threads, [](const std::unique_ptr<SThreadBuffer>& buffer) {
+                        return buffer->closed.load(std::memory_order_acquire) &&
+                               buffer->tail.load(std::memory_order_relaxed) ==
+                                   buffer->head.load(std::memory_order_acquire);
+                    });
+                }
+                {
+                    std::lock_guard<std::mutex> lock(m_gpuMutex);
+                    frame.events.insert(frame.events.end(), m_gpuEvents.begin(), m_gpuEvents.end());
+                    m_gpuEvents.clear();
+                }
+                collected.fetch_add(frame.events.size(), std::memory_order_relaxed);
+
+                std::lock_guard<std::mutex> lock(m_windowMutex);
+                m_windowEvents += frame.events.size();
+                m_window.push_back(std::move(frame));
+                while (m_window.size() > 1 && (m_window.size() > WINDOW_FRAMES || m_windowEvents > WINDOW_EVENTS)) {
+                    m_windowEvents -= m_window.front().events.size();
+                    m_window.pop_front();
+                }
+            }
+
+            std::vector<SZoneStats> summarize(std::size_t frames) {
+                struct SGroup {
+                    bool gpu;
+                    std::vector<double> milliseconds;
+                };
+                std::unordered_map<std::string, SGroup> groups;
+                std::size_t frameCount = 0;
+                {
+                    std::lock_guard<std::mutex> lock(m_windowMutex);
+                    frameCount = std::min(frames, m_window.size());
+                    for (std::size_t f = m_window.size() - frameCount; f < m_window.size(); ++f) {
+                        for (const SEvent& e : m_window[f].events) {
+                            const bool gpu = e.thread == GPU_THREAD;
+                            SGroup& group = groups[gpu ? std::string(e.name) + " (GPU)" : std::string(e.name)];
+                            group.gpu = gpu;
+                            group.milliseconds.push_back(static_cast<double>(e.end - e.begin) * 1e-6);
+                        }
+                    }
+                }
+
+                std::vector<SZoneStats> zones;
+                for (auto& [name, group] : groups) {
+                    std::vector<double>& ms = group.milliseconds;
+                    SZoneStats zone;
+                    zone.name = name;
+                    zone.gpu = group.gpu;
+                    zone.count = ms.size();
+                    zone.perFrame = static_cast<double>(ms.size()) / static_cast<double>(std::max<std::size_t>(frameCount, 1));
+                    double sum = 0.0;
+                    for (const double v : ms) sum += v;
+                    zone.avgMs = sum / static_cast<double>(ms.size());
+                    const auto p99 = ms.begin() + static_cast<std::ptrdiff_t>((ms.size() - 1) * 99 / 100);
+                    std::nth_element(ms.begin(), p99, ms.end());
+                    zone.p99Ms = *p99;
+                    zone.minMs = *std::min_element(ms.begin(), ms.end());
+                    zone.maxMs = *std::max_element(ms.begin(), ms.end());
+                    zones.push_back(std::move(zone));
+                }
+                std::sort(zones.begin(), zones.end(), [](const SZoneStats& a, const SZoneStats& b) {
+                    return a.avgMs * a.perFrame > b.avgMs * b.perFrame;
+                });
+                return zones;
+            }
+
+            bool writeChromeTrace(const std::string& path) {
+                std::FILE* file = std::fopen(path.c_str(), "wb");
+                if (!file) return false;
+
+                auto writeString = [&](const char* text) {
+                    std::fputc('"', file);
+                    for (const char* c = text; *c; ++c) {
+                        if (*c == '"' || *c == '\\') std::fputc('\\', file);
+                        if (static_cast<unsigned char>(*c) < 0x20) std::fprintf(file, "\\u%04x", *c);
+                        else std::fputc(*c, file);
+                    }
+                    std::fputc('"', file);
+                };
+
+                std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+                bool first = true;
+                auto separator = [&] {
+                    if (!first) std::fputs(",\n", file);
+                    first = false;
+                };
+                {
+                    std::lock_guard<std::mutex> lock(m_threadsMutex);
+                    separator();
+                    std::fputs("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GPU\"}}", file);
+                    for (std::size_t i = 1; i < m_threadNames.size(); ++i) {
+                        separator();
+                        std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":", i);
+                        writeString(m_threadNames[i].c_str());
+                        std::fputs("}}", file);
+                    }
+                }
+                {
+                    std::lock_guard<std::mutex> lock(m_windowMutex);
+                    std::uint64_t origin = ~std::uint64_t(0);
+                    for (const SFrame& frame : m_window)
+                        for (const SEvent& e : frame.events) origin = std::min(origin, e.begin);
+                    for (const SFrame& frame : m_window) {
+                        for (const SEvent& e : frame.events) {
+                            separator();
+                            std::fputs("{\"name\":", file);
+                            writeString(e.name);
+                            std::fprintf(file, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                                         e.thread == GPU_THREAD ? "gpu" : "cpu", e.thread,
+                                         static_cast<double>(e.begin - origin) * 1e-3,
+                                         static_cast<double>(e.end - e.begin) * 1e-3);
+                        }
+                    }
+                }
+                std::fputs("\n]}\n", file);
+                return std::fclose(file) == 0;
+            }
+
+        private:
+            std::mutex m_threadsMutex;
+            std::vector<std::unique_ptr<SThreadBuffer>> m_threads;
+            std::vector<std::string> m_threadNames{"GPU"}; // by thread id; id 0 is the GPU track
+
+            std::mutex m_namesMutex;
+            std::unordered_set<std::string> m_names; // node-based: c_str() stays valid
+
+            std::mutex m_gpuMutex;
+            std::vector<SEvent> m_gpuEvents;
+
+            std::mutex m_windowMutex;
+            std::deque<SFrame> m_window;
+            std::size_t m_windowEvents = 0;
+            std::uint64_t m_lastFrame = 0; // endFrame thread only
+        };
+
+        // Never destroyed: pool threads may still record during shutdown.
+        CProfiler& profiler() {
+            static CProfiler* instance = new CProfiler();
+            return *instance;
+        }
+
+        // The buffer is only allocated by the thread's first zone.
+        struct SThreadHandle {
+            SThreadBuffer* buffer = nullptr;
+            std::string name;
+            ~SThreadHandle() {
+                if (buffer) buffer->closed.store(true, std::memory_order_release);
+            }
+        };
+        thread_local SThreadHandle t_thread;
+
+        SThreadBuffer& threadBuffer() {
+            if (!t_thread.buffer) t_thread.buffer = profiler().registerThread(std::move(t_thread.name));
+            return *t_thread.buffer;
+        }
+
+    } // namespace
+
+    void setEnabled(bool value) { profiler().enabled.store(value, std::memory_order_relaxed); }
+
+    bool enabled() { return profiler().enabled.load(std::memory_order_relaxed); }
+
+    void record(const char* name, std::uint64_t begin, std::uint64_t end) {
+        SThreadBuffer& buffer = threadBuffer();
+        const std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+        if (head - buffer.tail.load(std::memory_order_acquire) >= RING_EVENTS) {
+            profiler().dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buffer.events[head & (RING_EVENTS - 1)] = {name, begin, end};
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    void recordGpu(const char* name, std::uint64_t cpuBegin, std::uint64_t duration) {
+        if (enabled()) profiler().recordGpu(name, cpuBegin, duration);
+    }
+
+    const char* intern(std::string_view name) { return profiler().intern(name); }
+
+    void setThreadName(std::string_view name) {
+        if (t_thread.buffer) profiler().nameThread(*t_thread.buffer, name);
+        else t_thread.name = name;
+    }
+
+    void endFrame() { profiler().endFrame(); }
+
+    std::vector<SZoneStats> summarize(std::size_t frames) { return profiler().summarize(frames); }
+
+    std::string formatSummary(const std::vector<SZoneStats>& zones) {
+        std::size_t width = 4;
+        for (const SZoneStats& zone : zones) width = std::max(width, zone.name.size());
+        char line[512];
+        std::snprintf(line, sizeof(line), "%-*s %9s %9s %9s %9s %9s\n", static_cast<int>(width), "zone", "per frame",
+                      "min ms", "avg ms", "p99 ms", "max ms");
+        std::string text = line;
+        for (const SZoneStats& zone : zones) {
+            std::snprintf(line, sizeof(line), "%-*s %9.2f %9.3f %9.3f %9.3f %9.3f\n", static_cast<int>(width),
+                          zone.name.c_str(), zone.perFrame, zone.minMs, zone.avgMs, zone.p99Ms, zone.maxMs);
+            text += line;
+        }
+        return text;
+    }
+
+    bool writeChromeTrace(const std::string& path) { return profiler().writeChromeTrace(path); }
+
+    SProfileStats stats() {
+        return {profiler().collected.load(std::memory_order_relaxed), profiler().dropped.load(std::memory_order_relaxed)};
+    }
+
+} // namespace Kinetica::Profile
@@ -10,6 +10,9 @@
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -26,6 +29,13 @@ static std::string readFile(const std::string& path) {
     return buffer.str();
 }
 
+// Inserts `defines` right after the #version line.
+static std::string withDefines(const std::string& source, const std::string& defines) {
+    const std::size_t lineEnd = source.find('\n');
+    if (defines.empty() || lineEnd == std::string::npos) return source;
+    return source.substr(0, lineEnd + 1) + defines + source.substr(lineEnd + 1);
+}
+
 static GLuint compileShader(const char* source, GLenum type) {
     GLuint shader = glCreateShader(type);
     glShaderSource(shader, 1, &source, nullptr);
@@ -68,7 +78,7 @@ static GLuint createProgram(const char* vertSrc, const char* fragSrc) {
 
 namespace Kinetica {
 
-    CRenderer::CRenderer(const Kinetica::CWindow& window) {
+    CRenderer::CRenderer(const Kinetica::CWindow& window, const SVertexFormat& format) : m_format(format) {
 
         glfwMakeContextCurrent(window.m_pWindow.get());
 
@@ -85,7 +95,10 @@ namespace Kinetica {
 
         glClearColor(0.0f, 1.0f, 0.615f, 1.0f);
 
-        std::string vertSource = readFile("../shader/basic.vert");
+        // Shaders decode whatever the vertex format encodes.
+        const std::string defines = m_format.octahedralNormals() ? "#define KINETICA_OCTAHEDRAL_NORMALS\n" : "";
+
+        std::string vertSource = withDefines(readFile("../shader/basic.vert"), defines);
         std::string fragSource = readFile("../shader/basic.frag");
 
         if (vertSource.empty() || fragSource.empty()) {
@@ -102,87 +115,449 @@ namespace Kinetica {
         }
 
         m_uModelLoc = glGetUniformLocation(m_shaderProgram, "uModel");
+        m_uPositionScaleLoc = glGetUniformLocation(m_shaderProgram, "uPositionScale");
+        m_uPositionOffsetLoc = glGetUniformLocation(m_shaderProgram, "uPositionOffset");
         m_uBaseColorLoc = glGetUniformLocation(m_shaderProgram, "uBaseColor");
         m_uMetallicLoc = glGetUniformLocation(m_shaderProgram, "uMetallic");
         m_uRoughnessLoc = glGetUniformLocation(m_shaderProgram, "uRoughness");
         m_uUseVertexColorLoc = glGetUniformLocation(m_shaderProgram, "uUseVertexColor");
 
+        m_arena = std::make_unique<CGeometryArena>(m_format.layout());
+
+        // The batched path is optional: without its shader, submit() draws immediately.
+        std::string instancedVert = withDefines(readFile("../shader/instanced.vert"), defines);
+        std::string instancedFrag = readFile("../shader/instanced.frag");
+        if (!instancedVert.empty() && !instancedFrag.empty())
+            m_instancedProgram = createProgram(instancedVert.c_str(), instancedFrag.c_str());
+
+        if (m_instancedProgram) {
+            useProgram(m_instancedProgram);
+            glUniform1i(glGetUniformLocation(m_instancedProgram, "uMaterials"), 0);
+
+            glGenVertexArrays(1, &m_batchVao);
+            glGenBuffers(1, &m_instanceBuffer);
+            glGenBuffers(1, &m_materialBuffer);
+            glGenBuffers(1, &m_indirectBuffer);
+            glGenTextures(1, &m_materialTexture);
+
+            glBindBuffer(GL_TEXTURE_BUFFER, m_materialBuffer);
+            glBufferData(GL_TEXTURE_BUFFER, 2 * sizeof(glm::vec4), nullptr, GL_STREAM_DRAW);
+            glBindTexture(GL_TEXTURE_BUFFER, m_materialTexture);
+            glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, m_materialBuffer);
+
+            // MDI needs base instances to address each command's instance range.
+            m_bMultiDrawIndirect = GLEW_ARB_multi_draw_indirect && GLEW_ARB_base_instance;
+        } else {
+            KLOG_WARN("Instanced shader unavailable, batched draws fall back to one draw per entity");
+        }
+
         m_bValid = true;
     }
 
     CRenderer::~CRenderer() {
-        // Nothing to destroy — OpenGL state is tied to context
+        // The context outlives the renderer; release what the batched path created.
+        if (m_instancedProgram) {
+            glDeleteVertexArrays(1, &m_batchVao);
+            glDeleteBuffers(1, &m_instanceBuffer);
+            glDeleteBuffers(1, &m_materialBuffer);
+            glDeleteBuffers(1, &m_indirectBuffer);
+            glDeleteTextures(1, &m_materialTexture);
+            glDeleteProgram(m_instancedProgram);
+        }
     }
 
     void CRenderer::clear() {
         if (!m_bValid) return;
+        KPROFILE_GPU_SCOPE(m_gpuTimer, "Clear");
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        m_boundVao = 0;
+        m_currentProgram = 0;
+        m_bMaterialCached = false;
+        m_dequantGeometry = 0xFFFFFFFFu;
+        m_stats = {};
+    }
+
+    void CRenderer::useProgram(GLuint program) {
+        if (m_currentProgram == program) return;
+        glUseProgram(program);
+        m_currentProgram = program;
+        m_bMaterialCached = false;
+        ++m_stats.programBinds;
     }
 
     void CRenderer::setViewProjection(const glm::mat4& view, const glm::mat4& proj) {
-        glUseProgram(m_shaderProgram);
+        m_view = view;
+        useProgram(m_shaderProgram);
         glUniformMatrix4fv(glGetUniformLocation(m_shaderProgram, "uView"), 1, GL_FALSE, &view[0][0]);
         glUniformMatrix4fv(glGetUniformLocation(m_shaderProgram, "uProjection"), 1, GL_FALSE, &proj[0][0]);
+        if (m_instancedProgram) {
+            useProgram(m_instancedProgram);
+            glUniformMatrix4fv(glGetUniformLocation(m_instancedProgram, "uView"), 1, GL_FALSE, &view[0][0]);
+            glUniformMatrix4fv(glGetUniformLocation(m_instancedProgram, "uProjection"), 1, GL_FALSE, &proj[0][0]);
+        }
     }
 
     void CRenderer::present() {
-        // This method is a placeholder for future renderer-side post-processing.
+        KPROFILE_GPU_COLLECT(m_gpuTimer);
     }
 
-    void CRenderer::uploadMesh(Kinetica::Components::SMesh& mesh) {
-        if (mesh.vao == 0) {
-            glGenVertexArrays(1, &mesh.vao);
-            glGenBuffers(1, &mesh.vbo);
-            glGenBuffers(1, &mesh.ebo);
-        }
-
-        glBindVertexArray(mesh.vao);
+    const SPositionDequant& CRenderer::dequant(std::uint32_t geometry) const {
+        static const SPositionDequant identity;
+        return geometry < m_dequant.size() ? m_dequant[geometry] : identity;
+    }
 
-        glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
-        glBufferData(GL_ARRAY_BUFFER,
-                     mesh.vertices.size() * sizeof(Kinetica::Components::SVertex),
-                     mesh.vertices.data(),
-                     GL_STATIC_DRAW);
+    void CRenderer::uploadVertexRange(Components::SMesh& mesh, std::uint32_t first, std::uint32_t count) {
+        m_vertexScratch.resize(std::size_t(count) * m_arena->layout().stride);
+        encodeVertices(m_format, std::span(mesh.vertices).subspan(first, count), dequant(mesh.geometry),
+                       m_vertexScratch.data());
+        m_arena->uploadVertices(mesh.geometry, first, count, m_vertexScratch.data());
+    }
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.ebo);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                     mesh.indices.size() * sizeof(Kinetica::Components::SIndex),
-                     mesh.indices.data(),
-                     GL_STATIC_DRAW);
+    void CRenderer::uploadIndexRange(Components::SMesh& mesh, std::uint32_t firstTriangle, std::uint32_t triangleCount) {
+        const auto* indices = reinterpret_cast<const std::uint32_t*>(mesh.indices.data()) + firstTriangle * 3;
+        const CGeometryArena::SAllocation* a = m_arena->allocation(mesh.geometry);
+        if (a->indexType == GL_UNSIGNED_INT) {
+            m_arena->uploadIndices(mesh.geometry, firstTriangle * 3, triangleCount * 3, indices);
+            return;
+        }
+        m_indexScratch.resize(std::size_t(triangleCount) * 3);
+        for (std::size_t i = 0; i < m_indexScratch.size(); ++i) m_indexScratch[i] = static_cast<std::uint16_t>(indices[i]);
+        m_arena->uploadIndices(mesh.geometry, firstTriangle * 3, triangleCount * 3, m_indexScratch.data());
+    }
 
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Kinetica::Components::SVertex), (void*)0);
-        glEnableVertexAttribArray(0);
+    void CRenderer::uploadMesh(Kinetica::Components::SMesh& mesh) {
+        if (!m_arena) return;
+
+        const auto vertexCount = static_cast<std::uint32_t>(mesh.vertices.size());
+        const auto triangleCount = static_cast<std::uint32_t>(mesh.indices.size());
+        bool full = mesh.isDirty;
+
+        // Quantized positions: an edit that leaves the quantization box forces a
+        // full re-encode against a box with some room to grow.
+        const bool quantized = m_format.position == EPositionEncoding::Unorm16;
+        bool requantize = false;
+        if (quantized && !full && m_arena->allocation(mesh.geometry)) {
+            const SPositionDequant& current = dequant(mesh.geometry);
+            auto escapes = [&](std::uint32_t begin, std::uint32_t end) {
+                for (std::uint32_t i = begin; i < std::min(end, vertexCount); ++i) {
+                    const Components::SVertex& v = mesh.vertices[i];
+                    if (!current.covers(glm::vec3(v.x, v.y, v.z))) return true;
+                }
+                return false;
+            };
+            requantize = escapes(mesh.uploadedVertices, vertexCount);
+            for (std::uint32_t i = 0; i < mesh.dirtyVertices.count && !requantize; ++i)
+                requantize = escapes(mesh.dirtyVertices.ranges[i].begin, mesh.dirtyVertices.ranges[i].end);
+            full = full || requantize;
+        }
 
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Kinetica::Components::SVertex), (void*)(3 * sizeof(float)));
-        glEnableVertexAttribArray(1);
+        // Only reallocate when the range has to grow; edited meshes get 50% headroom.
+        if (!m_arena->allocation(mesh.geometry) || vertexCount > mesh.vertexCapacity ||
+            triangleCount > mesh.indexCapacity) {
+            const bool first = !m_arena->allocation(mesh.geometry);
+            const std::uint32_t vertexCapacity =
+                first ? vertexCount : std::max(vertexCount, mesh.vertexCapacity + mesh.vertexCapacity / 2);
+            const std::uint32_t indexCapacity =
+                first ? triangleCount : std::max(triangleCount, mesh.indexCapacity + mesh.indexCapacity / 2);
+            // 16-bit indices whenever every vertex the range can hold is addressable.
+            const GLenum indexType = m_format.indexType(vertexCapacity);
+
+            bool ok;
+            if (first) {
+                mesh.geometry = m_arena->allocate(vertexCapacity, indexCapacity * 3, indexType);
+                ok = mesh.geometry != CGeometryArena::INVALID_HANDLE;
+            } else {
+                ok = m_arena->reallocate(mesh.geometry, vertexCapacity, indexCapacity * 3, indexType);
+            }
+            if (!ok) {
+                KLOG_ERROR("Failed to allocate mesh geometry");
+                mesh.geometry = CGeometryArena::INVALID_HANDLE;
+                mesh.vertexCapacity = mesh.indexCapacity = 0;
+                mesh.uploadedVertices = mesh.uploadedIndices = 0;
+                return;
+            }
+            mesh.vertexCapacity = vertexCapacity;
+            mesh.indexCapacity = indexCapacity;
+            full = true;
+        }
 
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Kinetica::Components::SVertex), (void*)(6 * sizeof(float)));
-        glEnableVertexAttribArray(2);
+        if (mesh.geometry >= m_dequant.size()) m_dequant.resize(mesh.geometry + 1);
+        m_dequantGeometry = 0xFFFFFFFFu;
+
+        if (full) {
+            if (quantized) {
+                Math::SAABB bounds = mesh.localBounds;
+                if (mesh.boundsDirty) {
+                    bounds = Math::SAABB{};
+                    for (const Components::SVertex& v : mesh.vertices) bounds.expand(glm::vec3(v.x, v.y, v.z));
+                }
+                m_dequant[mesh.geometry] = SPositionDequant::fromBounds(bounds, requantize ? 0.125f : 0.0f);
+            }
+            if (vertexCount > 0) uploadVertexRange(mesh, 0, vertexCount);
+            if (triangleCount > 0) uploadIndexRange(mesh, 0, triangleCount);
+        } else {
+            if (vertexCount > mesh.uploadedVertices) mesh.dirtyVertices.add(mesh.uploadedVertices, vertexCount);
+            if (triangleCount > mesh.uploadedIndices) mesh.dirtyIndices.add(mesh.uploadedIndices, triangleCount);
+
+            for (std::uint32_t i = 0; i < mesh.dirtyVertices.count; ++i) {
+                const auto& r = mesh.dirtyVertices.ranges[i];
+                const std::uint32_t end = std::min(r.end, vertexCount);
+                if (r.begin < end) uploadVertexRange(mesh, r.begin, end - r.begin);
+            }
+            for (std::uint32_t i = 0; i < mesh.dirtyIndices.count; ++i) {
+                const auto& r = mesh.dirtyIndices.ranges[i];
+                const std::uint32_t end = std::min(r.end, triangleCount);
+                if (r.begin < end) uploadIndexRange(mesh, r.begin, end - r.begin);
+            }
+        }
 
-        glBindVertexArray(0);
+        mesh.uploadedVertices = vertexCount;
+        mesh.uploadedIndices = triangleCount;
+        mesh.dirtyVertices.clear();
+        mesh.dirtyIndices.clear();
         mesh.isDirty = false;
+        m_boundVao = 0; // growth/defragmentation may have touched the arena VAO
+    }
+
+    void CRenderer::releaseMesh(Kinetica::Components::SMesh& mesh) {
+        if (m_arena) m_arena->free(mesh.geometry);
+        mesh.geometry = CGeometryArena::INVALID_HANDLE;
+        mesh.vertexCapacity = mesh.indexCapacity = 0;
+        mesh.uploadedVertices = mesh.uploadedIndices = 0;
+        mesh.isDirty = true;
     }
 
     void CRenderer::renderEntity(const Components::STransform& transform,
                                  const Components::SMesh& mesh,
                                  const Components::SMaterial& material) {
-        if (!m_bValid || mesh.vao == 0) return;
+        renderEntity(transform.getMatrix(), mesh, material);
+    }
+
+    void CRenderer::renderEntity(const glm::mat4& model,
+                                 const Components::SMesh& mesh,
+                                 const Components::SMaterial& material) {
+        // Draw what is on the GPU; CPU-side edits may not be uploaded yet.
+        drawImmediate(model, mesh.geometry, mesh.uploadedIndices * 3, mesh.uploadedVertices, material);
+    }
 
-        glUseProgram(m_shaderProgram);
+    void CRenderer::drawImmediate(const glm::mat4& model, std::uint32_t geometry,
+                                  std::uint32_t indexCount, std::uint32_t vertexCount,
+                                  const Components::SMaterial& material) {
+        if (!m_bValid || !m_arena || !m_arena->allocation(geometry)) return;
 
-        glUniformMatrix4fv(m_uModelLoc, 1, GL_FALSE, &transform.getMatrix()[0][0]);
-        glUniform3fv(m_uBaseColorLoc, 1, &material.baseColor[0]);
-        glUniform1f(m_uMetallicLoc, material.metallic);
-        glUniform1f(m_uRoughnessLoc, material.roughness);
-        glUniform1i(m_uUseVertexColorLoc, material.useVertexColor ? 1 : 0);
+        useProgram(m_shaderProgram);
 
-        glBindVertexArray(mesh.vao);
-        if (mesh.indexCount() > 0) {
-            glDrawElements(GL_TRIANGLES, mesh.indexCount(), GL_UNSIGNED_INT, 0);
-        } else {
-            glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount());
+        glUniformMatrix4fv(m_uModelLoc, 1, GL_FALSE, &model[0][0]);
+        if (m_dequantGeometry != geometry) {
+            const SPositionDequant& d = dequant(geometry);
+            glUniform3fv(m_uPositionScaleLoc, 1, &d.scale[0]);
+            glUniform3fv(m_uPositionOffsetLoc, 1, &d.offset[0]);
+            m_dequantGeometry = geometry;
+        }
+
+        const glm::vec4 materialA(material.baseColor, material.metallic);
+        const glm::vec4 materialB(material.roughness, material.useVertexColor ? 1.0f : 0.0f, 0.0f, 0.0f);
+        if (!m_bMaterialCached || m_cachedMaterialA != materialA || m_cachedMaterialB != materialB) {
+            glUniform3fv(m_uBaseColorLoc, 1, &material.baseColor[0]);
+            glUniform1f(m_uMetallicLoc, material.metallic);
+            glUniform1f(m_uRoughnessLoc, material.roughness);
+            glUniform1i(m_uUseVertexColorLoc, material.useVertexColor ? 1 : 0);
+            m_cachedMaterialA = materialA;
+            m_cachedMaterialB = materialB;
+            m_bMaterialCached = true;
+            ++m_stats.materialUploads;
+        }
+
+        // Every mesh lives in the one arena VAO: bind it once per frame.
+        if (m_boundVao != m_arena->vao()) {
+            m_arena->bind();
+            m_boundVao = m_arena->vao();
         }
-        glBindVertexArray(0);
+        m_arena->draw(geometry, indexCount, vertexCount);
+        ++m_stats.drawCalls;
+        ++m_stats.instances;
+    }
+
+    // ---- Batched submission ----
+
+    void CRenderer::submit(const glm::mat4& model,
+                           const Components::SMesh& mesh,
+                           const Components::SMaterial& material) {
+        if (!m_bValid || !m_arena || !m_arena->allocation(mesh.geometry)) return;
+
+        constexpr std::uint32_t SHADER_INSTANCED = 0;
+        constexpr std::uint32_t SHADER_BASIC = 1;
+        const std::uint32_t depth = DrawKey::depthBucket(-(m_view * model[3]).z);
+        const std::uint32_t materialHash = DrawKey::materialHash(material);
+
+        // Instanced draws carry the material per instance, so the mesh takes the
+        // more significant slot and each mesh sorts into one contiguous batch.
+        const std::uint64_t key = m_instancedProgram
+            ? DrawKey::make(0, SHADER_INSTANCED, mesh.geometry, materialHash, depth)
+            : DrawKey::make(0, SHADER_BASIC, materialHash, mesh.geometry, depth);
+
+        m_queue.push(key, {model, mesh.geometry, mesh.uploadedIndices * 3, mesh.uploadedVertices, &material});
+    }
+
+    void CRenderer::setInstanceAttributes(std::size_t firstInstance) {
+        constexpr GLsizei stride = sizeof(SInstanceData);
+        const std::size_t base = firstInstance * sizeof(SInstanceData);
+        glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+        for (GLuint column = 0; column < 4; ++column) {
+            glVertexAttribPointer(3 + column, 4, GL_FLOAT, GL_FALSE, stride,
+                                  reinterpret_cast<const void*>(base + offsetof(SInstanceData, model) + column * sizeof(glm::vec4)));
+            glVertexAttribDivisor(3 + column, 1);
+            glEnableVertexAttribArray(3 + column);
+        }
+        glVertexAttribIPointer(7, 1, GL_UNSIGNED_INT, stride,
+                               reinterpret_cast<const void*>(base + offsetof(SInstanceData, material)));
+        glVertexAttribDivisor(7, 1);
+        glEnableVertexAttribArray(7);
+        glVertexAttribPointer(8, 3, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<const void*>(base + offsetof(SInstanceData, positionOffset)));
+        glVertexAttribPointer(9, 3, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<const void*>(base + offsetof(SInstanceData, positionScale)));
+        for (GLuint location = 8; location <= 9; ++location) {
+            glVertexAttribDivisor(location, 1);
+            glEnableVertexAttribArray(location);
+        }
+    }
+
+    void CRenderer::flushBatches() {
+        m_queue.sort();
+        if (m_queue.size() == 0) return;
+        KPROFILE_GPU_SCOPE(m_gpuTimer, "Draw batches");
+
+        if (!m_instancedProgram) {
+            for (std::size_t i = 0; i < m_queue.size(); ++i) {
+                const SRenderCommand& command = m_queue.command(i);
+                drawImmediate(command.model, command.geometry, command.indexCount, command.vertexCount,
+                              *command.material);
+            }
+            m_queue.clear();
+            return;
+        }
+
+        // Walk the sorted queue: a new batch whenever the mesh changes, a new
+        // material entry whenever the material changes within it.
+        m_batchList.clear();
+        m_materialTexels.clear();
+        m_batchList.instances.resize(m_queue.size());
+        std::size_t instanceCount = 0;
+        for (std::size_t i = 0; i < m_queue.size(); ++i) {
+            const SRenderCommand& command = m_queue.command(i);
+            if (m_batchList.batches.empty() || m_batchList.batches.back().geometry != command.geometry) {
+                m_batchList.batches.push_back({command.geometry, command.indexCount, command.vertexCount,
+                                               static_cast<std::uint32_t>(instanceCount), 0});
+            }
+            const glm::vec4 a(command.material->baseColor, command.material->metallic);
+            const glm::vec4 b(command.material->roughness, command.material->useVertexColor ? 1.0f : 0.0f, 0.0f, 0.0f);
+            if (m_materialTexels.empty() || m_materialTexels[m_materialTexels.size() - 2] != a ||
+                m_materialTexels.back() != b) {
+                m_materialTexels.push_back(a);
+                m_materialTexels.push_back(b);
+            }
+
+            const SPositionDequant& d = dequant(command.geometry);
+            SInstanceData& instance = m_batchList.instances[instanceCount++];
+            instance.model = command.model;
+            instance.material = static_cast<std::uint32_t>(m_materialTexels.size() / 2 - 1);
+            instance.positionOffset = d.offset;
+            instance.positionScale = d.scale;
+            ++m_batchList.batches.back().instanceCount;
+        }
+        m_queue.clear();
+
+        // Instances: orphan and refill, growing geometrically.
+        const std::size_t bytes = m_batchList.instances.size() * sizeof(SInstanceData);
+        glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+        if (bytes > m_instanceCapacity) m_instanceCapacity = std::max(bytes, m_instanceCapacity * 2);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_instanceCapacity), nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(bytes), m_batchList.instances.data());
+
+        glBindBuffer(GL_TEXTURE_BUFFER, m_materialBuffer);
+        glBufferData(GL_TEXTURE_BUFFER, static_cast<GLsizeiptr>(m_materialTexels.size() * sizeof(glm::vec4)),
+                     m_materialTexels.data(), GL_STREAM_DRAW);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_BUFFER, m_materialTexture);
+
+        useProgram(m_instancedProgram);
+        glBindVertexArray(m_batchVao);
+        m_boundVao = m_batchVao;
+        if (m_batchVaoGeneration != m_arena->generation()) {
+            m_arena->attachTo();
+            m_batchVaoGeneration = m_arena->generation();
+        }
+
+        struct SDrawElementsIndirectCommand {
+            GLuint count;
+            GLuint instanceCount;
+            GLuint firstIndex;
+            GLint baseVertex;
+            GLuint baseInstance;
+        };
+
+        std::size_t drawn = 0;
+        if (m_bMultiDrawIndirect) {
+            // One indirect draw per index type; 16-bit commands first.
+            static thread_local std::vector<SDrawElementsIndirectCommand> commands;
+            commands.clear();
+            std::size_t shortCommands = 0;
+            for (GLenum type : {GLenum(GL_UNSIGNED_SHORT), GLenum(GL_UNSIGNED_INT)}) {
+                for (const SDrawBatch& batch : m_batchList.batches) {
+                    const CGeometryArena::SAllocation* a = m_arena->allocation(batch.geometry);
+                    if (!a || batch.indexCount == 0 || a->indexType != type) continue;
+                    commands.push_back({batch.indexCount, batch.instanceCount, a->indexOffset,
+                                        static_cast<GLint>(a->vertexOffset), batch.firstInstance});
+                }
+                if (type == GL_UNSIGNED_SHORT) shortCommands = commands.size();
+            }
+            if (!commands.empty()) {
+                setInstanceAttributes(0);
+                glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBuffer);
+                glBufferData(GL_DRAW_INDIRECT_BUFFER,
+                             static_cast<GLsizeiptr>(commands.size() * sizeof(SDrawElementsIndirectCommand)),
+                             commands.data(), GL_STREAM_DRAW);
+                if (shortCommands > 0) {
+                    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, nullptr,
+                                                static_cast<GLsizei>(shortCommands), 0);
+                    ++m_stats.drawCalls;
+                }
+                if (commands.size() > shortCommands) {
+                    glMultiDrawElementsIndirect(
+                        GL_TRIANGLES, GL_UNSIGNED_INT,
+                        reinterpret_cast<const void*>(shortCommands * sizeof(SDrawElementsIndirectCommand)),
+                        static_cast<GLsizei>(commands.size() - shortCommands), 0);
+                    ++m_stats.drawCalls;
+                }
+                drawn = commands.size();
+            }
+        }
+
+        // One instanced draw per mesh (everything when MDI is unavailable,
+        // otherwise only the non-indexed leftovers).
+        if (drawn < m_batchList.batches.size()) {
+            for (const SDrawBatch& batch : m_batchList.batches) {
+                const CGeometryArena::SAllocation* a = m_arena->allocation(batch.geometry);
+                if (!a || (m_bMultiDrawIndirect && batch.indexCount > 0)) continue;
+
+                setInstanceAttributes(batch.firstInstance);
+                if (batch.indexCount > 0) {
+                    glDrawElementsInstancedBaseVertex(
+                        GL_TRIANGLES, static_cast<GLsizei>(batch.indexCount), a->indexType,
+                        reinterpret_cast<const void*>(std::uintptr_t(a->indexByteOffset())),
+                        static_cast<GLsizei>(batch.instanceCount), static_cast<GLint>(a->vertexOffset));
+                } else {
+                    glDrawArraysInstanced(GL_TRIANGLES, static_cast<GLint>(a->vertexOffset),
+                                          static_cast<GLsizei>(batch.vertexCount),
+                                          static_cast<GLsizei>(batch.instanceCount));
+                }
+                ++m_stats.drawCalls;
+            }
+        }
+
+        m_stats.instances += static_cast<std::uint32_t>(m_batchList.instances.size());
+        m_stats.batches += static_cast<std::uint32_t>(m_batchList.batches.size());
     }
 
 } // namespace Kinetica
@@ -0,0 +1,34 @@
+#include <kinetica/rendering/batching.hpp>
+#include <kinetica/rendering/render_queue.hpp>
+
+namespace Kinetica {
+
+    void buildBatches(std::span<const SDrawItem> items, SBatchList& out) {
+        out.clear();
+        if (items.empty()) return;
+
+        // Radix-sort small (key, item) pairs rather than the 80-byte items themselves.
+        static thread_local std::vector<SSortEntry> keys;
+        static thread_local std::vector<SSortEntry> scratch;
+        keys.resize(items.size());
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            keys[i] = {(std::uint64_t(items[i].geometry) << 32) | items[i].material, static_cast<std::uint32_t>(i)};
+        }
+        radixSort(keys, scratch);
+
+        out.instances.resize(items.size());
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            const SDrawItem& item = items[keys[i].value];
+            SInstanceData& instance = out.instances[i];
+            instance.model = item.model;
+            instance.material = item.material;
+
+            if (out.batches.empty() || out.batches.back().geometry != item.geometry) {
+                out.batches.push_back({item.geometry, item.indexCount, item.vertexCount,
+                                       static_cast<std::uint32_t>(i), 0});
+            }
+            ++out.batches.back().instanceCount;
+        }
+    }
+
+} // namespace Kinetica
@@ -0,0 +1,342 @@
+#include <kinetica/rendering/geometry_arena.hpp>
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace Kinetica {
+
+    // ---- CRangeAllocator ----
+
+    CRangeAllocator::CRangeAllocator(std::uint32_t capacity) { reset(capacity, 0); }
+
+    void CRangeAllocator::insertFree(std::uint32_t offset, std::uint32_t size) {
+        m_byOffset.emplace(offset, size);
+        m_bySize.emplace(size, offset);
+    }
+
+    void CRangeAllocator::eraseFree(std::map<std::uint32_t, std::uint32_t>::iterator it) {
+        auto [first, last] = m_bySize.equal_range(it->second);
+        for (auto s = first; s != last; ++s) {
+            if (s->second == it->first) {
+                m_bySize.erase(s);
+                break;
+            }
+        }
+        m_byOffset.erase(it);
+    }
+
+    std::uint32_t CRangeAllocator::allocate(std::uint32_t size, std::uint32_t alignment) {
+        if (size == 0) return 0;
+        // Smallest block that still fits once its start is aligned.
+        for (auto best = m_bySize.lower_bound(size); best != m_bySize.end(); ++best) {
+            const std::uint32_t blockOffset = best->second;
+            const std::uint32_t blockSize = best->first;
+            const std::uint32_t offset = (blockOffset + alignment - 1) / alignment * alignment;
+            const std::uint32_t padding = offset - blockOffset;
+            if (blockSize < size + padding) continue;
+
+            m_bySize.erase(best);
+            m_byOffset.erase(blockOffset);
+            if (padding > 0) insertFree(blockOffset, padding);
+            if (blockSize > size + padding) insertFree(offset + size, blockSize - size - padding);
+            m_free -= size;
+            return offset;
+        }
+        return INVALID_OFFSET;
+    }
+
+    void CRangeAllocator::free(std::uint32_t offset, std::uint32_t size) {
+        if (size == 0) return;
+        m_free += size;
+
+        auto next = m_byOffset.lower_bound(offset);
+        if (next != m_byOffset.end() && offset + size == next->first) {
+            size += next->second;
+            auto after = std::next(next);
+            eraseFree(next);
+            next = after;
+        }
+        if (next != m_byOffset.begin()) {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == offset) {
+                offset = prev->first;
+                size += prev->second;
+                eraseFree(prev);
+            }
+        }
+        insertFree(offset, size);
+    }
+
+    void CRangeAllocator::grow(std::uint32_t capacity) {
+        if (capacity <= m_capacity) return;
+        const std::uint32_t old = m_capacity;
+        m_capacity = capacity;
+        free(old, capacity - old);
+    }
+
+    void CRangeAllocator::reset(std::uint32_t capacity, std::uint32_t used) {
+        m_byOffset.clear();
+        m_bySize.clear();
+        m_capacity = capacity;
+        m_free = capacity - std::min(used, capacity);
+        if (m_free > 0) insertFree(capacity - m_free, m_free);
+    }
+
+    std::uint32_t CRangeAllocator::largestFreeBlock() const {
+        return m_bySize.empty() ? 0 : std::prev(m_bySize.end())->first;
+    }
+
+    // ---- CGeometryArena ----
+
+    static GLuint createBuffer(std::size_t bytes) {
+        GLuint buffer = 0;
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(bytes), nullptr, GL_DYNAMIC_DRAW);
+        return buffer;
+    }
+
+    static void copyBuffer(GLuint src, GLuint dst, std::size_t srcOffset, std::size_t dstOffset, std::size_t bytes) {
+        if (bytes == 0) return;
+        glBindBuffer(GL_COPY_READ_BUFFER, src);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, dst);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(srcOffset),
+                            static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(bytes));
+    }
+
+    CGeometryArena::CGeometryArena(SVertexLayout layout, std::uint32_t initialVertices, std::uint32_t initialIndices)
+        : m_layout(std::move(layout)), m_vertices(initialVertices),
+          m_indices(initialIndices * (sizeof(std::uint32_t) / INDEX_UNIT)) {
+        glGenVertexArrays(1, &m_vao);
+        m_vbo = createBuffer(std::size_t(initialVertices) * m_layout.stride);
+        m_ebo = createBuffer(std::size_t(m_indices.capacity()) * INDEX_UNIT);
+        attachBuffers();
+    }
+
+    CGeometryArena::~CGeometryArena() {
+        glDeleteVertexArrays(1, &m_vao);
+        glDeleteBuffers(1, &m_vbo);
+        glDeleteBuffers(1, &m_ebo);
+    }
+
+    void CGeometryArena::attachTo() const {
+        glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+        for (const SVertexAttribute& a : m_layout.attributes) {
+            if (a.type == GL_FLOAT || a.type == GL_HALF_FLOAT || a.normalized) {
+                glVertexAttribPointer(a.location, a.components, a.type, a.normalized,
+                                      static_cast<GLsizei>(m_layout.stride),
+                                      reinterpret_cast<const void*>(static_cast<std::uintptr_t>(a.offset)));
+            } else {
+                glVertexAttribIPointer(a.location, a.components, a.type, static_cast<GLsizei>(m_layout.stride),
+                                       reinterpret_cast<const void*>(static_cast<std::uintptr_t>(a.offset)));
+            }
+            glEnableVertexAttribArray(a.location);
+        }
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
+    }
+
+    void CGeometryArena::attachBuffers() {
+        glBindVertexArray(m_vao);
+        attachTo();
+        glBindVertexArray(0);
+        ++m_generation;
+    }
+
+    void CGeometryArena::growVertices(std::uint32_t required) {
+        const std::uint32_t old = m_vertices.capacity();
+        const std::uint32_t capacity = std::max(old * 2, old + required);
+        const GLuint buffer = createBuffer(std::size_t(capacity) * m_layout.stride);
+        copyBuffer(m_vbo, buffer, 0, 0, std::size_t(old) * m_layout.stride);
+        glDeleteBuffers(1, &m_vbo);
+        m_vbo = buffer;
+        m_vertices.grow(capacity);
+        attachBuffers();
+    }
+
+    void CGeometryArena::growIndices(std::uint32_t requiredUnits) {
+        const std::uint32_t old = m_indices.capacity();
+        const std::uint32_t capacity = std::max(old * 2, old + requiredUnits);
+        const GLuint buffer = createBuffer(std::size_t(capacity) * INDEX_UNIT);
+        copyBuffer(m_ebo, buffer, 0, 0, std::size_t(old) * INDEX_UNIT);
+        glDeleteBuffers(1, &m_ebo);
+        m_ebo = buffer;
+        m_indices.grow(capacity);
+        attachBuffers();
+    }
+
+    std::uint32_t CGeometryArena::allocate(std::uint32_t vertexCount, std::uint32_t indexCount, GLenum indexType) {
+        const std::uint32_t unitsPerIndex = indexSize(indexType) / INDEX_UNIT;
+        const std::uint32_t indexUnits = indexCount * unitsPerIndex;
+
+        // Enough space but no single block for it: compact before growing.
+        auto splintered = [](const CRangeAllocator& a, std::uint32_t size) {
+            return a.largestFreeBlock() < size && a.freeSpace() >= size + size / 2;
+        };
+        if (splintered(m_vertices, vertexCount) || splintered(m_indices, indexUnits)) defragment();
+
+        std::uint32_t vertexOffset = m_vertices.allocate(vertexCount);
+        if (vertexOffset == CRangeAllocator::INVALID_OFFSET) {
+            growVertices(vertexCount);
+            vertexOffset = m_vertices.allocate(vertexCount);
+        }
+        std::uint32_t indexOffset = m_indices.allocate(indexUnits, unitsPerIndex);
+        if (indexOffset == CRangeAllocator::INVALID_OFFSET) {
+            growIndices(indexUnits + unitsPerIndex);
+            indexOffset = m_indices.allocate(indexUnits, unitsPerIndex);
+        }
+        if (vertexOffset == CRangeAllocator::INVALID_OFFSET || indexOffset == CRangeAllocator::INVALID_OFFSET) {
+            KLOG_ERROR("Geometry arena allocation of " + std::to_string(vertexCount) + " vertices / " +
+                       std::to_string(indexCount) + " indices failed");
+            if (vertexOffset != CRangeAllocator::INVALID_OFFSET) m_vertices.free(vertexOffset, vertexCount);
+            if (indexOffset != CRangeAllocator::INVALID_OFFSET) m_indices.free(indexOffset, indexUnits);
+            return INVALID_HANDLE;
+        }
+
+        std::uint32_t handle;
+        if (!m_freeHandles.empty()) {
+            handle = m_freeHandles.back();
+            m_freeHandles.pop_back();
+        } else {
+            handle = static_cast<std::uint32_t>(m_allocations.size());
+            m_allocations.emplace_back();
+        }
+        m_allocations[handle] = {vertexOffset, vertexCount, indexOffset / unitsPerIndex, indexCount, indexType, true};
+        ++m_liveCount;
+        return handle;
+    }
+
+    bool CGeometryArena::reallocate(std::uint32_t handle, std::uint32_t vertexCount, std::uint32_t indexCount,
+                                    GLenum indexType) {
+        if (!allocation(handle)) return false;
+        free(handle);
+        const std::uint32_t fresh = allocate(vertexCount, indexCount, indexType);
+        if (fresh == INVALID_HANDLE) return false;
+        // Keep the caller's handle: free() pushed it, allocate() popped it back.
+        if (fresh != handle) {
+            m_allocations[handle] = m_allocations[fresh];
+            m_allocations[fresh].live = false;
+            m_freeHandles.push_back(fresh);
+        }
+        return true;
+    }
+
+    void CGeometryArena::free(std::uint32_t handle) {
+        if (!allocation(handle)) return;
+        SAllocation& a = m_allocations[handle];
+        m_vertices.free(a.vertexOffset, a.vertexCapacity);
+        const std::uint32_t unitsPerIndex = indexSize(a.indexType) / INDEX_UNIT;
+        m_indices.free(a.indexOffset * unitsPerIndex, a.indexCapacity * unitsPerIndex);
+        a.live = false;
+        m_freeHandles.push_back(handle);
+        --m_liveCount;
+    }
+
+    const CGeometryArena::SAllocation* CGeometryArena::allocation(std::uint32_t handle) const {
+        if (handle >= m_allocations.size() || !m_allocations[handle].live) return nullptr;
+        return &m_allocations[handle];
+    }
+
+    void CGeometryArena::uploadVertices(std::uint32_t handle, std::uint32_t first, std::uint32_t count, const void* data) {
+        const SAllocation* a = allocation(handle);
+        if (!a || count == 0 || first + count > a->vertexCapacity) return;
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_vbo);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(std::size_t(a->vertexOffset + first) * m_layout.stride),
+                        static_cast<GLsizeiptr>(std::size_t(count) * m_layout.stride), data);
+    }
+
+    void CGeometryArena::uploadIndices(std::uint32_t handle, std::uint32_t first, std::uint32_t count, const void* data) {
+        const SAllocation* a = allocation(handle);
+        if (!a || count == 0 || first + count > a->indexCapacity) return;
+        const std::size_t size = indexSize(a->indexType);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, m_ebo);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(a->indexByteOffset() + first * size),
+                        static_cast<GLsizeiptr>(count * size), data);
+    }
+
+    void CGeometryArena::defragment() {
+        std::vector<std::uint32_t> live;
+        live.reserve(m_liveCount);
+        for (std::uint32_t h = 0; h < m_allocations.size(); ++h)
+            if (m_allocations[h].live) live.push_back(h);
+
+        // Packing in offset order keeps neighbouring meshes neighbours.
+        // units(a) is an allocation's size in allocator units, offset(a) its
+        // offset in those units; allocations are placed back to back.
+        auto pack = [&](GLuint& buffer, CRangeAllocator& allocator, std::size_t unitBytes, auto&& order, auto&& units,
+                        auto&& offset) {
+            std::sort(live.begin(), live.end(), [&](std::uint32_t a, std::uint32_t b) {
+                return order(m_allocations[a], m_allocations[b]);
+            });
+            const GLuint packed = createBuffer(std::size_t(allocator.capacity()) * unitBytes);
+            std::uint32_t cursor = 0;
+            for (std::uint32_t h : live) {
+                SAllocation& a = m_allocations[h];
+                copyBuffer(buffer, packed, std::size_t(offset(a)) * unitBytes, std::size_t(cursor) * unitBytes,
+                           std::size_t(units(a)) * unitBytes);
+                offset(a) = cursor;
+                cursor += units(a);
+            }
+            glDeleteBuffers(1, &buffer);
+            buffer = packed;
+            allocator.reset(allocator.capacity(), cursor);
+        };
+
+        pack(m_vbo, m_vertices, m_layout.stride,
+             [](const SAllocation& a, const SAllocation& b) { return a.vertexOffset < b.vertexOffset; },
+             [](const SAllocation& a) { return a.vertexCapacity; },
+             [](SAllocation& a) -> std::uint32_t& { return a.vertexOffset; });
+
+        // 32-bit ranges go first: their sizes are even, so they all stay aligned
+        // and no padding is needed. Offsets are converted to units and back.
+        for (std::uint32_t h : live) {
+            SAllocation& a = m_allocations[h];
+            a.indexOffset *= indexSize(a.indexType) / INDEX_UNIT;
+        }
+        pack(m_ebo, m_indices, INDEX_UNIT,
+             [](const SAllocation& a, const SAllocation& b) {
+                 if (a.indexType != b.indexType) return a.indexType == GL_UNSIGNED_INT;
+                 return a.indexOffset < b.indexOffset;
+             },
+             [](const SAllocation& a) { return a.indexCapacity * (indexSize(a.indexType) / INDEX_UNIT); },
+             [](SAllocation& a) -> std::uint32_t& { return a.indexOffset; });
+        for (std::uint32_t h : live) {
+            SAllocation& a = m_allocations[h];
+            a.indexOffset /= indexSize(a.indexType) / INDEX_UNIT;
+        }
+        attachBuffers();
+    }
+
+    std::size_t CGeometryArena::capacityBytes() const {
+        return std::size_t(m_vertices.capacity()) * m_layout.stride + std::size_t(m_indices.capacity()) * INDEX_UNIT;
+    }
+
+    std::size_t CGeometryArena::usedBytes() const {
+        return std::size_t(m_vertices.capacity() - m_vertices.freeSpace()) * m_layout.stride +
+               std::size_t(m_indices.capacity() - m_indices.freeSpace()) * INDEX_UNIT;
+    }
+
+    float CGeometryArena::fragmentation() const {
+        auto ratio = [](const CRangeAllocator& a) {
+            return a.freeSpace() == 0 ? 0.0f
+                                      : 1.0f - static_cast<float>(a.largestFreeBlock()) / static_cast<float>(a.freeSpace());
+        };
+        return std::max(ratio(m_vertices), ratio(m_indices));
+    }
+
+    void CGeometryArena::draw(std::uint32_t handle, std::uint32_t indexCount, std::uint32_t vertexCount) const {
+        const SAllocation* a = allocation(handle);
+        if (!a) return;
+        if (indexCount > 0) {
+            glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(std::min(indexCount, a->indexCapacity)),
+                                     a->indexType, reinterpret_cast<const void*>(std::uintptr_t(a->indexByteOffset())),
+                                     static_cast<GLint>(a->vertexOffset));
+        } else {
+            glDrawArrays(GL_TRIANGLES, static_cast<GLint>(a->vertexOffset),
+                         static_cast<GLsizei>(std::min(vertexCount, a->vertexCapacity)));
+        }
+    }
+
+} // namespace Kinetica
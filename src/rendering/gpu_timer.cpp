@@ -0,0 +1,49 @@
+#include <kinetica/rendering/gpu_timer.hpp>
+
+namespace Kinetica {
+
+    CGpuTimer::~CGpuTimer() {
+        for (const SPending& pending : m_pending) m_free.push_back(pending.query);
+        if (!m_free.empty()) glDeleteQueries(static_cast<GLsizei>(m_free.size()), m_free.data());
+    }
+
+    void CGpuTimer::begin(const char* name) {
+        if (m_open || !Profile::enabled() || m_pending.size() >= MAX_IN_FLIGHT) return;
+        if (!GLEW_VERSION_3_3 && !GLEW_ARB_timer_query) return;
+
+        GLuint query = 0;
+        if (m_free.empty()) {
+            glGenQueries(1, &query);
+        } else {
+            query = m_free.back();
+            m_free.pop_back();
+        }
+        glBeginQuery(GL_TIME_ELAPSED, query);
+        m_pending.push_back({query, name, Profile::now()});
+        m_open = true;
+    }
+
+    void CGpuTimer::end() {
+        if (!m_open) return;
+        glEndQuery(GL_TIME_ELAPSED);
+        m_open = false;
+    }
+
+    void CGpuTimer::collect() {
+        while (m_pending.size() > (m_open ? 1u : 0u)) {
+            const SPending& pending = m_pending.front();
+            GLint available = 0;
+            glGetQueryObjectiv(pending.query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) break; // later queries finish later
+
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(pending.query, GL_QUERY_RESULT, &elapsed);
+            // The GPU track is anchored at submission time; only the
+            // duration is measured on the GPU.
+            Profile::recordGpu(pending.name, pending.cpuBegin, elapsed);
+            m_free.push_back(pending.query);
+            m_pending.pop_front();
+        }
+    }
+
+} // namespace Kinetica
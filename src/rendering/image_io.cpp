@@ -0,0 +1,304 @@
+#include <kinetica/rendering/image_io.hpp>
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Kinetica {
+
+    namespace {
+
+        // ---- Deflate (RFC 1951) with the fixed Huffman code ----
+
+        class CBitWriter {
+        public:
+            explicit CBitWriter(std::vector<std::uint8_t>& out) : m_out(out) {}
+
+            void put(std::uint32_t bits, std::uint32_t count) {
+                m_buffer |= std::uint64_t(bits) << m_count;
+                m_count += count;
+                while (m_count >= 8) {
+                    m_out.push_back(static_cast<std::uint8_t>(m_buffer));
+                    m_buffer >>= 8;
+                    m_count -= 8;
+                }
+            }
+
+            // Huffman codes are packed starting from their most significant bit.
+            void putCode(std::uint32_t code, std::uint32_t length) {
+                std::uint32_t reversed = 0;
+                for (std::uint32_t i = 0; i < length; ++i) reversed |= ((code >> i) & 1u) << (length - 1 - i);
+                put(reversed, length);
+            }
+
+            void flush() {
+                if (m_count > 0) m_out.push_back(static_cast<std::uint8_t>(m_buffer));
+                m_buffer = 0;
+                m_count = 0;
+            }
+
+        private:
+            std::vector<std::uint8_t>& m_out;
+            std::uint64_t m_buffer = 0;
+            std::uint32_t m_count = 0;
+        };
+
+        constexpr std::array<std::uint16_t, 29> LENGTH_BASE = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,
+                                                               15, 17, 19, 23, 27, 31, 35, 43, 51,  59,
+                                                               67, 83, 99, 115, 131, 163, 195, 227, 258};
+        constexpr std::array<std::uint8_t, 29> LENGTH_EXTRA = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                                               2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+        constexpr std::array<std::uint16_t, 30> DISTANCE_BASE = {1,    2,    3,    4,    5,    7,     9,     13,
+                                                                 17,   25,   33,   49,   65,   97,    129,   193,
+                                                                 257,  385,  513,  769,  1025, 1537,  2049,  3073,
+                                                                 4097, 6145, 8193, 12289, 16385, 24577};
+        constexpr std::array<std::uint8_t, 30> DISTANCE_EXTRA = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                                                 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+        void putLiteralLength(CBitWriter& bits, std::uint32_t symbol) {
+            if (symbol < 144) bits.putCode(0x30 + symbol, 8);
+            else if (symbol < 256) bits.putCode(0x190 + symbol - 144, 9);
+            else if (symbol < 280) bits.putCode(symbol - 256, 7);
+            else bits.putCode(0xC0 + symbol - 280, 8);
+        }
+
+        void putMatch(CBitWriter& bits, std::uint32_t length, std::uint32_t distance) {
+            std::uint32_t l = 0;
+            while (l + 1 < LENGTH_BASE.size() && LENGTH_BASE[l + 1] <= length) ++l;
+            putLiteralLength(bits, 257 + l);
+            bits.put(length - LENGTH_BASE[l], LENGTH_EXTRA[l]);
+
+            std::uint32_t d = 0;
+            while (d + 1 < DISTANCE_BASE.size() && DISTANCE_BASE[d + 1] <= distance) ++d;
+            bits.putCode(d, 5);
+            bits.put(distance - DISTANCE_BASE[d], DISTANCE_EXTRA[d]);
+        }
+
+        // One final block; greedy matching against the most recent position
+        // with the same 3-byte hash.
+        void deflateFixed(const std::vector<std::uint8_t>& data, std::vector<std::uint8_t>& out) {
+            constexpr std::size_t WINDOW = 32768;
+            constexpr std::size_t MAX_MATCH = 258;
+            constexpr std::uint32_t HASH_BITS = 15;
+
+            CBitWriter bits(out);
+            bits.put(1, 1); // BFINAL
+            bits.put(1, 2); // BTYPE = fixed Huffman
+
+            std::vector<std::int64_t> head(std::size_t(1) << HASH_BITS, -1);
+            auto hash = [&](std::size_t i) {
+                const std::uint32_t v = std::uint32_t(data[i]) | std::uint32_t(data[i + 1]) << 8 |
+                                        std::uint32_t(data[i + 2]) << 16;
+                return (v * 2654435761u) >> (32 - HASH_BITS);
+            };
+
+            const std::size_t n = data.size();
+            std::size_t i = 0;
+            while (i + 2 < n) {
+                const std::uint32_t h = hash(i);
+                const std::int64_t candidate = head[h];
+                head[h] = static_cast<std::int64_t>(i);
+
+                std::size_t length = 0;
+                if (candidate >= 0 && i - std::size_t(candidate) <= WINDOW) {
+                    const std::size_t limit = std::min(MAX_MATCH, n - i);
+                    const std::uint8_t* a = &data[std::size_t(candidate)];
+                    const std::uint8_t* b = &data[i];
+                    while (length < limit && a[length] == b[length]) ++length;
+                }
+                if (length >= 3) {
+                    putMatch(bits, static_cast<std::uint32_t>(length), static_cast<std::uint32_t>(i - std::size_t(candidate)));
+                    for (std::size_t j = i + 1; j < i + length && j + 2 < n; ++j) head[hash(j)] = static_cast<std::int64_t>(j);
+                    i += length;
+                } else {
+                    putLiteralLength(bits, data[i]);
+                    ++i;
+                }
+            }
+            for (; i < n; ++i) putLiteralLength(bits, data[i]);
+            putLiteralLength(bits, 256);
+            bits.flush();
+        }
+
+        std::uint32_t adler32(const std::vector<std::uint8_t>& data) {
+            std::uint32_t a = 1, b = 0;
+            std::size_t i = 0;
+            while (i < data.size()) {
+                // 5552 bytes is the longest run that cannot overflow b.
+                const std::size_t end = std::min(data.size(), i + 5552);
+                for (; i < end; ++i) {
+                    a += data[i];
+                    b += a;
+                }
+                a %= 65521;
+                b %= 65521;
+            }
+            return b << 16 | a;
+        }
+
+        std::uint32_t crc32(const std::uint8_t* data, std::size_t size, std::uint32_t crc = 0) {
+            static const auto table = [] {
+                std::array<std::uint32_t, 256> t{};
+                for (std::uint32_t n = 0; n < 256; ++n) {
+                    std::uint32_t c = n;
+                    for (int k = 0; k < 8; ++k) c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                    t[n] = c;
+                }
+                return t;
+            }();
+            crc = ~crc;
+            for (std::size_t i = 0; i < size; ++i) crc = table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+            return ~crc;
+        }
+
+        void putU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+            out.push_back(static_cast<std::uint8_t>(value >> 24));
+            out.push_back(static_cast<std::uint8_t>(value >> 16));
+            out.push_back(static_cast<std::uint8_t>(value >> 8));
+            out.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        void putChunk(std::vector<std::uint8_t>& out, const char* type, const std::vector<std::uint8_t>& data) {
+            putU32(out, static_cast<std::uint32_t>(data.size()));
+            const std::size_t start = out.size();
+            out.insert(out.end(), type, type + 4);
+            out.insert(out.end(), data.begin(), data.end());
+            putU32(out, crc32(&out[start], out.size() - start));
+        }
+
+        std::uint8_t paeth(int a, int b, int c) {
+            const int p = a + b - c;
+            const int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+            if (pa <= pb && pa <= pc) return static_cast<std::uint8_t>(a);
+            return static_cast<std::uint8_t>(pb <= pc ? b : c);
+        }
+
+        // Scanlines with the filter (None, Sub, Up, Paeth) whose output has
+        // the smallest sum of absolute signed bytes.
+        std::vector<std::uint8_t> filterScanlines(std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels,
+                                                  std::uint32_t channels) {
+            const std::size_t rowBytes = std::size_t(width) * channels;
+            std::vector<std::uint8_t> out;
+            out.reserve((rowBytes + 1) * height);
+            std::vector<std::uint8_t> candidate(rowBytes), best(rowBytes);
+            const std::vector<std::uint8_t> zeroRow(rowBytes, 0);
+
+            for (std::uint32_t y = 0; y < height; ++y) {
+                const std::uint8_t* row = pixels + y * rowBytes;
+                const std::uint8_t* up = y > 0 ? row - rowBytes : zeroRow.data();
+                std::uint8_t bestFilter = 0;
+                std::size_t bestCost = SIZE_MAX;
+                for (std::uint8_t filter : {0, 1, 2, 4}) {
+                    std::size_t cost = 0;
+                    for (std::size_t i = 0; i < rowBytes; ++i) {
+                        const int a = i >= channels ? row[i - channels] : 0;
+                        const int b = up[i];
+                        const int c = i >= channels ? up[i - channels] : 0;
+                        std::uint8_t value = row[i];
+                        if (filter == 1) value = static_cast<std::uint8_t>(value - a);
+                        else if (filter == 2) value = static_cast<std::uint8_t>(value - b);
+                        else if (filter == 4) value = static_cast<std::uint8_t>(value - paeth(a, b, c));
+                        candidate[i] = value;
+                        cost += static_cast<std::size_t>(std::abs(static_cast<std::int8_t>(value)));
+                    }
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        bestFilter = filter;
+                        best.swap(candidate);
+                    }
+                }
+                out.push_back(bestFilter);
+                out.insert(out.end(), best.begin(), best.end());
+            }
+            return out;
+        }
+
+        bool writeFile(const std::string& path, const std::vector<std::uint8_t>& bytes) {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+                KLOG_ERROR("Failed to write image " + path);
+                return false;
+            }
+            return true;
+        }
+
+    } // namespace
+
+    bool writePPM(const std::string& path, std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels,
+                  std::uint32_t channels) {
+        if (channels != 3 && channels != 4) return false;
+        const std::string header = "P6\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n";
+        std::vector<std::uint8_t> bytes(header.begin(), header.end());
+        bytes.reserve(bytes.size() + std::size_t(width) * height * 3);
+        for (std::size_t i = 0; i < std::size_t(width) * height; ++i)
+            bytes.insert(bytes.end(), pixels + i * channels, pixels + i * channels + 3);
+        return writeFile(path, bytes);
+    }
+
+    bool writePNG(const std::string& path, std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels,
+                  std::uint32_t channels) {
+        if (channels != 3 && channels != 4) return false;
+        std::vector<std::uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+        std::vector<std::uint8_t> header;
+        putU32(header, width);
+        putU32(header, height);
+        header.push_back(8);                              // bit depth
+        header.push_back(channels == 4 ? 6 : 2);          // RGBA / RGB
+        header.insert(header.end(), {0, 0, 0});           // deflate, adaptive filtering, no interlace
+        putChunk(png, "IHDR", header);
+
+        const std::vector<std::uint8_t> scanlines = filterScanlines(width, height, pixels, channels);
+        std::vector<std::uint8_t> zlib = {0x78, 0x01};
+        deflateFixed(scanlines, zlib);
+        putU32(zlib, adler32(scanlines));
+        putChunk(png, "IDAT", zlib);
+        putChunk(png, "IEND", {});
+        return writeFile(path, png);
+    }
+
+    bool writeImage(const std::string& path, std::uint32_t width, std::uint32_t height, const std::uint8_t* pixels,
+                    std::uint32_t channels) {
+        std::string extension = std::filesystem::path(path).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension == ".png" ? writePNG(path, width, height, pixels, channels)
+                                   : writePPM(path, width, height, pixels, channels);
+    }
+
+    bool readPPM(const std::string& path, std::uint32_t& width, std::uint32_t& height, std::vector<std::uint8_t>& rgb) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return false;
+        auto token = [&](std::string& out) {
+            out.clear();
+            int c;
+            while ((c = file.get()) != EOF) {
+                if (c == '#') {
+                    while ((c = file.get()) != EOF && c != '\n') {}
+                    continue;
+                }
+                if (std::isspace(c)) {
+                    if (!out.empty()) return true;
+                    continue;
+                }
+                out += static_cast<char>(c);
+            }
+            return !out.empty();
+        };
+        std::string magic, w, h, maxValue;
+        if (!token(magic) || magic != "P6" || !token(w) || !token(h) || !token(maxValue) || maxValue != "255") {
+            KLOG_ERROR("Not a binary 8-bit PPM: " + path);
+            return false;
+        }
+        width = static_cast<std::uint32_t>(std::strtoul(w.c_str(), nullptr, 10));
+        height = static_cast<std::uint32_t>(std::strtoul(h.c_str(), nullptr, 10));
+        rgb.resize(std::size_t(width) * height * 3);
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(rgb.data()), static_cast<std::streamsize>(rgb.size())));
+    }
+
+} // namespace Kinetica
@@ -0,0 +1,122 @@
+#include <kinetica/rendering/render_queue.hpp>
+#include <kinetica/log.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+namespace Kinetica {
+
+    // ---- DrawKey ----
+
+    std::uint32_t DrawKey::depthBucket(float viewDepth) {
+        const float d = std::max(viewDepth, 0.0f);
+        const float bucket = std::log2(1.0f + d) * 4096.0f;
+        return bucket >= 65535.0f ? 65535u : static_cast<std::uint32_t>(bucket);
+    }
+
+    std::uint32_t DrawKey::materialHash(const Components::SMaterial& material) {
+        const float values[5] = {material.baseColor.x, material.baseColor.y, material.baseColor.z,
+                                 material.metallic, material.roughness};
+        std::uint64_t hash = material.useVertexColor ? 0x9E3779B97F4A7C15ull : 1469598103934665603ull;
+        for (float v : values) {
+            std::uint32_t bits;
+            std::memcpy(&bits, &v, sizeof(bits));
+            hash = (hash ^ bits) * 1099511628211ull;
+        }
+        return static_cast<std::uint32_t>(hash ^ (hash >> 32)) & ((1u << MATERIAL_BITS) - 1);
+    }
+
+    // ---- Radix sort ----
+
+    void radixSort(std::vector<SSortEntry>& entries, std::vector<SSortEntry>& scratch) {
+        const std::size_t count = entries.size();
+        if (count < 2) return;
+        scratch.resize(count);
+
+        // All eight histograms in one read of the keys.
+        std::uint32_t histograms[8][256] = {};
+        for (const SSortEntry& e : entries) {
+            for (std::uint32_t b = 0; b < 8; ++b) ++histograms[b][(e.key >> (b * 8)) & 0xFF];
+        }
+
+        SSortEntry* src = entries.data();
+        SSortEntry* dst = scratch.data();
+        for (std::uint32_t b = 0; b < 8; ++b) {
+            std::uint32_t* histogram = histograms[b];
+            const std::uint32_t firstByte = (src[0].key >> (b * 8)) & 0xFF;
+            if (histogram[firstByte] == count) continue;
+
+            std::uint32_t offset = 0;
+            for (std::uint32_t i = 0; i < 256; ++i) {
+                const std::uint32_t n = histogram[i];
+                histogram[i] = offset;
+                offset += n;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                const SSortEntry& e = src[i];
+                dst[histogram[(e.key >> (b * 8)) & 0xFF]++] = e;
+            }
+            std::swap(src, dst);
+        }
+        if (src != entries.data()) entries.swap(scratch);
+    }
+
+    // ---- CRenderQueue ----
+
+    static std::atomic<std::uint64_t> s_nextRenderQueueId{1};
+
+    // Same one-entry per-thread cache as CCommandQueue::local().
+    struct SLocalRenderBufferCache {
+        std::uint64_t queueId = 0;
+        std::uint32_t slot = 0;
+        void* buffer = nullptr;
+    };
+    static thread_local SLocalRenderBufferCache t_localRenderBuffer;
+
+    CRenderQueue::CRenderQueue() : m_id(s_nextRenderQueueId.fetch_add(1, std::memory_order_relaxed)) {}
+
+    CRenderQueue::SThreadBuffer& CRenderQueue::local() {
+        if (t_localRenderBuffer.queueId == m_id) return *static_cast<SThreadBuffer*>(t_localRenderBuffer.buffer);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto [it, inserted] = m_slots.try_emplace(std::this_thread::get_id(), static_cast<std::uint32_t>(m_buffers.size()));
+        if (inserted) m_buffers.push_back(std::make_unique<SThreadBuffer>());
+        SThreadBuffer* buffer = m_buffers[it->second].get();
+        t_localRenderBuffer = {m_id, it->second, buffer};
+        return *buffer;
+    }
+
+    void CRenderQueue::push(std::uint64_t key, const SRenderCommand& command) {
+        SThreadBuffer& buffer = local();
+        const auto index = static_cast<std::uint32_t>(buffer.commands.size());
+        if (index >= (1u << SLOT_SHIFT)) {
+            KLOG_ERROR("Render queue thread buffer is full");
+            return;
+        }
+        buffer.entries.push_back({key, (t_localRenderBuffer.slot << SLOT_SHIFT) | index});
+        buffer.commands.push_back(command);
+    }
+
+    void CRenderQueue::sort() {
+        std::size_t total = 0;
+        for (const auto& buffer : m_buffers) total += buffer->entries.size();
+
+        m_sorted.clear();
+        m_sorted.reserve(total);
+        for (const auto& buffer : m_buffers) {
+            m_sorted.insert(m_sorted.end(), buffer->entries.begin(), buffer->entries.end());
+        }
+        radixSort(m_sorted, m_scratch);
+    }
+
+    void CRenderQueue::clear() {
+        for (const auto& buffer : m_buffers) {
+            buffer->entries.clear();
+            buffer->commands.clear();
+        }
+        m_sorted.clear();
+    }
+
+} // namespace Kinetica
@@ -0,0 +1,501 @@
+#include <kinetica/rendering/software_renderer.hpp>
+#include <kinetica/rendering/image_io.hpp>
+#include <kinetica/profiler.hpp>
+#include <kinetica/thread_pool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define KINETICA_X86 1
+#include <emmintrin.h>
+#else
+#define KINETICA_X86 0
+#endif
+
+namespace Kinetica {
+
+    using Components::SIndex;
+    using Components::SMaterial;
+    using Components::SMesh;
+    using Components::SVertex;
+
+    namespace {
+
+        constexpr std::size_t SETUP_CHUNK = 16384; // triangles per setup task
+        constexpr std::size_t VERTEX_GRAIN = 16384;
+        constexpr float MIN_LIGHT = 0.2f;          // basic.frag: max(N.L, 0.2)
+
+        // p(x, y) = a * x + b * y + c at integer pixel coordinates (the pixel
+        // centre offset is folded into c).
+        struct SPlane {
+            float a, b, c;
+        };
+
+        std::uint32_t packColor(float r, float g, float b) {
+            auto channel = [](float v) {
+                return static_cast<std::uint32_t>(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+            };
+            return channel(r) | channel(g) << 8 | channel(b) << 16 | 0xFF000000u;
+        }
+
+    } // namespace
+
+    struct CSoftwareRenderer::SClipVertex {
+        glm::vec4 clip;
+        glm::vec3 normal; // world space
+        float u, v;
+    };
+
+    struct CSoftwareRenderer::STriangle {
+        SPlane edge[3];          // inside where every edge >= threshold
+        float threshold[3];      // 0 on top-left edges, the smallest float above 0 elsewhere
+        SPlane depth;            // window z in [0, 1]
+        SPlane normal[3];        // normal / w; normalization cancels the 1/w
+        SPlane invW, uOverW, vOverW; // only for uvAlbedo
+        std::uint16_t minX, minY, maxX, maxY;
+        glm::vec3 albedo;
+        bool uvAlbedo;
+    };
+
+    namespace {
+
+        // Sets up one screen-space triangle; false when culled or empty.
+        template<typename Triangle, typename Vertex>
+        bool setupTriangle(const Vertex (&v)[3], float width, float height, Triangle& out) {
+            float sx[3], sy[3], sz[3], invW[3];
+            for (int i = 0; i < 3; ++i) {
+                invW[i] = 1.0f / v[i].clip.w;
+                sx[i] = (v[i].clip.x * invW[i] * 0.5f + 0.5f) * width;
+                sy[i] = (0.5f - v[i].clip.y * invW[i] * 0.5f) * height; // rows top to bottom
+                sz[i] = v[i].clip.z * invW[i] * 0.5f + 0.5f;
+            }
+
+            // Counter-clockwise in NDC is clockwise here (y flipped); that is
+            // the front face, everything else is culled like GL_CULL_FACE.
+            const float area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sx[2] - sx[0]) * (sy[1] - sy[0]);
+            if (!(area < 0.0f)) return false;
+
+            const float minX = std::max(std::floor(std::min({sx[0], sx[1], sx[2]})), 0.0f);
+            const float minY = std::max(std::floor(std::min({sy[0], sy[1], sy[2]})), 0.0f);
+            const float maxX = std::min(std::ceil(std::max({sx[0], sx[1], sx[2]})), width - 1.0f);
+            const float maxY = std::min(std::ceil(std::max({sy[0], sy[1], sy[2]})), height - 1.0f);
+            if (minX > maxX || minY > maxY) return false;
+            out.minX = static_cast<std::uint16_t>(minX);
+            out.minY = static_cast<std::uint16_t>(minY);
+            out.maxX = static_cast<std::uint16_t>(maxX);
+            out.maxY = static_cast<std::uint16_t>(maxY);
+
+            // Edge i is opposite vertex i and grows towards the interior; the
+            // three sum to -area, so e_i / -area are the barycentrics.
+            const float invArea = -1.0f / area;
+            for (int i = 0; i < 3; ++i) {
+                int j = (i + 1) % 3, k = (i + 2) % 3;
+                // Set up from the same endpoint whatever the winding, so two
+                // triangles sharing an edge get exactly negated planes and no
+                // pixel on it is dropped or drawn twice.
+                const bool flip = sx[k] < sx[j] || (sx[k] == sx[j] && sy[k] < sy[j]);
+                if (flip) std::swap(j, k);
+                SPlane& e = out.edge[i];
+                e.a = sy[k] - sy[j];
+                e.b = sx[j] - sx[k];
+                e.c = (sx[k] - sx[j]) * sy[j] - (sy[k] - sy[j]) * sx[j];
+                e.c += 0.5f * (e.a + e.b); // sample at pixel centres
+                if (flip) e = {-e.a, -e.b, -e.c};
+                const bool topLeft = e.a > 0.0f || (e.a == 0.0f && e.b > 0.0f);
+                out.threshold[i] = topLeft ? 0.0f : std::numeric_limits<float>::denorm_min();
+            }
+            auto plane = [&](float f0, float f1, float f2) {
+                const float f[3] = {f0 * invArea, f1 * invArea, f2 * invArea};
+                SPlane p{0.0f, 0.0f, 0.0f};
+                for (int i = 0; i < 3; ++i) {
+                    p.a += f[i] * out.edge[i].a;
+                    p.b += f[i] * out.edge[i].b;
+                    p.c += f[i] * out.edge[i].c;
+                }
+                return p;
+            };
+            out.depth = plane(sz[0], sz[1], sz[2]);
+            for (int c = 0; c < 3; ++c)
+                out.normal[c] = plane(v[0].normal[c] * invW[0], v[1].normal[c] * invW[1], v[2].normal[c] * invW[2]);
+            if (out.uvAlbedo) {
+                out.invW = plane(invW[0], invW[1], invW[2]);
+                out.uOverW = plane(v[0].u * invW[0], v[1].u * invW[1], v[2].u * invW[2]);
+                out.vOverW = plane(v[0].v * invW[0], v[1].v * invW[1], v[2].v * invW[2]);
+            }
+            return true;
+        }
+
+        // Clips against the near plane (z >= -w) and emits up to two triangles.
+        template<typename Vertex, typename Emit>
+        void clipNear(const Vertex (&in)[3], Emit&& emit) {
+            auto distance = [](const Vertex& v) { return v.clip.z + v.clip.w; };
+            const float d[3] = {distance(in[0]), distance(in[1]), distance(in[2])};
+            if (d[0] >= 0.0f && d[1] >= 0.0f && d[2] >= 0.0f) {
+                emit(in);
+                return;
+            }
+
+            Vertex polygon[4];
+            int count = 0;
+            for (int i = 0; i < 3; ++i) {
+                const int j = (i + 1) % 3;
+                if (d[i] >= 0.0f) polygon[count++] = in[i];
+                if ((d[i] >= 0.0f) != (d[j] >= 0.0f)) {
+                    const float t = d[i] / (d[i] - d[j]);
+                    Vertex& v = polygon[count++];
+                    v.clip = in[i].clip + (in[j].clip - in[i].clip) * t;
+                    v.normal = in[i].normal + (in[j].normal - in[i].normal) * t;
+                    v.u = in[i].u + (in[j].u - in[i].u) * t;
+                    v.v = in[i].v + (in[j].v - in[i].v) * t;
+                }
+            }
+            for (int i = 2; i < count; ++i) {
+                const Vertex triangle[3] = {polygon[0], polygon[i - 1], polygon[i]};
+                emit(triangle);
+            }
+        }
+
+        // Whole triangle on the outside of one frustum plane.
+        template<typename Vertex>
+        bool outsideFrustum(const Vertex (&v)[3]) {
+            for (int axis = 0; axis < 3; ++axis) {
+                bool below = true, above = true;
+                for (int i = 0; i < 3; ++i) {
+                    below = below && v[i].clip[axis] < -v[i].clip.w;
+                    above = above && v[i].clip[axis] > v[i].clip.w;
+                }
+                if (below || above) return true;
+            }
+            return false;
+        }
+
+        // Rasterizes `t` inside the pixel rectangle [x0, x1] x [y0, y1] of one
+        // tile. x0 is a multiple of 4 and the tile is 4-aligned, so every
+        // 4-pixel step stays inside the tile (or the row padding).
+        template<typename Triangle>
+        void rasterize(const Triangle& t, std::uint32_t x0, std::uint32_t x1, std::uint32_t y0, std::uint32_t y1,
+                       std::uint32_t stride, std::uint32_t* color, float* depth) {
+#if KINETICA_X86
+            const __m128 lane = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+            const __m128 e0a = _mm_set1_ps(t.edge[0].a), e1a = _mm_set1_ps(t.edge[1].a), e2a = _mm_set1_ps(t.edge[2].a);
+            const __m128 th0 = _mm_set1_ps(t.threshold[0]), th1 = _mm_set1_ps(t.threshold[1]),
+                         th2 = _mm_set1_ps(t.threshold[2]);
+            const __m128 za = _mm_set1_ps(t.depth.a);
+            const __m128 nxa = _mm_set1_ps(t.normal[0].a), nya = _mm_set1_ps(t.normal[1].a),
+                         nza = _mm_set1_ps(t.normal[2].a);
+            const __m128 minLight = _mm_set1_ps(MIN_LIGHT);
+            const __m128 one = _mm_set1_ps(1.0f), zero = _mm_setzero_ps(), scale = _mm_set1_ps(255.0f);
+            const __m128 half = _mm_set1_ps(0.5f), threeHalves = _mm_set1_ps(1.5f);
+            const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+            for (std::uint32_t y = y0; y <= y1; ++y) {
+                const float fy = static_cast<float>(y);
+                const __m128 e0row = _mm_set1_ps(t.edge[0].b * fy + t.edge[0].c);
+                const __m128 e1row = _mm_set1_ps(t.edge[1].b * fy + t.edge[1].c);
+                const __m128 e2row = _mm_set1_ps(t.edge[2].b * fy + t.edge[2].c);
+                const __m128 zrow = _mm_set1_ps(t.depth.b * fy + t.depth.c);
+                std::uint32_t* colorRow = color + std::size_t(y) * stride;
+                float* depthRow = depth + std::size_t(y) * stride;
+
+                for (std::uint32_t x = x0; x <= x1; x += 4) {
+                    const __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), lane);
+                    __m128 mask = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e0a, px), e0row), th0);
+                    mask = _mm_and_ps(mask, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e1a, px), e1row), th1));
+                    mask = _mm_and_ps(mask, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(e2a, px), e2row), th2));
+                    if (_mm_movemask_ps(mask) == 0) continue;
+
+                    const __m128 z = _mm_add_ps(_mm_mul_ps(za, px), zrow);
+                    const __m128 stored = _mm_loadu_ps(depthRow + x);
+                    mask = _mm_and_ps(mask, _mm_cmplt_ps(z, stored));
+                    if (_mm_movemask_ps(mask) == 0) continue;
+                    _mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(mask, z), _mm_andnot_ps(mask, stored)));
+
+                    // basic.frag: albedo * max(dot(normalize(N), (0, 1, 0)), 0.2)
+                    const __m128 nx = _mm_add_ps(_mm_mul_ps(nxa, px), _mm_set1_ps(t.normal[0].b * fy + t.normal[0].c));
+                    const __m128 ny = _mm_add_ps(_mm_mul_ps(nya, px), _mm_set1_ps(t.normal[1].b * fy + t.normal[1].c));
+                    const __m128 nz = _mm_add_ps(_mm_mul_ps(nza, px), _mm_set1_ps(t.normal[2].b * fy + t.normal[2].c));
+                    const __m128 length2 =
+                        _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nx), _mm_mul_ps(ny, ny)), _mm_mul_ps(nz, nz));
+                    __m128 invLength = _mm_rsqrt_ps(length2);
+                    invLength = _mm_mul_ps(invLength, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(half, length2),
+                                                                                        _mm_mul_ps(invLength, invLength))));
+                    // max() returns its second operand for NaN (zero-length normals).
+                    const __m128 light = _mm_max_ps(_mm_mul_ps(ny, invLength), minLight);
+
+                    __m128 r, g, b;
+                    if (t.uvAlbedo) {
+                        const __m128 iw = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.invW.a), px), _mm_set1_ps(t.invW.b * fy + t.invW.c));
+                        const __m128 w = _mm_div_ps(one, iw);
+                        const __m128 u = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.uOverW.a), px),
+                                                               _mm_set1_ps(t.uOverW.b * fy + t.uOverW.c)), w);
+                        const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.vOverW.a), px),
+                                                               _mm_set1_ps(t.vOverW.b * fy + t.vOverW.c)), w);
+                        r = _mm_mul_ps(u, light);
+                        g = _mm_mul_ps(v, light);
+                        b = zero;
+                    } else {
+                        r = _mm_mul_ps(_mm_set1_ps(t.albedo.x), light);
+                        g = _mm_mul_ps(_mm_set1_ps(t.albedo.y), light);
+                        b = _mm_mul_ps(_mm_set1_ps(t.albedo.z), light);
+                    }
+                    auto channel = [&](__m128 c) {
+                        c = _mm_min_ps(_mm_max_ps(c, zero), one);
+                        return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(c, scale), half));
+                    };
+                    __m128i rgba = _mm_or_si128(channel(r), _mm_slli_epi32(channel(g), 8));
+                    rgba = _mm_or_si128(rgba, _mm_or_si128(_mm_slli_epi32(channel(b), 16), alpha));
+
+                    const __m128i keep = _mm_castps_si128(mask);
+                    __m128i* target = reinterpret_cast<__m128i*>(colorRow + x);
+                    const __m128i old = _mm_loadu_si128(target);
+                    _mm_storeu_si128(target, _mm_or_si128(_mm_and_si128(keep, rgba), _mm_andnot_si128(keep, old)));
+                }
+            }
+#else
+            for (std::uint32_t y = y0; y <= y1; ++y) {
+                const float fy = static_cast<float>(y);
+                std::uint32_t* colorRow = color + std::size_t(y) * stride;
+                float* depthRow = depth + std::size_t(y) * stride;
+                for (std::uint32_t x = x0; x < x0 + ((x1 - x0) / 4 + 1) * 4; ++x) {
+                    const float fx = static_cast<float>(x);
+                    auto at = [&](const SPlane& p) { return p.a * fx + p.b * fy + p.c; };
+                    if (at(t.edge[0]) < t.threshold[0] || at(t.edge[1]) < t.threshold[1] ||
+                        at(t.edge[2]) < t.threshold[2])
+                        continue;
+                    const float z = at(t.depth);
+                    if (!(z < depthRow[x])) continue;
+                    depthRow[x] = z;
+
+                    const glm::vec3 n(at(t.normal[0]), at(t.normal[1]), at(t.normal[2]));
+                    const float length = glm::length(n);
+                    const float light = length > 0.0f ? std::max(n.y / length, MIN_LIGHT) : MIN_LIGHT;
+                    glm::vec3 albedo = t.albedo;
+                    if (t.uvAlbedo) {
+                        const float w = 1.0f / at(t.invW);
+                        albedo = glm::vec3(at(t.uOverW) * w, at(t.vOverW) * w, 0.0f);
+                    }
+                    colorRow[x] = packColor(albedo.x * light, albedo.y * light, albedo.z * light);
+                }
+            }
+#endif
+        }
+
+    } // namespace
+
+    CSoftwareRenderer::CSoftwareRenderer(std::uint32_t width, std::uint32_t height, CThreadPool* pool)
+        : m_pool(pool) {
+        resize(width, height);
+    }
+
+    CSoftwareRenderer::~CSoftwareRenderer() = default;
+
+    CThreadPool& CSoftwareRenderer::pool() {
+        if (m_pool) return *m_pool;
+        if (!m_ownPool) m_ownPool = std::make_unique<CThreadPool>();
+        return *m_ownPool;
+    }
+
+    void CSoftwareRenderer::resize(std::uint32_t width, std::uint32_t height) {
+        // Triangle bounds are stored as 16-bit pixel coordinates.
+        m_width = std::min<std::uint32_t>(width, 32768);
+        m_height = std::min<std::uint32_t>(height, 32768);
+        m_stride = (m_width + 3) & ~3u;
+        m_tilesX = (m_width + TILE_SIZE - 1) / TILE_SIZE;
+        m_tilesY = (m_height + TILE_SIZE - 1) / TILE_SIZE;
+        m_color.assign(std::size_t(m_stride) * m_height, 0);
+        m_depth.assign(std::size_t(m_stride) * m_height, 1.0f);
+    }
+
+    void CSoftwareRenderer::clear() {
+        std::fill(m_color.begin(), m_color.end(), packColor(m_clearColor.x, m_clearColor.y, m_clearColor.z));
+        std::fill(m_depth.begin(), m_depth.end(), 1.0f);
+        m_stats = {};
+    }
+
+    void CSoftwareRenderer::setViewProjection(const glm::mat4& view, const glm::mat4& proj) {
+        m_viewProjection = proj * view;
+    }
+
+    void CSoftwareRenderer::uploadMesh(SMesh& mesh) {
+        mesh.uploadedVertices = static_cast<std::uint32_t>(mesh.vertices.size());
+        mesh.uploadedIndices = static_cast<std::uint32_t>(mesh.indices.size());
+        mesh.dirtyVertices.clear();
+        mesh.dirtyIndices.clear();
+        mesh.isDirty = false;
+    }
+
+    void CSoftwareRenderer::releaseMesh(SMesh& mesh) {
+        mesh.uploadedVertices = mesh.uploadedIndices = 0;
+        mesh.isDirty = true;
+    }
+
+    void CSoftwareRenderer::renderEntity(const glm::mat4& model, const SMesh& mesh, const SMaterial& material) {
+        submit(model, mesh, material);
+        flushBatches();
+    }
+
+    void CSoftwareRenderer::submit(const glm::mat4& model, const SMesh& mesh, const SMaterial& material) {
+        if (mesh.indices.empty()) return;
+        std::lock_guard<std::mutex> lock(m_submitMutex);
+        m_draws.push_back({model, &mesh, material.baseColor, material.useVertexColor});
+    }
+
+    void CSoftwareRenderer::flushBatches() {
+        if (m_draws.empty() || !isValid()) {
+            m_draws.clear();
+            return;
+        }
+        KPROFILE_SCOPE("Software flush");
+        CThreadPool& threads = pool();
+
+        m_vertexOffsets.assign(1, 0);
+        m_triangleOffsets.assign(1, 0);
+        for (const SDraw& draw : m_draws) {
+            m_vertexOffsets.push_back(m_vertexOffsets.back() + draw.mesh->vertices.size());
+            m_triangleOffsets.push_back(m_triangleOffsets.back() + draw.mesh->indices.size());
+        }
+        auto drawOf = [](const std::vector<std::size_t>& offsets, std::size_t i) {
+            return static_cast<std::size_t>(std::upper_bound(offsets.begin(), offsets.end(), i) - offsets.begin()) - 1;
+        };
+
+        // ---- Vertex stage ----
+        m_clipVertices.resize(m_vertexOffsets.back());
+        threads.parallelFor(m_clipVertices.size(), VERTEX_GRAIN, [&](std::size_t begin, std::size_t end) {
+            KPROFILE_SCOPE("Vertex stage");
+            std::size_t d = drawOf(m_vertexOffsets, begin);
+            while (begin < end) {
+                const SDraw& draw = m_draws[d];
+                const glm::mat4 mvp = m_viewProjection * draw.model;
+                const glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(draw.model)));
+                const std::size_t drawEnd = std::min(end, m_vertexOffsets[d + 1]);
+                const SVertex* source = draw.mesh->vertices.data() - m_vertexOffsets[d];
+                for (std::size_t i = begin; i < drawEnd; ++i) {
+                    const SVertex& v = source[i];
+                    SClipVertex& out = m_clipVertices[i];
+                    out.clip = mvp * glm::vec4(v.x, v.y, v.z, 1.0f);
+                    out.normal = normalMatrix * glm::vec3(v.nx, v.ny, v.nz);
+                    out.u = v.u;
+                    out.v = v.v;
+                }
+                begin = drawEnd;
+                ++d;
+            }
+        });
+
+        // ---- Triangle setup and binning, one bin list per chunk so the
+        // chunks need no locks and submission order is kept per tile ----
+        const std::size_t tileCount = std::size_t(m_tilesX) * m_tilesY;
+        const std::size_t triangleCount = m_triangleOffsets.back();
+        const std::size_t chunkCount = (triangleCount + SETUP_CHUNK - 1) / SETUP_CHUNK;
+        m_chunkTriangles.resize(chunkCount);
+        m_bins.resize(chunkCount * tileCount);
+        const float width = static_cast<float>(m_width), height = static_cast<float>(m_height);
+
+        threads.parallelFor(chunkCount, 1, [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+            KPROFILE_SCOPE("Triangle setup");
+            for (std::size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+                std::vector<STriangle>& triangles = m_chunkTriangles[chunk];
+                triangles.clear();
+                std::vector<std::uint32_t>* bins = &m_bins[chunk * tileCount];
+                for (std::size_t tile = 0; tile < tileCount; ++tile) bins[tile].clear();
+
+                const std::size_t first = chunk * SETUP_CHUNK;
+                const std::size_t last = std::min(triangleCount, first + SETUP_CHUNK);
+                std::size_t d = drawOf(m_triangleOffsets, first);
+                for (std::size_t i = first; i < last; ++i) {
+                    while (i >= m_triangleOffsets[d + 1]) ++d;
+                    const SDraw& draw = m_draws[d];
+                    const SIndex& index = draw.mesh->indices[i - m_triangleOffsets[d]];
+                    const std::size_t vertexCount = draw.mesh->vertices.size();
+                    if (index.a >= vertexCount || index.b >= vertexCount || index.c >= vertexCount) continue;
+
+                    const SClipVertex* base = &m_clipVertices[m_vertexOffsets[d]];
+                    const SClipVertex corners[3] = {base[index.a], base[index.b], base[index.c]};
+                    if (outsideFrustum(corners)) continue;
+
+                    clipNear(corners, [&](const SClipVertex (&v)[3]) {
+                        STriangle t;
+                        t.albedo = draw.albedo;
+                        t.uvAlbedo = draw.uvAlbedo;
+                        if (!setupTriangle(v, width, height, t)) return;
+
+                        const auto id = static_cast<std::uint32_t>(triangles.size());
+                        const std::uint32_t tx0 = t.minX / TILE_SIZE, tx1 = t.maxX / TILE_SIZE;
+                        const std::uint32_t ty0 = t.minY / TILE_SIZE, ty1 = t.maxY / TILE_SIZE;
+                        const bool single = tx0 == tx1 && ty0 == ty1;
+                        for (std::uint32_t ty = ty0; ty <= ty1; ++ty) {
+                            for (std::uint32_t tx = tx0; tx <= tx1; ++tx) {
+                                if (!single) {
+                                    // Skip tiles entirely outside one edge, with a
+                                    // pixel of slack for rounding.
+                                    const float x0 = float(tx * TILE_SIZE) - 1.0f, x1 = x0 + float(TILE_SIZE + 1);
+                                    const float y0 = float(ty * TILE_SIZE) - 1.0f, y1 = y0 + float(TILE_SIZE + 1);
+                                    bool outside = false;
+                                    for (const SPlane& e : t.edge) {
+                                        const float x = e.a >= 0.0f ? x1 : x0;
+                                        const float y = e.b >= 0.0f ? y1 : y0;
+                                        outside = outside || e.a * x + e.b * y + e.c < 0.0f;
+                                    }
+                                    if (outside) continue;
+                                }
+                                bins[ty * m_tilesX + tx].push_back(id);
+                            }
+                        }
+                        triangles.push_back(t);
+                    });
+                }
+            }
+        });
+
+        // ---- Raster: tiles own disjoint pixels ----
+        threads.parallelFor(tileCount, 1, [&](std::size_t tileBegin, std::size_t tileEnd) {
+            KPROFILE_SCOPE("Raster tiles");
+            for (std::size_t tile = tileBegin; tile < tileEnd; ++tile) {
+                const std::uint32_t tileX0 = static_cast<std::uint32_t>(tile % m_tilesX) * TILE_SIZE;
+                const std::uint32_t tileY0 = static_cast<std::uint32_t>(tile / m_tilesX) * TILE_SIZE;
+                const std::uint32_t tileX1 = std::min(tileX0 + TILE_SIZE, m_width) - 1;
+                const std::uint32_t tileY1 = std::min(tileY0 + TILE_SIZE, m_height) - 1;
+                for (std::size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                    const std::vector<STriangle>& triangles = m_chunkTriangles[chunk];
+                    for (const std::uint32_t id : m_bins[chunk * tileCount + tile]) {
+                        const STriangle& t = triangles[id];
+                        const std::uint32_t x0 = std::max<std::uint32_t>(t.minX, tileX0) & ~3u;
+                        const std::uint32_t x1 = std::min<std::uint32_t>(t.maxX, tileX1);
+                        const std::uint32_t y0 = std::max<std::uint32_t>(t.minY, tileY0);
+                        const std::uint32_t y1 = std::min<std::uint32_t>(t.maxY, tileY1);
+                        rasterize(t, x0, x1, y0, y1, m_stride, m_color.data(), m_depth.data());
+                    }
+                }
+            }
+        });
+
+        std::size_t rasterized = 0;
+        for (const auto& triangles : m_chunkTriangles) rasterized += triangles.size();
+        m_stats.drawCalls += static_cast<std::uint32_t>(m_draws.size());
+        m_stats.trianglesRasterized += static_cast<std::uint32_t>(rasterized);
+        m_draws.clear();
+    }
+
+    std::vector<std::uint8_t> CSoftwareRenderer::readPixels() const {
+        std::vector<std::uint8_t> pixels(std::size_t(m_width) * m_height * 4);
+        for (std::uint32_t y = 0; y < m_height; ++y) {
+            const std::uint32_t* row = m_color.data() + std::size_t(y) * m_stride;
+            std::uint8_t* out = pixels.data() + std::size_t(y) * m_width * 4;
+            for (std::uint32_t x = 0; x < m_width; ++x) {
+                out[x * 4 + 0] = static_cast<std::uint8_t>(row[x]);
+                out[x * 4 + 1] = static_cast<std::uint8_t>(row[x] >> 8);
+                out[x * 4 + 2] = static_cast<std::uint8_t>(row[x] >> 16);
+                out[x * 4 + 3] = static_cast<std::uint8_t>(row[x] >> 24);
+            }
+        }
+        return pixels;
+    }
+
+    bool CSoftwareRenderer::writeImage(const std::string& path) const {
+        const std::vector<std::uint8_t> pixels = readPixels();
+        return Kinetica::writeImage(path, m_width, m_height, pixels.data(), 4);
+    }
+
+} // namespace Kinetica
@@ -0,0 +1,240 @@
+#include <kinetica/rendering/vertex_format.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Kinetica {
+
+    using Components::SVertex;
+
+    // ---- Scalar codecs ----
+
+    std::uint16_t floatToHalf(float value) {
+        std::uint32_t x;
+        std::memcpy(&x, &value, sizeof(x));
+        const std::uint32_t sign = x & 0x80000000u;
+        x ^= sign;
+
+        std::uint16_t half;
+        if (x >= 0x47800000u) {
+            // Overflow to infinity; NaN stays NaN.
+            half = x > 0x7F800000u ? 0x7E00 : 0x7C00;
+        } else if (x < 0x38800000u) {
+            // Half subnormals: let the FPU round by adding 0.5f, whose exponent
+            // lines the mantissa up with the half subnormal bits.
+            float f;
+            std::memcpy(&f, &x, sizeof(f));
+            f += 0.5f;
+            std::uint32_t bits;
+            std::memcpy(&bits, &f, sizeof(bits));
+            half = static_cast<std::uint16_t>(bits - 0x3F000000u);
+        } else {
+            // Rebias the exponent and round to nearest even.
+            const std::uint32_t mantissaOdd = (x >> 13) & 1u;
+            x += 0xC8000FFFu + mantissaOdd; // ((15 - 127) << 23) + 0xFFF
+            half = static_cast<std::uint16_t>(x >> 13);
+        }
+        return static_cast<std::uint16_t>(half | (sign >> 16));
+    }
+
+    float halfToFloat(std::uint16_t half) {
+        const std::uint32_t sign = std::uint32_t(half & 0x8000u) << 16;
+        const std::uint32_t exponent = (half >> 10) & 0x1Fu;
+        const std::uint32_t mantissa = half & 0x3FFu;
+
+        std::uint32_t bits;
+        if (exponent == 0) {
+            const float value = std::ldexp(static_cast<float>(mantissa), -24);
+            return sign ? -value : value;
+        }
+        if (exponent == 31) {
+            bits = sign | 0x7F800000u | (mantissa << 13);
+        } else {
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        }
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    static float signNotZero(float v) { return v >= 0.0f ? 1.0f : -1.0f; }
+
+    glm::vec2 octahedralEncode(const glm::vec3& n) {
+        const float l1 = std::fabs(n.x) + std::fabs(n.y) + std::fabs(n.z);
+        if (l1 <= 0.0f) return glm::vec2(0.0f, 0.0f);
+        glm::vec2 p(n.x / l1, n.y / l1);
+        if (n.z < 0.0f) {
+            p = glm::vec2((1.0f - std::fabs(p.y)) * signNotZero(p.x), (1.0f - std::fabs(p.x)) * signNotZero(p.y));
+        }
+        return p;
+    }
+
+    glm::vec3 octahedralDecode(const glm::vec2& e) {
+        glm::vec3 v(e.x, e.y, 1.0f - std::fabs(e.x) - std::fabs(e.y));
+        if (v.z < 0.0f) {
+            v = glm::vec3((1.0f - std::fabs(e.y)) * signNotZero(e.x), (1.0f - std::fabs(e.x)) * signNotZero(e.y), v.z);
+        }
+        const float length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+        return length > 0.0f ? v / length : glm::vec3(0.0f, 0.0f, 1.0f);
+    }
+
+    // Octahedral coordinates as two unorm values in [0, maxValue]. Tries the four
+    // neighbouring grid points and keeps the one that decodes closest to n.
+    static void quantizeOctahedral(const glm::vec3& n, float maxValue, std::uint32_t& qx, std::uint32_t& qy) {
+        const glm::vec2 e = octahedralEncode(n);
+        const float fx = (e.x * 0.5f + 0.5f) * maxValue;
+        const float fy = (e.y * 0.5f + 0.5f) * maxValue;
+        const float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+        const glm::vec3 unit = length > 0.0f ? n / length : glm::vec3(0.0f, 0.0f, 1.0f);
+
+        float best = -2.0f;
+        for (int i = 0; i < 4; ++i) {
+            const float cx = std::clamp((i & 1) ? std::ceil(fx) : std::floor(fx), 0.0f, maxValue);
+            const float cy = std::clamp((i & 2) ? std::ceil(fy) : std::floor(fy), 0.0f, maxValue);
+            const glm::vec3 d = octahedralDecode(glm::vec2(cx / maxValue * 2.0f - 1.0f, cy / maxValue * 2.0f - 1.0f));
+            const float score = glm::dot(d, unit);
+            if (score > best) {
+                best = score;
+                qx = static_cast<std::uint32_t>(cx);
+                qy = static_cast<std::uint32_t>(cy);
+            }
+        }
+    }
+
+    static std::uint16_t toUnorm16(float v) {
+        return static_cast<std::uint16_t>(std::lround(std::clamp(v, 0.0f, 1.0f) * 65535.0f));
+    }
+
+    // ---- Layouts ----
+
+    SVertexLayout SVertexLayout::standard() { return SVertexFormat::standard().layout(); }
+
+    SVertexFormat SVertexFormat::standard() {
+        return {EPositionEncoding::Float32, ENormalEncoding::Float32, EUVEncoding::Float32, false};
+    }
+
+    SVertexFormat SVertexFormat::compact() { return {}; }
+
+    SVertexLayout SVertexFormat::layout() const {
+        SVertexLayout layout;
+        std::uint32_t offset = 0;
+
+        if (position == EPositionEncoding::Float32) {
+            layout.attributes.push_back({0, 3, GL_FLOAT, GL_FALSE, offset});
+            offset += 12;
+        } else {
+            layout.attributes.push_back({0, 3, GL_UNSIGNED_SHORT, GL_TRUE, offset});
+            offset += 8; // 4-byte aligned
+        }
+
+        switch (normal) {
+        case ENormalEncoding::Float32:
+            layout.attributes.push_back({1, 3, GL_FLOAT, GL_FALSE, offset});
+            offset += 12;
+            break;
+        case ENormalEncoding::Octahedral16:
+            layout.attributes.push_back({1, 2, GL_UNSIGNED_BYTE, GL_TRUE, offset});
+            offset += 4;
+            break;
+        case ENormalEncoding::Octahedral32:
+            layout.attributes.push_back({1, 2, GL_UNSIGNED_SHORT, GL_TRUE, offset});
+            offset += 4;
+            break;
+        }
+
+        switch (uv) {
+        case EUVEncoding::Float32:
+            layout.attributes.push_back({2, 2, GL_FLOAT, GL_FALSE, offset});
+            offset += 8;
+            break;
+        case EUVEncoding::Half16:
+            layout.attributes.push_back({2, 2, GL_HALF_FLOAT, GL_FALSE, offset});
+            offset += 4;
+            break;
+        case EUVEncoding::Unorm16:
+            layout.attributes.push_back({2, 2, GL_UNSIGNED_SHORT, GL_TRUE, offset});
+            offset += 4;
+            break;
+        }
+
+        layout.stride = offset;
+        return layout;
+    }
+
+    // ---- Position quantization ----
+
+    SPositionDequant SPositionDequant::fromBounds(const Math::SAABB& bounds, float margin) {
+        SPositionDequant d;
+        if (bounds.isEmpty()) return d;
+        const glm::vec3 size = bounds.max - bounds.min;
+        d.offset = bounds.min - size * margin;
+        d.scale = size * (1.0f + 2.0f * margin);
+        return d;
+    }
+
+    bool SPositionDequant::covers(const glm::vec3& p) const {
+        for (int i = 0; i < 3; ++i) {
+            if (p[i] < offset[i] || p[i] > offset[i] + scale[i]) return false;
+        }
+        return true;
+    }
+
+    // ---- Encoding ----
+
+    void encodeVertices(const SVertexFormat& format, std::span<const SVertex> vertices,
+                        const SPositionDequant& dequant, std::uint8_t* out) {
+        const SVertexLayout layout = format.layout();
+        if (format.position == EPositionEncoding::Float32 && format.normal == ENormalEncoding::Float32 &&
+            format.uv == EUVEncoding::Float32) {
+            std::memcpy(out, vertices.data(), vertices.size_bytes());
+            return;
+        }
+
+        const std::uint32_t normalOffset = layout.attributes[1].offset;
+        const std::uint32_t uvOffset = layout.attributes[2].offset;
+        glm::vec3 invScale;
+        for (int i = 0; i < 3; ++i) invScale[i] = dequant.scale[i] > 0.0f ? 1.0f / dequant.scale[i] : 0.0f;
+
+        for (const SVertex& v : vertices) {
+            if (format.position == EPositionEncoding::Float32) {
+                const float p[3] = {v.x, v.y, v.z};
+                std::memcpy(out, p, sizeof(p));
+            } else {
+                const std::uint16_t q[4] = {toUnorm16((v.x - dequant.offset.x) * invScale.x),
+                                            toUnorm16((v.y - dequant.offset.y) * invScale.y),
+                                            toUnorm16((v.z - dequant.offset.z) * invScale.z), 0};
+                std::memcpy(out, q, sizeof(q));
+            }
+
+            if (format.normal == ENormalEncoding::Float32) {
+                const float n[3] = {v.nx, v.ny, v.nz};
+                std::memcpy(out + normalOffset, n, sizeof(n));
+            } else if (format.normal == ENormalEncoding::Octahedral16) {
+                std::uint32_t qx = 0, qy = 0;
+                quantizeOctahedral(glm::vec3(v.nx, v.ny, v.nz), 255.0f, qx, qy);
+                const std::uint8_t q[4] = {static_cast<std::uint8_t>(qx), static_cast<std::uint8_t>(qy), 0, 0};
+                std::memcpy(out + normalOffset, q, sizeof(q));
+            } else {
+                std::uint32_t qx = 0, qy = 0;
+                quantizeOctahedral(glm::vec3(v.nx, v.ny, v.nz), 65535.0f, qx, qy);
+                const std::uint16_t q[2] = {static_cast<std::uint16_t>(qx), static_cast<std::uint16_t>(qy)};
+                std::memcpy(out + normalOffset, q, sizeof(q));
+            }
+
+            if (format.uv == EUVEncoding::Float32) {
+                const float uv[2] = {v.u, v.v};
+                std::memcpy(out + uvOffset, uv, sizeof(uv));
+            } else if (format.uv == EUVEncoding::Half16) {
+                const std::uint16_t uv[2] = {floatToHalf(v.u), floatToHalf(v.v)};
+                std::memcpy(out + uvOffset, uv, sizeof(uv));
+            } else {
+                const std::uint16_t uv[2] = {toUnorm16(v.u), toUnorm16(v.v)};
+                std::memcpy(out + uvOffset, uv, sizeof(uv));
+            }
+
+            out += layout.stride;
+        }
+    }
+
+} // namespace Kinetica
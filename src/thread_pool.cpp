@@ -0,0 +1,170 @@
+#include <kinetica/thread_pool.hpp>
+#include <kinetica/profiler.hpp>
+
+#include <algorithm>
+
+namespace Kinetica {
+
+    // Index of the current thread's queue in the pool that owns it.
+    static thread_local const CThreadPool* t_pool = nullptr;
+    static thread_local std::size_t t_queue = 0;
+
+    // Failed steal attempts before wait() goes to sleep.
+    static constexpr std::size_t WAIT_SPINS = 64;
+
+    CThreadPool::CThreadPool(std::size_t threadCount) {
+        if (threadCount == 0) {
+            const std::size_t hw = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+            threadCount = std::max<std::size_t>(hw - 1, 1);
+        }
+
+        for (std::size_t i = 0; i <= threadCount; ++i) {
+            m_queues.push_back(std::make_unique<SWorkerQueue>());
+        }
+        for (std::size_t i = 0; i < threadCount; ++i) {
+            m_workers.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    CThreadPool::~CThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_stop = true;
+        }
+        m_wakeup.notify_all();
+        for (auto& worker : m_workers) worker.join();
+    }
+
+    void CThreadPool::submit(CTaskGroup& group, Task task) {
+        group.m_pending.fetch_add(1, std::memory_order_relaxed);
+
+        // Workers keep their own spawns local; everyone else uses the shared queue.
+        const std::size_t queue = (t_pool == this) ? t_queue : m_workers.size();
+        {
+            std::lock_guard<std::mutex> lock(m_queues[queue]->mutex);
+            m_queues[queue]->tasks.push_back({ std::move(task), &group });
+        }
+        m_queued.fetch_add(1, std::memory_order_release);
+        bool waiters;
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            waiters = m_waiters > 0;
+        }
+        m_wakeup.notify_one();
+        if (waiters) m_groupDone.notify_all();
+    }
+
+    void CThreadPool::wait(CTaskGroup& group) {
+        const std::size_t queue = (t_pool == this) ? t_queue : m_workers.size();
+        std::size_t idle = 0;
+        while (!group.done()) {
+            if (tryRunOne(queue)) {
+                idle = 0;
+            } else if (++idle < WAIT_SPINS) {
+                std::this_thread::yield();
+            } else {
+                // The rest of the group runs on other threads: sleep instead of spinning.
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                ++m_waiters;
+                m_groupDone.wait(lock, [&] { return group.done() || m_queued.load(std::memory_order_acquire) > 0; });
+                --m_waiters;
+                idle = 0;
+            }
+        }
+        if (group.m_failed.load(std::memory_order_acquire)) {
+            std::exception_ptr error = std::move(group.m_error);
+            group.m_error = nullptr;
+            group.m_failed.store(false, std::memory_order_relaxed);
+            std::rethrow_exception(error);
+        }
+    }
+
+    void CThreadPool::parallelFor(std::size_t count, std::size_t grain,
+                                  const std::function<void(std::size_t, std::size_t)>& fn) {
+        if (count == 0) return;
+        grain = std::max<std::size_t>(grain, 1);
+        if (count <= grain) {
+            fn(0, count);
+            return;
+        }
+
+        CTaskGroup group;
+        for (std::size_t begin = 0; begin < count; begin += grain) {
+            const std::size_t end = std::min(begin + grain, count);
+            submit(group, [&fn, begin, end] { fn(begin, end); });
+        }
+        wait(group);
+    }
+
+    bool CThreadPool::popTask(std::size_t queue, bool back, STask& out) {
+        SWorkerQueue& q = *m_queues[queue];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.tasks.empty()) return false;
+        if (back) {
+            out = std::move(q.tasks.back());
+            q.tasks.pop_back();
+        } else {
+            out = std::move(q.tasks.front());
+            q.tasks.pop_front();
+        }
+        m_queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool CThreadPool::tryRunOne(std::size_t preferredQueue) {
+        STask task;
+        if (popTask(preferredQueue, true, task)) {
+            run(task);
+            return true;
+        }
+
+        // Steal the oldest work from everybody else.
+        const std::size_t count = m_queues.size();
+        for (std::size_t i = 1; i < count; ++i) {
+            if (popTask((preferredQueue + i) % count, false, task)) {
+                run(task);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CThreadPool::run(STask& task) {
+        // Exceptions never leave the pool: wait() rethrows them on the group's owner.
+        CTaskGroup& group = *task.group;
+        try {
+            task.fn();
+        } catch (...) {
+            if (!group.m_failed.exchange(true, std::memory_order_acq_rel)) group.m_error = std::current_exception();
+        }
+        finish(group);
+    }
+
+    void CThreadPool::finish(CTaskGroup& group) {
+        // The group may be gone as soon as the count hits zero.
+        if (group.m_pending.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        bool waiters;
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            waiters = m_waiters > 0;
+        }
+        if (waiters) m_groupDone.notify_all();
+    }
+
+    void CThreadPool::workerLoop(std::size_t index) {
+        t_pool = this;
+        t_queue = index;
+        KPROFILE_THREAD("Worker " + std::to_string(index));
+
+        while (true) {
+            if (tryRunOne(index)) continue;
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_wakeup.wait(lock, [this] {
+                return m_stop.load() || m_queued.load(std::memory_order_acquire) > 0;
+            });
+            if (m_stop) return;
+        }
+    }
+
+} // namespace Kinetica